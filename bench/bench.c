@@ -0,0 +1,337 @@
+/**
+ * bench/bench.c
+ *
+ * End-to-end throughput benchmark. Generates synthetic documents (or
+ * reads the files given on the command line) and times lexing, parsing
+ * and freeing separately, plus how fast a binary snapshot of the same
+ * tree loads. Build and run with `make bench`.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "../src/lexer.h"
+#include "../src/parser.h"
+#include "../src/parallel_parse.h"
+#include "../src/dom.h"
+#include "../src/utils.h"
+#include "../src/snapshot.h"
+
+// --- Corpus generation ---
+
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} Buffer;
+
+static void buffer_append(Buffer* b, const char* s, size_t n) {
+    if (b->length + n + 1 > b->capacity) {
+        size_t capacity = b->capacity ? b->capacity : 4096;
+        while (b->length + n + 1 > capacity) {
+            capacity *= 2;
+        }
+        char* grown = (char*)realloc(b->data, capacity);
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        b->data = grown;
+        b->capacity = capacity;
+    }
+    memcpy(b->data + b->length, s, n);
+    b->length += n;
+    b->data[b->length] = '\0';
+}
+
+static void buffer_puts(Buffer* b, const char* s) {
+    buffer_append(b, s, strlen(s));
+}
+
+// Chains of 1000 nested elements, repeated.
+static void generate_deep(Buffer* b, size_t target) {
+    static const char* tags[] = { "div", "section", "span", "article" };
+    while (b->length < target) {
+        for (int i = 0; i < 1000; i++) {
+            buffer_puts(b, "<");
+            buffer_puts(b, tags[i % 4]);
+            buffer_puts(b, ">");
+        }
+        buffer_puts(b, "leaf");
+        for (int i = 999; i >= 0; i--) {
+            buffer_puts(b, "</");
+            buffer_puts(b, tags[i % 4]);
+            buffer_puts(b, ">");
+        }
+    }
+}
+
+// Long runs of siblings under a single parent.
+static void generate_wide(Buffer* b, size_t target) {
+    buffer_puts(b, "<ul>");
+    char item[64];
+    for (int i = 0; b->length < target; i++) {
+        int n = snprintf(item, sizeof(item), "<li>item %d</li><br/>", i);
+        buffer_append(b, item, n);
+    }
+    buffer_puts(b, "</ul>");
+}
+
+// Elements carrying many attributes, including boolean ones.
+static void generate_attributes(Buffer* b, size_t target) {
+    buffer_puts(b, "<form>");
+    char element[512];
+    for (int i = 0; b->length < target; i++) {
+        int n = snprintf(element, sizeof(element),
+                         "<input id=\"field-%d\" class=\"form-control input-lg\" type=\"text\" "
+                         "name=\"name%d\" value='value %d' placeholder=\"Enter a value\" "
+                         "data-index=\"%d\" data-role=\"input\" aria-label=\"Field %d\" required/>",
+                         i, i, i, i, i);
+        buffer_append(b, element, n);
+    }
+    buffer_puts(b, "</form>");
+}
+
+// Few elements, large text blocks.
+static void generate_text(Buffer* b, size_t target) {
+    static const char* words = "lorem ipsum dolor sit amet consectetur adipiscing elit sed do "
+                               "eiusmod tempor incididunt ut labore et dolore magna aliqua\n";
+    buffer_puts(b, "<body>");
+    while (b->length < target) {
+        buffer_puts(b, "<p>");
+        for (int i = 0; i < 512; i++) {
+            buffer_puts(b, words);
+        }
+        buffer_puts(b, "</p>");
+    }
+    buffer_puts(b, "</body>");
+}
+
+// --- Measurement ---
+
+typedef struct {
+    const char* name;
+    const char* data;
+    size_t length;
+} Input;
+
+typedef struct {
+    double lex_seconds;
+    double parse_seconds;
+    double free_seconds;
+    double load_seconds;    // snapshot_open + snapshot_close of the same tree
+    double parallel_seconds; // parse_parallel() with -j threads
+    double lex_ahead_seconds; // parse() with ParserOptions.pipeline
+    long tokens;
+    long nodes;
+    int ok;
+} Result;
+
+// Set by --lex-ahead: also time parse() with the lexer on its own thread.
+static int lex_ahead = 0;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long count_nodes(const DomNode* root) {
+    long count = 0;
+    const DomNode* node = root;
+    while (node != NULL) {
+        count++;
+        if (node->first_child != NULL) {
+            node = node->first_child;
+            continue;
+        }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
+    }
+    return count;
+}
+
+// Best (lowest) time of `iterations` runs for each phase.
+static Result run_input(const Input* input, int iterations, int workers) {
+    Result result = { 1e30, 1e30, 1e30, 1e30, 1e30, 1e30, 0, 0, 1 };
+    // A name of our own, so runs side by side and other users' files are
+    // left alone; snapshot_write() then replaces the empty file.
+    char snapshot_path[] = "/tmp/html_parser_bench.XXXXXX";
+    int snapshot_fd = mkstemp(snapshot_path);
+    if (snapshot_fd >= 0) {
+        close(snapshot_fd);
+    }
+    for (int it = 0; it < iterations; it++) {
+        double start = now_seconds();
+        Lexer* lexer = lexer_init_n(input->data, input->length);
+        lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
+        long tokens = 0;
+        for (;;) {
+            Token token = get_next_token(lexer);
+            tokens++;
+            if (token.type == TOKEN_EOF || token.type == TOKEN_ERROR) {
+                break;
+            }
+        }
+        lexer_free(lexer);
+        double lexed = now_seconds();
+
+        lexer = lexer_init_n(input->data, input->length);
+        Parser* parser = parser_init(lexer, NULL);
+        DomNode* root = parse(parser);
+        double parsed = now_seconds();
+        if (parser->has_error) {
+            fprintf(stderr, " %s: %s\n", input->name, parser->error_message);
+            result.ok = 0;
+        }
+        long nodes = count_nodes(root);
+
+        double loaded = 0;
+        if (snapshot_fd >= 0 && snapshot_write(root, snapshot_path) == 0) {
+            double loading = now_seconds();
+            snapshot_close(snapshot_open(snapshot_path));
+            loaded = now_seconds() - loading;
+        }
+
+        double freeing = now_seconds();
+        free_dom_tree(root);
+        double freed = now_seconds();
+        parser_free(parser);
+        lexer_free(lexer);
+
+        if (workers > 1) {
+            lexer = lexer_init_n(input->data, input->length);
+            parser = parser_init(lexer, NULL);
+            double parallel_start = now_seconds();
+            root = parse_parallel(parser, workers);
+            double parallel = now_seconds() - parallel_start;
+            if (parallel < result.parallel_seconds) result.parallel_seconds = parallel;
+            free_dom_tree(root);
+            parser_free(parser);
+            lexer_free(lexer);
+        }
+
+        if (lex_ahead) {
+            ParserOptions options = { 0 };
+            options.pipeline = 1;
+            lexer = lexer_init_n(input->data, input->length);
+            parser = parser_init(lexer, &options);
+            double pipelined_start = now_seconds();
+            root = parse(parser);
+            double pipelined = now_seconds() - pipelined_start;
+            if (pipelined < result.lex_ahead_seconds) result.lex_ahead_seconds = pipelined;
+            free_dom_tree(root);
+            parser_free(parser);
+            lexer_free(lexer);
+        }
+
+        if (lexed - start < result.lex_seconds) result.lex_seconds = lexed - start;
+        if (parsed - lexed < result.parse_seconds) result.parse_seconds = parsed - lexed;
+        if (freed - freeing < result.free_seconds) result.free_seconds = freed - freeing;
+        if (loaded > 0 && loaded < result.load_seconds) result.load_seconds = loaded;
+        result.tokens = tokens;
+        result.nodes = nodes;
+    }
+    if (snapshot_fd >= 0) {
+        remove(snapshot_path);
+    }
+    return result;
+}
+
+static void report(const Input* input, const Result* r, int workers) {
+    double mb = input->length / (1024.0 * 1024.0);
+    printf("%-12s %8.2f MB | lex %8.1f MB/s %8.2f Mtok/s | parse %8.1f MB/s %8.2f Mnodes/s"
+           " | free %8.2f Mnodes/s | snapshot load %8.1f MB/s%s\n",
+           input->name, mb,
+           mb / r->lex_seconds, r->tokens / r->lex_seconds / 1e6,
+           mb / r->parse_seconds, r->nodes / r->parse_seconds / 1e6,
+           r->nodes / r->free_seconds / 1e6,
+           mb / r->load_seconds,
+           r->ok ? "" : "  (parse error)");
+    if (workers > 1) {
+        printf("%-12s %11s | parse -j%-3d %8.1f MB/s (%.2fx sequential)\n", "", "", workers,
+               mb / r->parallel_seconds, r->parse_seconds / r->parallel_seconds);
+    }
+    if (lex_ahead) {
+        printf("%-12s %11s | parse --lex-ahead %8.1f MB/s (%.2fx sequential)\n", "", "",
+               mb / r->lex_ahead_seconds, r->parse_seconds / r->lex_ahead_seconds);
+    }
+}
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage: %s [--size MB] [--iterations N] [-j threads] [--lex-ahead] [file.html ...]\n", program);
+}
+
+int main(int argc, char* argv[]) {
+    double size_mb = 8;
+    int iterations = 5;
+    int workers = 1;
+    int first_file = argc;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size_mb = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--lex-ahead") == 0) {
+            lex_ahead = 1;
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        } else {
+            first_file = i;
+            break;
+        }
+    }
+    if (size_mb <= 0 || iterations < 1 || workers < 1) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int failed = 0;
+    if (first_file < argc) {
+        for (int i = first_file; i < argc; i++) {
+            FileBuffer file;
+            if (map_file(argv[i], &file, 0) != 0) {
+                failed = 1;
+                continue;
+            }
+            Input input = { argv[i], file.data, file.length };
+            Result r = run_input(&input, iterations, workers);
+            report(&input, &r, workers);
+            failed |= !r.ok;
+            unmap_file(&file);
+        }
+    } else {
+        size_t target = (size_t)(size_mb * 1024 * 1024);
+        struct {
+            const char* name;
+            void (*generate)(Buffer*, size_t);
+        } corpora[] = {
+            { "deep", generate_deep },
+            { "wide", generate_wide },
+            { "attributes", generate_attributes },
+            { "text", generate_text },
+        };
+        for (size_t i = 0; i < sizeof(corpora) / sizeof(corpora[0]); i++) {
+            Buffer buffer = { NULL, 0, 0 };
+            corpora[i].generate(&buffer, target);
+            Input input = { corpora[i].name, buffer.data, buffer.length };
+            Result r = run_input(&input, iterations, workers);
+            report(&input, &r, workers);
+            failed |= !r.ok;
+            free(buffer.data);
+        }
+    }
+
+    struct rusage usage_info;
+    getrusage(RUSAGE_SELF, &usage_info);
+    printf("peak RSS: %.1f MB (best of %d runs per phase)\n", usage_info.ru_maxrss / 1024.0, iterations);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#include "arena.h"
+#include "utils.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_MIN_BLOCK_SIZE (8 * 1024)
+#define ARENA_MAX_BLOCK_SIZE (1024 * 1024)
+#define ARENA_ALIGNMENT (sizeof(void*) > sizeof(double) ? sizeof(void*) : sizeof(double))
+
+Arena* arena_create(void) {
+    Arena* arena = (Arena*)safe_malloc(sizeof(Arena));
+    arena->head = NULL;
+    arena->next_block_size = ARENA_MIN_BLOCK_SIZE;
+    arena->bytes_reserved = 0;
+    arena->bytes_used = 0;
+    return arena;
+}
+
+void arena_destroy(Arena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+    ArenaBlock* block = arena->head;
+    while (block != NULL) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+static ArenaBlock* new_block(Arena* arena, size_t min_size) {
+    size_t size = arena->next_block_size;
+    if (size < min_size) {
+        size = min_size;
+    }
+    ArenaBlock* block = (ArenaBlock*)safe_malloc(sizeof(ArenaBlock) + size);
+    block->size = size;
+    block->used = 0;
+    arena->bytes_reserved += size;
+    if (arena->next_block_size < ARENA_MAX_BLOCK_SIZE) {
+        arena->next_block_size *= 2;
+    }
+    return block;
+}
+
+static void* bump(Arena* arena, size_t size, size_t align) {
+    ArenaBlock* head = arena->head;
+    if (head != NULL) {
+        uintptr_t next = (uintptr_t)(head->data + head->used);
+        size_t start = head->used + (((next + align - 1) & ~(uintptr_t)(align - 1)) - next);
+        if (start + size <= head->size) {
+            head->used = start + size;
+            arena->bytes_used += size;
+            return head->data + start;
+        }
+    }
+
+    // Oversized requests get a dedicated block linked behind the head, so
+    // the free space left in the current block is not thrown away.
+    if (head != NULL && size > arena->next_block_size / 4) {
+        ArenaBlock* block = new_block(arena, size);
+        block->used = size;
+        block->next = head->next;
+        head->next = block;
+        arena->bytes_used += size;
+        return block->data;
+    }
+
+    ArenaBlock* block = new_block(arena, size);
+    block->next = head;
+    arena->head = block;
+    block->used = size;
+    arena->bytes_used += size;
+    return block->data;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    return bump(arena, size, ARENA_ALIGNMENT);
+}
+
+char* arena_alloc_bytes(Arena* arena, size_t size) {
+    return (char*)bump(arena, size, 1);
+}
+
+char* arena_strndup(Arena* arena, const char* s, size_t n) {
+    if (s == NULL) {
+        return NULL;
+    }
+    char* copy = arena_alloc_bytes(arena, n + 1);
+    memcpy(copy, s, n);
+    copy[n] = '\0';
+    return copy;
+}
+
+void arena_adopt(Arena* arena, Arena* other) {
+    if (other == NULL) {
+        return;
+    }
+    if (other->head != NULL) {
+        // The adopted blocks go behind the head, which stays the block
+        // that new allocations are bumped from.
+        ArenaBlock* tail = other->head;
+        while (tail->next != NULL) {
+            tail = tail->next;
+        }
+        if (arena->head == NULL) {
+            arena->head = other->head;
+        } else {
+            tail->next = arena->head->next;
+            arena->head->next = other->head;
+        }
+    }
+    arena->bytes_reserved += other->bytes_reserved;
+    arena->bytes_used += other->bytes_used;
+    free(other);
+}
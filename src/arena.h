@@ -0,0 +1,39 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Bump-pointer allocator. Memory handed out by an arena is never freed
+// individually; arena_destroy releases every block in one call.
+
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock* head;
+    size_t next_block_size;
+    size_t bytes_reserved;   // sum of all block sizes
+    size_t bytes_used;       // sum of all allocations
+} Arena;
+
+Arena* arena_create(void);
+
+void arena_destroy(Arena* arena);
+
+// Pointer-aligned allocation, for structs.
+void* arena_alloc(Arena* arena, size_t size);
+
+// Byte-aligned allocation, for string storage.
+char* arena_alloc_bytes(Arena* arena, size_t size);
+
+char* arena_strndup(Arena* arena, const char* s, size_t n);
+
+// Moves every block of `other` into `arena` and frees `other`. Memory
+// from either arena stays valid until arena_destroy(arena).
+void arena_adopt(Arena* arena, Arena* other);
+
+#endif
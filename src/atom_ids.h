@@ -0,0 +1,273 @@
+// Generated by tools/gen_atoms.py. Do not edit.
+#ifndef ATOM_IDS_H
+#define ATOM_IDS_H
+
+enum {
+    ATOM_NONE = 0,
+    ATOM_A = 1,
+    ATOM_ABBR = 2,
+    ATOM_ACCEPT = 3,
+    ATOM_ACCEPT_CHARSET = 4,
+    ATOM_ACCESSKEY = 5,
+    ATOM_ACRONYM = 6,
+    ATOM_ACTION = 7,
+    ATOM_ADDRESS = 8,
+    ATOM_ALIGN = 9,
+    ATOM_ALT = 10,
+    ATOM_APPLET = 11,
+    ATOM_AREA = 12,
+    ATOM_ARIA_CONTROLS = 13,
+    ATOM_ARIA_CURRENT = 14,
+    ATOM_ARIA_DESCRIBEDBY = 15,
+    ATOM_ARIA_EXPANDED = 16,
+    ATOM_ARIA_HIDDEN = 17,
+    ATOM_ARIA_LABEL = 18,
+    ATOM_ARIA_LABELLEDBY = 19,
+    ATOM_ARIA_LIVE = 20,
+    ATOM_ARTICLE = 21,
+    ATOM_ASIDE = 22,
+    ATOM_ASYNC = 23,
+    ATOM_AUDIO = 24,
+    ATOM_AUTOCAPITALIZE = 25,
+    ATOM_AUTOCOMPLETE = 26,
+    ATOM_AUTOFOCUS = 27,
+    ATOM_AUTOPLAY = 28,
+    ATOM_B = 29,
+    ATOM_BACKGROUND = 30,
+    ATOM_BASE = 31,
+    ATOM_BASEFONT = 32,
+    ATOM_BDI = 33,
+    ATOM_BDO = 34,
+    ATOM_BGCOLOR = 35,
+    ATOM_BIG = 36,
+    ATOM_BLOCKQUOTE = 37,
+    ATOM_BODY = 38,
+    ATOM_BORDER = 39,
+    ATOM_BR = 40,
+    ATOM_BUTTON = 41,
+    ATOM_CANVAS = 42,
+    ATOM_CAPTION = 43,
+    ATOM_CENTER = 44,
+    ATOM_CHARSET = 45,
+    ATOM_CHECKED = 46,
+    ATOM_CITE = 47,
+    ATOM_CLASS = 48,
+    ATOM_CODE = 49,
+    ATOM_COL = 50,
+    ATOM_COLGROUP = 51,
+    ATOM_COLOR = 52,
+    ATOM_COLS = 53,
+    ATOM_COLSPAN = 54,
+    ATOM_CONTENT = 55,
+    ATOM_CONTENTEDITABLE = 56,
+    ATOM_CONTROLS = 57,
+    ATOM_COORDS = 58,
+    ATOM_CROSSORIGIN = 59,
+    ATOM_DATA = 60,
+    ATOM_DATALIST = 61,
+    ATOM_DATETIME = 62,
+    ATOM_DD = 63,
+    ATOM_DECODING = 64,
+    ATOM_DEFAULT = 65,
+    ATOM_DEFER = 66,
+    ATOM_DEL = 67,
+    ATOM_DETAILS = 68,
+    ATOM_DFN = 69,
+    ATOM_DIALOG = 70,
+    ATOM_DIR = 71,
+    ATOM_DIRNAME = 72,
+    ATOM_DISABLED = 73,
+    ATOM_DIV = 74,
+    ATOM_DL = 75,
+    ATOM_DOWNLOAD = 76,
+    ATOM_DRAGGABLE = 77,
+    ATOM_DT = 78,
+    ATOM_EM = 79,
+    ATOM_EMBED = 80,
+    ATOM_ENCTYPE = 81,
+    ATOM_ENTERKEYHINT = 82,
+    ATOM_FIELDSET = 83,
+    ATOM_FIGCAPTION = 84,
+    ATOM_FIGURE = 85,
+    ATOM_FONT = 86,
+    ATOM_FOOTER = 87,
+    ATOM_FOR = 88,
+    ATOM_FORM = 89,
+    ATOM_FORMACTION = 90,
+    ATOM_FORMENCTYPE = 91,
+    ATOM_FORMMETHOD = 92,
+    ATOM_FORMNOVALIDATE = 93,
+    ATOM_FORMTARGET = 94,
+    ATOM_FRAME = 95,
+    ATOM_FRAMESET = 96,
+    ATOM_H1 = 97,
+    ATOM_H2 = 98,
+    ATOM_H3 = 99,
+    ATOM_H4 = 100,
+    ATOM_H5 = 101,
+    ATOM_H6 = 102,
+    ATOM_HEAD = 103,
+    ATOM_HEADER = 104,
+    ATOM_HEADERS = 105,
+    ATOM_HEIGHT = 106,
+    ATOM_HGROUP = 107,
+    ATOM_HIDDEN = 108,
+    ATOM_HIGH = 109,
+    ATOM_HR = 110,
+    ATOM_HREF = 111,
+    ATOM_HREFLANG = 112,
+    ATOM_HTML = 113,
+    ATOM_HTTP_EQUIV = 114,
+    ATOM_I = 115,
+    ATOM_ID = 116,
+    ATOM_IFRAME = 117,
+    ATOM_IMG = 118,
+    ATOM_INERT = 119,
+    ATOM_INPUT = 120,
+    ATOM_INPUTMODE = 121,
+    ATOM_INS = 122,
+    ATOM_INTEGRITY = 123,
+    ATOM_IS = 124,
+    ATOM_ITEMID = 125,
+    ATOM_ITEMPROP = 126,
+    ATOM_ITEMREF = 127,
+    ATOM_ITEMSCOPE = 128,
+    ATOM_ITEMTYPE = 129,
+    ATOM_KBD = 130,
+    ATOM_KIND = 131,
+    ATOM_LABEL = 132,
+    ATOM_LANG = 133,
+    ATOM_LEGEND = 134,
+    ATOM_LI = 135,
+    ATOM_LINK = 136,
+    ATOM_LIST = 137,
+    ATOM_LOADING = 138,
+    ATOM_LOOP = 139,
+    ATOM_LOW = 140,
+    ATOM_MAIN = 141,
+    ATOM_MAP = 142,
+    ATOM_MARK = 143,
+    ATOM_MARQUEE = 144,
+    ATOM_MATH = 145,
+    ATOM_MAX = 146,
+    ATOM_MAXLENGTH = 147,
+    ATOM_MEDIA = 148,
+    ATOM_MENU = 149,
+    ATOM_META = 150,
+    ATOM_METER = 151,
+    ATOM_METHOD = 152,
+    ATOM_MIN = 153,
+    ATOM_MINLENGTH = 154,
+    ATOM_MULTIPLE = 155,
+    ATOM_MUTED = 156,
+    ATOM_NAME = 157,
+    ATOM_NAV = 158,
+    ATOM_NOBR = 159,
+    ATOM_NOFRAMES = 160,
+    ATOM_NONCE = 161,
+    ATOM_NOSCRIPT = 162,
+    ATOM_NOVALIDATE = 163,
+    ATOM_OBJECT = 164,
+    ATOM_OL = 165,
+    ATOM_ONBLUR = 166,
+    ATOM_ONCHANGE = 167,
+    ATOM_ONCLICK = 168,
+    ATOM_ONERROR = 169,
+    ATOM_ONFOCUS = 170,
+    ATOM_ONINPUT = 171,
+    ATOM_ONKEYDOWN = 172,
+    ATOM_ONKEYUP = 173,
+    ATOM_ONLOAD = 174,
+    ATOM_ONMOUSEOUT = 175,
+    ATOM_ONMOUSEOVER = 176,
+    ATOM_ONSUBMIT = 177,
+    ATOM_OPEN = 178,
+    ATOM_OPTGROUP = 179,
+    ATOM_OPTIMUM = 180,
+    ATOM_OPTION = 181,
+    ATOM_OUTPUT = 182,
+    ATOM_P = 183,
+    ATOM_PARAM = 184,
+    ATOM_PATTERN = 185,
+    ATOM_PICTURE = 186,
+    ATOM_PING = 187,
+    ATOM_PLACEHOLDER = 188,
+    ATOM_PLAYSINLINE = 189,
+    ATOM_POPOVER = 190,
+    ATOM_POSTER = 191,
+    ATOM_PRE = 192,
+    ATOM_PRELOAD = 193,
+    ATOM_PROGRESS = 194,
+    ATOM_Q = 195,
+    ATOM_READONLY = 196,
+    ATOM_REFERRERPOLICY = 197,
+    ATOM_REL = 198,
+    ATOM_REQUIRED = 199,
+    ATOM_REVERSED = 200,
+    ATOM_ROLE = 201,
+    ATOM_ROWS = 202,
+    ATOM_ROWSPAN = 203,
+    ATOM_RP = 204,
+    ATOM_RT = 205,
+    ATOM_RUBY = 206,
+    ATOM_S = 207,
+    ATOM_SAMP = 208,
+    ATOM_SANDBOX = 209,
+    ATOM_SCOPE = 210,
+    ATOM_SCRIPT = 211,
+    ATOM_SEARCH = 212,
+    ATOM_SECTION = 213,
+    ATOM_SELECT = 214,
+    ATOM_SELECTED = 215,
+    ATOM_SHAPE = 216,
+    ATOM_SIZE = 217,
+    ATOM_SIZES = 218,
+    ATOM_SLOT = 219,
+    ATOM_SMALL = 220,
+    ATOM_SOURCE = 221,
+    ATOM_SPAN = 222,
+    ATOM_SPELLCHECK = 223,
+    ATOM_SRC = 224,
+    ATOM_SRCDOC = 225,
+    ATOM_SRCLANG = 226,
+    ATOM_SRCSET = 227,
+    ATOM_START = 228,
+    ATOM_STEP = 229,
+    ATOM_STRIKE = 230,
+    ATOM_STRONG = 231,
+    ATOM_STYLE = 232,
+    ATOM_SUB = 233,
+    ATOM_SUMMARY = 234,
+    ATOM_SUP = 235,
+    ATOM_SVG = 236,
+    ATOM_TABINDEX = 237,
+    ATOM_TABLE = 238,
+    ATOM_TARGET = 239,
+    ATOM_TBODY = 240,
+    ATOM_TD = 241,
+    ATOM_TEMPLATE = 242,
+    ATOM_TEXTAREA = 243,
+    ATOM_TFOOT = 244,
+    ATOM_TH = 245,
+    ATOM_THEAD = 246,
+    ATOM_TIME = 247,
+    ATOM_TITLE = 248,
+    ATOM_TR = 249,
+    ATOM_TRACK = 250,
+    ATOM_TRANSLATE = 251,
+    ATOM_TT = 252,
+    ATOM_TYPE = 253,
+    ATOM_U = 254,
+    ATOM_UL = 255,
+    ATOM_USEMAP = 256,
+    ATOM_VALUE = 257,
+    ATOM_VAR = 258,
+    ATOM_VIDEO = 259,
+    ATOM_WBR = 260,
+    ATOM_WIDTH = 261,
+    ATOM_WRAP = 262,
+    ATOM_XMLNS = 263,
+    ATOM_STATIC_COUNT = 264
+};
+
+#endif
@@ -0,0 +1,380 @@
+// Generated by tools/gen_atoms.py. Do not edit.
+#define ATOM_HASH_BUCKETS 128
+#define ATOM_HASH_SLOTS 512
+
+static const char* const atom_static_names[ATOM_STATIC_COUNT] = {
+    NULL,
+    "a",
+    "abbr",
+    "accept",
+    "accept-charset",
+    "accesskey",
+    "acronym",
+    "action",
+    "address",
+    "align",
+    "alt",
+    "applet",
+    "area",
+    "aria-controls",
+    "aria-current",
+    "aria-describedby",
+    "aria-expanded",
+    "aria-hidden",
+    "aria-label",
+    "aria-labelledby",
+    "aria-live",
+    "article",
+    "aside",
+    "async",
+    "audio",
+    "autocapitalize",
+    "autocomplete",
+    "autofocus",
+    "autoplay",
+    "b",
+    "background",
+    "base",
+    "basefont",
+    "bdi",
+    "bdo",
+    "bgcolor",
+    "big",
+    "blockquote",
+    "body",
+    "border",
+    "br",
+    "button",
+    "canvas",
+    "caption",
+    "center",
+    "charset",
+    "checked",
+    "cite",
+    "class",
+    "code",
+    "col",
+    "colgroup",
+    "color",
+    "cols",
+    "colspan",
+    "content",
+    "contenteditable",
+    "controls",
+    "coords",
+    "crossorigin",
+    "data",
+    "datalist",
+    "datetime",
+    "dd",
+    "decoding",
+    "default",
+    "defer",
+    "del",
+    "details",
+    "dfn",
+    "dialog",
+    "dir",
+    "dirname",
+    "disabled",
+    "div",
+    "dl",
+    "download",
+    "draggable",
+    "dt",
+    "em",
+    "embed",
+    "enctype",
+    "enterkeyhint",
+    "fieldset",
+    "figcaption",
+    "figure",
+    "font",
+    "footer",
+    "for",
+    "form",
+    "formaction",
+    "formenctype",
+    "formmethod",
+    "formnovalidate",
+    "formtarget",
+    "frame",
+    "frameset",
+    "h1",
+    "h2",
+    "h3",
+    "h4",
+    "h5",
+    "h6",
+    "head",
+    "header",
+    "headers",
+    "height",
+    "hgroup",
+    "hidden",
+    "high",
+    "hr",
+    "href",
+    "hreflang",
+    "html",
+    "http-equiv",
+    "i",
+    "id",
+    "iframe",
+    "img",
+    "inert",
+    "input",
+    "inputmode",
+    "ins",
+    "integrity",
+    "is",
+    "itemid",
+    "itemprop",
+    "itemref",
+    "itemscope",
+    "itemtype",
+    "kbd",
+    "kind",
+    "label",
+    "lang",
+    "legend",
+    "li",
+    "link",
+    "list",
+    "loading",
+    "loop",
+    "low",
+    "main",
+    "map",
+    "mark",
+    "marquee",
+    "math",
+    "max",
+    "maxlength",
+    "media",
+    "menu",
+    "meta",
+    "meter",
+    "method",
+    "min",
+    "minlength",
+    "multiple",
+    "muted",
+    "name",
+    "nav",
+    "nobr",
+    "noframes",
+    "nonce",
+    "noscript",
+    "novalidate",
+    "object",
+    "ol",
+    "onblur",
+    "onchange",
+    "onclick",
+    "onerror",
+    "onfocus",
+    "oninput",
+    "onkeydown",
+    "onkeyup",
+    "onload",
+    "onmouseout",
+    "onmouseover",
+    "onsubmit",
+    "open",
+    "optgroup",
+    "optimum",
+    "option",
+    "output",
+    "p",
+    "param",
+    "pattern",
+    "picture",
+    "ping",
+    "placeholder",
+    "playsinline",
+    "popover",
+    "poster",
+    "pre",
+    "preload",
+    "progress",
+    "q",
+    "readonly",
+    "referrerpolicy",
+    "rel",
+    "required",
+    "reversed",
+    "role",
+    "rows",
+    "rowspan",
+    "rp",
+    "rt",
+    "ruby",
+    "s",
+    "samp",
+    "sandbox",
+    "scope",
+    "script",
+    "search",
+    "section",
+    "select",
+    "selected",
+    "shape",
+    "size",
+    "sizes",
+    "slot",
+    "small",
+    "source",
+    "span",
+    "spellcheck",
+    "src",
+    "srcdoc",
+    "srclang",
+    "srcset",
+    "start",
+    "step",
+    "strike",
+    "strong",
+    "style",
+    "sub",
+    "summary",
+    "sup",
+    "svg",
+    "tabindex",
+    "table",
+    "target",
+    "tbody",
+    "td",
+    "template",
+    "textarea",
+    "tfoot",
+    "th",
+    "thead",
+    "time",
+    "title",
+    "tr",
+    "track",
+    "translate",
+    "tt",
+    "type",
+    "u",
+    "ul",
+    "usemap",
+    "value",
+    "var",
+    "video",
+    "wbr",
+    "width",
+    "wrap",
+    "xmlns",
+};
+
+static const unsigned char atom_static_lengths[ATOM_STATIC_COUNT] = {
+    0, 1, 4, 6, 14, 9, 7, 6, 7, 5, 3, 6,
+    4, 13, 12, 16, 13, 11, 10, 15, 9, 7, 5, 5,
+    5, 14, 12, 9, 8, 1, 10, 4, 8, 3, 3, 7,
+    3, 10, 4, 6, 2, 6, 6, 7, 6, 7, 7, 4,
+    5, 4, 3, 8, 5, 4, 7, 7, 15, 8, 6, 11,
+    4, 8, 8, 2, 8, 7, 5, 3, 7, 3, 6, 3,
+    7, 8, 3, 2, 8, 9, 2, 2, 5, 7, 12, 8,
+    10, 6, 4, 6, 3, 4, 10, 11, 10, 14, 10, 5,
+    8, 2, 2, 2, 2, 2, 2, 4, 6, 7, 6, 6,
+    6, 4, 2, 4, 8, 4, 10, 1, 2, 6, 3, 5,
+    5, 9, 3, 9, 2, 6, 8, 7, 9, 8, 3, 4,
+    5, 4, 6, 2, 4, 4, 7, 4, 3, 4, 3, 4,
+    7, 4, 3, 9, 5, 4, 4, 5, 6, 3, 9, 8,
+    5, 4, 3, 4, 8, 5, 8, 10, 6, 2, 6, 8,
+    7, 7, 7, 7, 9, 7, 6, 10, 11, 8, 4, 8,
+    7, 6, 6, 1, 5, 7, 7, 4, 11, 11, 7, 6,
+    3, 7, 8, 1, 8, 14, 3, 8, 8, 4, 4, 7,
+    2, 2, 4, 1, 4, 7, 5, 6, 6, 7, 6, 8,
+    5, 4, 5, 4, 5, 6, 4, 10, 3, 6, 7, 6,
+    5, 4, 6, 6, 5, 3, 7, 3, 3, 8, 5, 6,
+    5, 2, 8, 8, 5, 2, 5, 4, 5, 2, 5, 9,
+    2, 4, 1, 2, 6, 5, 3, 5, 3, 5, 4, 5,
+};
+
+static const unsigned char atom_static_flags[ATOM_STATIC_COUNT] = {
+    0, 2, 2, 4, 4, 4, 2, 4, 2, 4, 4, 2,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4,
+    2, 4, 4, 4, 4, 2, 4, 3, 2, 2, 2, 4,
+    2, 2, 2, 4, 3, 2, 2, 2, 2, 4, 4, 6,
+    4, 2, 3, 2, 4, 4, 4, 4, 4, 4, 4, 4,
+    6, 2, 4, 2, 4, 4, 4, 2, 2, 2, 2, 6,
+    4, 4, 2, 2, 4, 4, 2, 2, 3, 4, 4, 2,
+    2, 2, 2, 2, 4, 6, 4, 4, 4, 4, 4, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 2,
+    4, 4, 3, 4, 4, 2, 4, 2, 4, 2, 3, 4,
+    3, 4, 2, 4, 4, 4, 4, 4, 4, 4, 2, 4,
+    6, 4, 2, 2, 3, 4, 4, 4, 4, 2, 2, 2,
+    2, 2, 4, 4, 4, 2, 3, 2, 4, 4, 4, 4,
+    4, 4, 2, 2, 2, 4, 2, 4, 2, 2, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2,
+    4, 2, 2, 2, 3, 4, 2, 4, 4, 4, 4, 4,
+    2, 4, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 4, 4, 2, 2, 2, 2, 4,
+    4, 4, 4, 6, 2, 3, 6, 4, 4, 4, 4, 4,
+    4, 4, 2, 2, 6, 2, 2, 2, 2, 4, 2, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 3, 4,
+    2, 4, 2, 2, 4, 4, 2, 2, 3, 4, 4, 4,
+};
+
+static const unsigned short atom_hash_seeds[ATOM_HASH_BUCKETS] = {
+    0, 4, 6, 3, 1, 1, 0, 30, 0, 0, 3, 1,
+    1, 1, 2, 1, 0, 2, 0, 1, 3, 1, 4, 1,
+    2, 1, 1, 3, 0, 1, 1, 2, 2, 1, 3, 5,
+    0, 1, 1, 2, 0, 2, 1, 2, 0, 5, 4, 1,
+    3, 0, 0, 0, 1, 1, 6, 2, 1, 0, 5, 2,
+    5, 0, 1, 2, 1, 3, 1, 0, 1, 5, 0, 5,
+    1, 1, 0, 1, 4, 0, 2, 0, 3, 1, 0, 1,
+    2, 11, 2, 1, 1, 8, 7, 4, 3, 0, 4, 2,
+    4, 2, 5, 0, 0, 1, 2, 3, 3, 1, 1, 3,
+    1, 4, 0, 2, 0, 1, 2, 0, 3, 1, 1, 0,
+    1, 1, 1, 1, 7, 4, 4, 2,
+};
+
+static const unsigned short atom_hash_slots[ATOM_HASH_SLOTS] = {
+    0, 0, 13, 238, 0, 0, 0, 0, 161, 0, 138, 135,
+    0, 0, 233, 0, 55, 148, 65, 132, 73, 227, 105, 245,
+    0, 250, 0, 0, 214, 171, 0, 66, 0, 6, 78, 0,
+    12, 0, 0, 71, 185, 0, 88, 0, 0, 0, 35, 237,
+    0, 158, 0, 0, 0, 193, 81, 159, 209, 0, 104, 0,
+    79, 191, 0, 130, 0, 246, 0, 121, 59, 241, 111, 0,
+    0, 0, 0, 41, 0, 166, 62, 240, 206, 0, 72, 244,
+    89, 39, 0, 0, 86, 253, 0, 0, 0, 252, 0, 0,
+    0, 76, 25, 33, 0, 0, 0, 106, 0, 0, 174, 226,
+    0, 107, 0, 0, 70, 101, 0, 181, 0, 0, 5, 178,
+    0, 53, 0, 0, 0, 0, 8, 100, 131, 0, 0, 103,
+    120, 175, 215, 0, 0, 0, 18, 0, 0, 60, 196, 0,
+    0, 4, 0, 0, 0, 257, 10, 50, 134, 0, 0, 67,
+    0, 0, 0, 235, 0, 0, 69, 234, 43, 114, 57, 0,
+    0, 203, 223, 0, 219, 0, 167, 152, 0, 0, 24, 0,
+    96, 155, 189, 19, 0, 228, 16, 0, 123, 220, 0, 0,
+    195, 0, 177, 169, 0, 26, 0, 0, 0, 0, 247, 0,
+    0, 27, 224, 68, 36, 83, 0, 0, 225, 0, 200, 0,
+    91, 197, 207, 0, 262, 113, 187, 0, 34, 141, 21, 0,
+    0, 136, 2, 0, 0, 0, 0, 0, 0, 140, 0, 0,
+    63, 263, 146, 172, 0, 0, 0, 0, 208, 0, 0, 143,
+    248, 28, 153, 0, 0, 0, 0, 0, 77, 109, 229, 9,
+    0, 0, 15, 30, 108, 222, 0, 0, 20, 40, 183, 94,
+    213, 102, 150, 164, 0, 230, 173, 145, 0, 0, 133, 0,
+    216, 0, 58, 0, 0, 0, 0, 87, 0, 95, 0, 0,
+    0, 84, 0, 168, 0, 0, 0, 260, 144, 0, 0, 0,
+    0, 97, 255, 0, 254, 212, 125, 259, 0, 0, 0, 31,
+    0, 0, 0, 0, 56, 7, 115, 0, 45, 92, 0, 0,
+    112, 142, 51, 32, 90, 180, 236, 52, 0, 0, 184, 186,
+    14, 0, 0, 124, 0, 0, 116, 204, 0, 0, 110, 0,
+    165, 46, 157, 0, 117, 61, 0, 98, 0, 0, 85, 0,
+    42, 0, 48, 0, 0, 0, 0, 231, 0, 170, 75, 0,
+    0, 211, 82, 0, 188, 0, 99, 192, 0, 210, 0, 38,
+    0, 194, 0, 22, 0, 221, 0, 118, 0, 64, 0, 0,
+    0, 199, 0, 201, 3, 0, 0, 0, 0, 128, 0, 0,
+    0, 147, 160, 127, 0, 0, 122, 243, 23, 0, 242, 258,
+    151, 0, 205, 163, 0, 0, 119, 0, 0, 182, 126, 93,
+    0, 17, 0, 44, 156, 0, 137, 29, 0, 176, 0, 49,
+    0, 74, 0, 1, 0, 0, 0, 190, 202, 0, 0, 139,
+    0, 11, 0, 0, 217, 249, 0, 198, 0, 47, 0, 218,
+    179, 0, 0, 154, 0, 0, 0, 0, 80, 149, 251, 0,
+    0, 0, 0, 54, 232, 129, 0, 0, 0, 0, 0, 256,
+    0, 162, 37, 0, 0, 0, 239, 261,
+};
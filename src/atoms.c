@@ -0,0 +1,125 @@
+#include "atoms.h"
+#include <stdint.h>
+#include <string.h>
+#include "atom_table.h"
+
+static uint64_t atom_hash(const char* name, size_t length) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static uint32_t atom_mix(uint64_t h, uint32_t seed) {
+    uint64_t x = h ^ (seed * 0x9E3779B97F4A7C15ULL);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (uint32_t)x;
+}
+
+static Atom lookup_hashed(uint64_t h, const char* name, size_t length) {
+    uint32_t seed = atom_hash_seeds[(h >> 32) & (ATOM_HASH_BUCKETS - 1)];
+    Atom atom = atom_hash_slots[atom_mix(h, seed) & (ATOM_HASH_SLOTS - 1)];
+    if (atom != ATOM_NONE && atom_static_lengths[atom] == length &&
+        memcmp(atom_static_names[atom], name, length) == 0) {
+        return atom;
+    }
+    return ATOM_NONE;
+}
+
+Atom atom_lookup(const char* name, size_t length) {
+    return lookup_hashed(atom_hash(name, length), name, length);
+}
+
+int atom_flags(Atom atom) {
+    if (atom <= ATOM_NONE || atom >= ATOM_STATIC_COUNT) {
+        return 0;
+    }
+    return atom_static_flags[atom];
+}
+
+int atom_is_void(Atom atom) {
+    return atom_flags(atom) & ATOM_FLAG_VOID;
+}
+
+void atom_table_init(AtomTable* table, Arena* arena) {
+    table->arena = arena;
+    table->names = NULL;
+    table->lengths = NULL;
+    table->count = 0;
+    table->capacity = 0;
+    table->slots = NULL;
+    table->slot_mask = -1;
+}
+
+// Grows the index; the old arrays simply stay behind in the arena.
+static void grow(AtomTable* table) {
+    int capacity = table->capacity ? table->capacity * 2 : 16;
+    const char** names = (const char**)arena_alloc(table->arena, capacity * sizeof(const char*));
+    int* lengths = (int*)arena_alloc(table->arena, capacity * sizeof(int));
+    if (table->count > 0) {
+        memcpy(names, table->names, table->count * sizeof(const char*));
+        memcpy(lengths, table->lengths, table->count * sizeof(int));
+    }
+    table->names = names;
+    table->lengths = lengths;
+    table->capacity = capacity;
+
+    int slot_count = capacity * 2;
+    table->slots = (Atom*)arena_alloc(table->arena, slot_count * sizeof(Atom));
+    memset(table->slots, 0, slot_count * sizeof(Atom));
+    table->slot_mask = slot_count - 1;
+    for (int i = 0; i < table->count; i++) {
+        uint32_t slot = (uint32_t)atom_hash(names[i], lengths[i]) & table->slot_mask;
+        while (table->slots[slot] != ATOM_NONE) {
+            slot = (slot + 1) & table->slot_mask;
+        }
+        table->slots[slot] = ATOM_STATIC_COUNT + i;
+    }
+}
+
+Atom atom_intern(AtomTable* table, const char* name, size_t length) {
+    uint64_t h = atom_hash(name, length);
+    Atom atom = lookup_hashed(h, name, length);
+    if (atom != ATOM_NONE) {
+        return atom;
+    }
+
+    if (table->count > 0) {
+        uint32_t slot = (uint32_t)h & table->slot_mask;
+        while (table->slots[slot] != ATOM_NONE) {
+            int index = table->slots[slot] - ATOM_STATIC_COUNT;
+            if (table->lengths[index] == (int)length && memcmp(table->names[index], name, length) == 0) {
+                return table->slots[slot];
+            }
+            slot = (slot + 1) & table->slot_mask;
+        }
+    }
+
+    if (table->count == table->capacity) {
+        grow(table);
+    }
+    int index = table->count++;
+    table->names[index] = arena_strndup(table->arena, name, length);
+    table->lengths[index] = (int)length;
+    uint32_t slot = (uint32_t)h & table->slot_mask;
+    while (table->slots[slot] != ATOM_NONE) {
+        slot = (slot + 1) & table->slot_mask;
+    }
+    table->slots[slot] = ATOM_STATIC_COUNT + index;
+    return ATOM_STATIC_COUNT + index;
+}
+
+const char* atom_table_name(const AtomTable* table, Atom atom) {
+    if (atom > ATOM_NONE && atom < ATOM_STATIC_COUNT) {
+        return atom_static_names[atom];
+    }
+    int index = atom - ATOM_STATIC_COUNT;
+    if (table == NULL || index < 0 || index >= table->count) {
+        return NULL;
+    }
+    return table->names[index];
+}
@@ -0,0 +1,46 @@
+#ifndef ATOMS_H
+#define ATOMS_H
+
+#include <stddef.h>
+#include "arena.h"
+#include "atom_ids.h"
+
+// Tag and attribute names as small integers. Known HTML names have fixed
+// ids (ATOM_DIV, ATOM_HREF, ...) resolved through a generated perfect
+// hash; any other name gets a dynamic id from a per-document AtomTable.
+// Ids are only comparable within one document. ATOM_NONE means the name
+// was never interned (nodes built outside a document).
+typedef int Atom;
+
+#define ATOM_FLAG_VOID      0x1   // void element: never has children
+#define ATOM_FLAG_TAG       0x2   // known HTML tag name
+#define ATOM_FLAG_ATTRIBUTE 0x4   // known HTML attribute name
+
+// Static atom for `name`, or ATOM_NONE if it is not a known name.
+Atom atom_lookup(const char* name, size_t length);
+
+// ATOM_FLAG_* bits of a static atom (0 for dynamic atoms).
+int atom_flags(Atom atom);
+
+int atom_is_void(Atom atom);
+
+// Interner for names outside the static table. Names and the index live
+// in `arena`, so the table needs no teardown of its own.
+typedef struct {
+    Arena* arena;
+    const char** names;   // names[i] is dynamic atom ATOM_STATIC_COUNT + i
+    int* lengths;
+    int count;
+    int capacity;
+    Atom* slots;          // open addressing, 0 = empty
+    int slot_mask;
+} AtomTable;
+
+void atom_table_init(AtomTable* table, Arena* arena);
+
+Atom atom_intern(AtomTable* table, const char* name, size_t length);
+
+// NUL-terminated name of a static or dynamic atom.
+const char* atom_table_name(const AtomTable* table, Atom atom);
+
+#endif
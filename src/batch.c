@@ -0,0 +1,228 @@
+#define _POSIX_C_SOURCE 200809L
+#include "batch.h"
+#include "threadpool.h"
+#include "utils.h"
+#include "lexer.h"
+#include "parser.h"
+#include "dom.h"
+#include "parse_cache.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+typedef enum {
+    BATCH_OK,
+    BATCH_PARSE_ERROR,
+    BATCH_READ_ERROR
+} BatchStatus;
+
+// One file's work and result. Each task only touches its own item.
+typedef struct {
+    char* path;
+    ParseCache* cache;      // shared, may be NULL
+    const ParserOptions* options;
+    BatchStatus status;
+    size_t bytes;
+    double seconds;
+    char* error;
+} BatchItem;
+
+typedef struct {
+    char** paths;
+    int count;
+    int capacity;
+} PathList;
+
+static void path_list_add(PathList* list, const char* path) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        char** grown = (char**)realloc(list->paths, list->capacity * sizeof(char*));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        list->paths = grown;
+    }
+    list->paths[list->count++] = safe_strdup(path);
+}
+
+static void collect_directory(PathList* list, const char* dir_path) {
+    DIR* dir = opendir(dir_path);
+    if (dir == NULL) {
+        fprintf(stderr, " Warning: Could not open directory '%s'.\n", dir_path);
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        size_t length = strlen(dir_path) + strlen(entry->d_name) + 2;
+        char* path = (char*)safe_malloc(length);
+        snprintf(path, length, "%s/%s", dir_path, entry->d_name);
+        // Symlinks to files are followed, symlinks to directories are
+        // not: one pointing back up the tree would recurse forever.
+        struct stat st;
+        if (lstat(path, &st) == 0) {
+            if (S_ISDIR(st.st_mode)) {
+                collect_directory(list, path);
+            } else if (S_ISREG(st.st_mode) || (S_ISLNK(st.st_mode) && stat(path, &st) == 0 && S_ISREG(st.st_mode))) {
+                path_list_add(list, path);
+            }
+        }
+        free(path);
+    }
+    closedir(dir);
+}
+
+static int collect_list_file(PathList* list, const char* list_path) {
+    FileBuffer file;
+    if (map_file(list_path, &file, 0) != 0) {
+        return -1;
+    }
+    const char* p = file.data;
+    const char* end = file.data + file.length;
+    while (p < end) {
+        const char* eol = memchr(p, '\n', end - p);
+        const char* line_end = eol ? eol : end;
+        size_t length = line_end - p;
+        if (length > 0 && p[length - 1] == '\r') {
+            length--;
+        }
+        if (length > 0) {
+            char* path = safe_strndup(p, length);
+            path_list_add(list, path);
+            free(path);
+        }
+        p = eol ? eol + 1 : end;
+    }
+    unmap_file(&file);
+    return 0;
+}
+
+static int compare_paths(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void parse_item(void* arg) {
+    BatchItem* item = (BatchItem*)arg;
+    double start = now_seconds();
+
+    FileBuffer source;
+    size_t max_bytes = item->options != NULL ? item->options->max_input_bytes : 0;
+    if (map_file(item->path, &source, max_bytes) != 0) {
+        item->status = BATCH_READ_ERROR;
+        item->error = safe_strdup("Could not read file.");
+        item->seconds = now_seconds() - start;
+        return;
+    }
+    item->bytes = source.length;
+
+    if (item->cache != NULL) {
+        CachedDocument* document = parse_cache_get(item->cache, source.data, source.length);
+        const char* error = cached_document_error(document);
+        item->status = error ? BATCH_PARSE_ERROR : BATCH_OK;
+        item->error = error ? safe_strdup(error) : NULL;
+        cached_document_release(document);
+        unmap_file(&source);
+        item->seconds = now_seconds() - start;
+        return;
+    }
+
+    Lexer* lexer = lexer_init_n(source.data, source.length);
+    Parser* parser = parser_init(lexer, item->options);
+    DomNode* root = parse(parser);
+    if (parser->has_error) {
+        item->status = BATCH_PARSE_ERROR;
+        item->error = safe_strdup(parser->error_message);
+    } else {
+        item->status = BATCH_OK;
+    }
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    unmap_file(&source);
+    item->seconds = now_seconds() - start;
+}
+
+int batch_run(const char* source, int workers, size_t cache_bytes, const ParserOptions* options) {
+    PathList list = { NULL, 0, 0 };
+    struct stat st;
+    if (stat(source, &st) == 0 && S_ISDIR(st.st_mode)) {
+        collect_directory(&list, source);
+        qsort(list.paths, list.count, sizeof(char*), compare_paths);
+    } else if (collect_list_file(&list, source) != 0) {
+        fprintf(stderr, " Error: Could not read file list '%s'.\n", source);
+        return -1;
+    }
+
+    BatchItem* items = (BatchItem*)safe_malloc((list.count ? list.count : 1) * sizeof(BatchItem));
+    for (int i = 0; i < list.count; i++) {
+        items[i].path = list.paths[i];
+        items[i].status = BATCH_OK;
+        items[i].bytes = 0;
+        items[i].seconds = 0;
+        items[i].error = NULL;
+    }
+
+    ParseCache* cache = cache_bytes > 0 ? parse_cache_create(cache_bytes, options) : NULL;
+    for (int i = 0; i < list.count; i++) {
+        items[i].cache = cache;
+        items[i].options = options;
+    }
+
+    double start = now_seconds();
+    ThreadPool* pool = thread_pool_create(workers);
+    for (int i = 0; i < list.count; i++) {
+        thread_pool_submit(pool, parse_item, &items[i]);
+    }
+    thread_pool_wait(pool);
+    double elapsed = now_seconds() - start;
+    thread_pool_destroy(pool);
+
+    // Reported in list order once everything is done, so output does not
+    // depend on scheduling.
+    int failed = 0;
+    size_t total_bytes = 0;
+    for (int i = 0; i < list.count; i++) {
+        BatchItem* item = &items[i];
+        total_bytes += item->bytes;
+        if (item->status == BATCH_OK) {
+            printf(" OK    %s (%zu bytes, %.3f ms)\n", item->path, item->bytes, item->seconds * 1000.0);
+        } else {
+            failed++;
+            printf(" FAIL  %s: %s\n", item->path, item->error);
+        }
+        free(item->error);
+        free(item->path);
+    }
+
+    double mb = total_bytes / (1024.0 * 1024.0);
+    printf("\n %d files, %d ok, %d failed, %.2f MB in %.3f s on %d threads",
+           list.count, list.count - failed, failed, mb, elapsed, workers);
+    if (elapsed > 0) {
+        printf(" (%.1f files/s, %.2f MB/s)", list.count / elapsed, mb / elapsed);
+    }
+    printf("\n");
+    if (cache != NULL) {
+        ParseCacheStats stats = parse_cache_stats(cache);
+        printf(" cache: %llu hits, %llu misses, %llu evictions, %.2f of %.2f MB used\n",
+               (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+               (unsigned long long)stats.evictions,
+               stats.bytes_used / (1024.0 * 1024.0), stats.budget / (1024.0 * 1024.0));
+        parse_cache_destroy(cache);
+    }
+
+    free(items);
+    free(list.paths);
+    return failed;
+}
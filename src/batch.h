@@ -0,0 +1,20 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+#include "parser.h"
+
+// Parses many documents concurrently on a work-stealing thread pool.
+// `source` is either a directory (walked recursively) or a text file that
+// lists one path per line. Prints one status line per file, then the
+// aggregate throughput. Returns the number of files that failed to read
+// or parse, or -1 if `source` itself could not be read.
+//
+// With a non-zero `cache_bytes`, results go through a parse cache of that
+// budget, so byte-identical files are only parsed once.
+//
+// Every file is parsed with `options` (NULL for the defaults); its limits
+// keep one hostile file from taking a worker's memory with it.
+int batch_run(const char* source, int workers, size_t cache_bytes, const ParserOptions* options);
+
+#endif
@@ -1,32 +1,96 @@
 #include "dom.h"
 #include "utils.h"
+#include "serialize.h"
+#include "dom_index.h"
+#include "entities.h"
+#include "scan.h"
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
-DomNode* create_element_node(const char* tag_name) {
-    DomNode* node = (DomNode*)safe_malloc(sizeof(DomNode));
-    node->type = ELEMENT_NODE;
-    node->tag_name = safe_strdup(tag_name);
-    node->text_content = NULL;
+// Open-addressed table of Attribute pointers, keyed by name. Only the
+// first attribute of a given name is entered, matching the linear scan.
+typedef struct AttributeMap {
+    unsigned int mask;
+    Attribute* slots[];
+} AttributeMap;
+
+static void init_node(DomNode* node, NodeType type, unsigned int flags) {
+    node->type = type;
+    node->flags = flags;
+    node->tag_atom = ATOM_NONE;
+    node->tag_name = NULL;
     node->attributes = NULL;
+    node->last_attribute = NULL;
+    node->attribute_count = 0;
+    node->attribute_map = NULL;
+    node->text_content = NULL;
+    node->decoded_text = NULL;
     node->parent = NULL;
     node->first_child = NULL;
+    node->last_child = NULL;
     node->next_sibling = NULL;
-    
-    return node;
+    node->child_count = 0;
+    node->source_start = 0;
+    node->source_end = 0;
+}
+
+DomNode* create_element_node(const char* tag_name) {
+    return create_element_node_n(tag_name, strlen(tag_name));
 }
 
 DomNode* create_text_node(const char* text) {
+    return create_text_node_n(text, strlen(text));
+}
+
+DomNode* create_element_node_n(const char* tag_name, size_t length) {
     DomNode* node = (DomNode*)safe_malloc(sizeof(DomNode));
-    node->type = TEXT_NODE;
-    node->tag_name = NULL;
-    node->text_content = safe_strdup(text); 
-    node->attributes = NULL;
-    node->parent = NULL;
-    node->first_child = NULL;
-    node->next_sibling = NULL;
+    init_node(node, ELEMENT_NODE, 0);
+    node->tag_atom = atom_lookup(tag_name, length);
+    node->tag_name = safe_strndup(tag_name, length);
+    return node;
+}
+
+DomNode* create_text_node_n(const char* text, size_t length) {
+    DomNode* node = (DomNode*)safe_malloc(sizeof(DomNode));
+    init_node(node, TEXT_NODE, 0);
+    node->text_content = safe_strndup(text, length);
+    return node;
+}
+
+DomDocument* dom_document_create(const char* root_name) {
+    Arena* arena = arena_create();
+    DomDocument* doc = (DomDocument*)arena_alloc(arena, sizeof(DomDocument));
+    doc->arena = arena;
+    doc->index = NULL;
+    doc->dead_bytes = 0;
+    atom_table_init(&doc->atoms, arena);
+
+    DomNode* root = &doc->root;
+    init_node(root, ELEMENT_NODE, DOM_FLAG_ARENA | DOM_FLAG_DOCUMENT);
+    root->tag_atom = atom_intern(&doc->atoms, root_name, strlen(root_name));
+    root->tag_name = (char*)atom_table_name(&doc->atoms, root->tag_atom);
+    return doc;
+}
+
+static DomNode* document_alloc_node(DomDocument* doc, NodeType type) {
+    DomNode* node = (DomNode*)arena_alloc(doc->arena, sizeof(DomNode));
+    init_node(node, type, DOM_FLAG_ARENA);
+    return node;
+}
+
+DomNode* document_create_element(DomDocument* doc, const char* tag_name, size_t length) {
+    DomNode* node = document_alloc_node(doc, ELEMENT_NODE);
+    node->tag_atom = atom_intern(&doc->atoms, tag_name, length);
+    node->tag_name = (char*)atom_table_name(&doc->atoms, node->tag_atom);
+    return node;
+}
+
+DomNode* document_create_text(DomDocument* doc, const char* text, size_t length) {
+    DomNode* node = document_alloc_node(doc, TEXT_NODE);
+    node->text_content = arena_strndup(doc->arena, text, length);
     return node;
 }
 
@@ -35,88 +99,402 @@ void add_child(DomNode* parent, DomNode* child) {
         return;
     }
     child->parent = parent;
+    child->next_sibling = NULL;
 
-    if (parent->first_child == NULL) {
+    if (parent->last_child == NULL) {
         parent->first_child = child;
     } else {
-        DomNode* current = parent->first_child;
-        while (current->next_sibling != NULL) {
-            current = current->next_sibling;
+        parent->last_child->next_sibling = child;
+    }
+    parent->last_child = child;
+    parent->child_count++;
+}
+
+static uint32_t hash_name(const char* name, size_t length) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        h = (h ^ (unsigned char)name[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Slot holding `name`, or the empty slot where it would go.
+static Attribute** map_slot(const AttributeMap* map, const char* name, size_t length) {
+    uint32_t i = hash_name(name, length) & map->mask;
+    for (;;) {
+        Attribute* attr = map->slots[i];
+        if (attr == NULL ||
+            (strncmp(attr->name, name, length) == 0 && attr->name[length] == '\0')) {
+            return (Attribute**)&map->slots[i];
         }
-        current->next_sibling = child;
+        i = (i + 1) & map->mask;
     }
 }
 
-void add_attribute(DomNode* node, const char* name, const char* value) {
-    if (node == NULL || node->type != ELEMENT_NODE || name == NULL || value == NULL) {
-        return;
+// Rebuilds the map at twice the attribute count from the attribute list.
+// Document maps come from `arena` (the old one is simply abandoned);
+// heap-built nodes own theirs.
+static void rebuild_attribute_map(DomNode* node, Arena* arena) {
+    unsigned int capacity = 16;
+    while (capacity < (unsigned int)node->attribute_count * 2) {
+        capacity *= 2;
+    }
+    size_t bytes = sizeof(AttributeMap) + capacity * sizeof(Attribute*);
+    AttributeMap* map;
+    if (arena != NULL) {
+        map = (AttributeMap*)arena_alloc(arena, bytes);
+    } else {
+        free(node->attribute_map);
+        map = (AttributeMap*)safe_malloc(bytes);
     }
+    memset(map, 0, bytes);
+    map->mask = capacity - 1;
+    for (Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+        Attribute** slot = map_slot(map, attr->name, strlen(attr->name));
+        if (*slot == NULL) {
+            *slot = attr;
+        }
+    }
+    node->attribute_map = map;
+}
 
-    Attribute* attr = (Attribute*)safe_malloc(sizeof(Attribute));
-    attr->name = safe_strdup(name);
-    attr->value = safe_strdup(value);
+static void append_attribute(DomNode* node, Attribute* attr, Arena* arena) {
     attr->next = NULL;
-    if (node->attributes == NULL) {
+    if (node->last_attribute == NULL) {
         node->attributes = attr;
     } else {
-        Attribute* current = node->attributes;
-        while (current->next != NULL) {
-            current = current->next;
+        node->last_attribute->next = attr;
+    }
+    node->last_attribute = attr;
+    node->attribute_count++;
+
+    AttributeMap* map = node->attribute_map;
+    if (map == NULL) {
+        if (node->attribute_count >= DOM_ATTRIBUTE_MAP_THRESHOLD) {
+            rebuild_attribute_map(node, arena);
+        }
+    } else if ((unsigned int)node->attribute_count * 2 > map->mask + 1) {
+        rebuild_attribute_map(node, arena);
+    } else {
+        Attribute** slot = map_slot(map, attr->name, strlen(attr->name));
+        if (*slot == NULL) {
+            *slot = attr;
         }
-        current->next = attr;
     }
 }
 
-void free_dom_tree(DomNode* root) {
+const char* dom_get_attribute(const DomNode* node, const char* name) {
+    if (name == NULL) {
+        return NULL;
+    }
+    return dom_get_attribute_n(node, name, strlen(name));
+}
+
+static Attribute* find_attribute(const DomNode* node, const char* name, size_t length) {
+    if (node == NULL || node->type != ELEMENT_NODE || name == NULL) {
+        return NULL;
+    }
+    if (node->attribute_map != NULL) {
+        return *map_slot(node->attribute_map, name, length);
+    }
+    for (Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+        if (strncmp(attr->name, name, length) == 0 && attr->name[length] == '\0') {
+            return attr;
+        }
+    }
+    return NULL;
+}
+
+const char* dom_get_attribute_n(const DomNode* node, const char* name, size_t length) {
+    Attribute* attr = find_attribute(node, name, length);
+    return attr ? attr->value : NULL;
+}
+
+// Arena of the document that owns `node`; NULL for heap-built nodes and
+// for arena nodes that are no longer attached to their document.
+static Arena* owning_arena(const DomNode* node) {
+    if (!(node->flags & DOM_FLAG_ARENA)) {
+        return NULL;
+    }
+    while (node->parent != NULL) {
+        node = node->parent;
+    }
+    return (node->flags & DOM_FLAG_DOCUMENT) ? ((const DomDocument*)node)->arena : NULL;
+}
+
+// Decoded form of `raw`: `raw` itself when it has no '&' (or an arena node
+// has nowhere to keep a copy), otherwise a copy in the arena or the heap.
+static char* decode_string(const DomNode* node, char* raw, int attribute, Arena* arena) {
+    size_t length = strlen(raw);
+    if (scan_find_byte(raw, length, '&') >= length) {
+        return raw;
+    }
+    size_t bound = ENTITY_DECODED_BOUND(length);
+    char* decoded;
+    if (!(node->flags & DOM_FLAG_ARENA)) {
+        decoded = (char*)safe_malloc(bound);
+    } else if (arena != NULL) {
+        decoded = arena_alloc_bytes(arena, bound);
+    } else {
+        return raw;
+    }
+    entity_decode(raw, length, decoded, attribute);
+    return decoded;
+}
+
+const char* dom_text(const DomNode* node) {
+    if (node == NULL || node->type != TEXT_NODE || node->text_content == NULL) {
+        return NULL;
+    }
+    if (node->decoded_text == NULL) {
+        // Filling in the cache does not change what the node says.
+        ((DomNode*)node)->decoded_text = decode_string(node, node->text_content, 0, owning_arena(node));
+    }
+    return node->decoded_text;
+}
+
+const char* dom_attribute_value(const DomNode* node, const char* name) {
+    if (name == NULL) {
+        return NULL;
+    }
+    Attribute* attr = find_attribute(node, name, strlen(name));
+    if (attr == NULL) {
+        return NULL;
+    }
+    if (attr->decoded == NULL) {
+        attr->decoded = decode_string(node, attr->value, 1, owning_arena(node));
+    }
+    return attr->decoded;
+}
+
+void dom_decode_tree(DomNode* root) {
     if (root == NULL) {
         return;
     }
-    free_dom_tree(root->first_child);
-    free_dom_tree(root->next_sibling);
-
-    if (root->type == ELEMENT_NODE) {
-        free(root->tag_name);
-        Attribute* attr = root->attributes;
-        while (attr != NULL) {
-            Attribute* next_attr = attr->next;
-            free(attr->name);
-            free(attr->value);
-            free(attr);
-            attr = next_attr;
+    Arena* arena = owning_arena(root);
+    DomNode* node = root;
+    while (node != NULL) {
+        if (node->type == TEXT_NODE) {
+            if (node->decoded_text == NULL && node->text_content != NULL) {
+                node->decoded_text = decode_string(node, node->text_content, 0, arena);
+            }
+        } else {
+            for (Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                if (attr->decoded == NULL) {
+                    attr->decoded = decode_string(node, attr->value, 1, arena);
+                }
+            }
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
         }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
     }
-    else if (root->type == TEXT_NODE) {
-        free(root->text_content);
+}
+
+static int is_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static int is_preformatted(const DomNode* node) {
+    return node->tag_atom == ATOM_PRE || node->tag_atom == ATOM_TEXTAREA;
+}
+
+size_t dom_trim_text(char* text, size_t length, WhitespaceMode mode) {
+    if (mode == WHITESPACE_KEEP) {
+        return length;
+    }
+    size_t start = scan_skip_whitespace(text, length);
+    size_t end = length;
+    while (end > start && is_whitespace(text[end - 1])) {
+        end--;
     }
 
-    free(root);
+    size_t used = 0;
+    if (mode == WHITESPACE_TRIM) {
+        used = end - start;
+        memmove(text, text + start, used);
+    } else {
+        size_t i = start;
+        while (i < end) {
+            if (is_whitespace(text[i])) {
+                text[used++] = ' ';
+                i += scan_skip_whitespace(text + i, end - i);
+            } else {
+                text[used++] = text[i++];
+            }
+        }
+    }
+    text[used] = '\0';
+    return used;
 }
 
-void print_dom_tree(DomNode* root, int indent) {
+static void normalize_children(DomNode* parent, WhitespaceMode mode) {
+    DomNode* previous = NULL;
+    DomNode* child = parent->first_child;
+    while (child != NULL) {
+        DomNode* next = child->next_sibling;
+        if (child->type == TEXT_NODE && child->text_content != NULL &&
+            dom_trim_text(child->text_content, strlen(child->text_content), mode) == 0) {
+            if (previous == NULL) {
+                parent->first_child = next;
+            } else {
+                previous->next_sibling = next;
+            }
+            if (parent->last_child == child) {
+                parent->last_child = previous;
+            }
+            parent->child_count--;
+            child->parent = NULL;
+            child->next_sibling = NULL;
+            free_dom_tree(child);
+        } else {
+            previous = child;
+        }
+        child = next;
+    }
+}
+
+void dom_normalize_whitespace(DomNode* root, WhitespaceMode mode) {
+    if (root == NULL || mode == WHITESPACE_KEEP) {
+        return;
+    }
+    if (root->type == TEXT_NODE) {
+        if (root->text_content != NULL) {
+            dom_trim_text(root->text_content, strlen(root->text_content), mode);
+        }
+        return;
+    }
+    DomNode* node = root;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE && !is_preformatted(node)) {
+            normalize_children(node, mode);
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
+        }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
+    }
+}
+
+void add_attribute(DomNode* node, const char* name, const char* value) {
+    if (name == NULL || value == NULL) {
+        return;
+    }
+    add_attribute_n(node, name, strlen(name), value, strlen(value));
+}
+
+void add_attribute_n(DomNode* node, const char* name, size_t name_length,
+                     const char* value, size_t value_length) {
+    if (node == NULL || node->type != ELEMENT_NODE || name == NULL || value == NULL) {
+        return;
+    }
+
+    Attribute* attr = (Attribute*)safe_malloc(sizeof(Attribute));
+    attr->name_atom = atom_lookup(name, name_length);
+    attr->name = safe_strndup(name, name_length);
+    attr->value = safe_strndup(value, value_length);
+    attr->decoded = NULL;
+    append_attribute(node, attr, NULL);
+}
+
+Attribute* document_add_attribute(DomDocument* doc, DomNode* node,
+                                  const char* name, size_t name_length,
+                                  const char* value, size_t value_length) {
+    if (node == NULL || node->type != ELEMENT_NODE || name == NULL || value == NULL) {
+        return NULL;
+    }
+
+    Attribute* attr = (Attribute*)arena_alloc(doc->arena, sizeof(Attribute));
+    attr->name_atom = atom_intern(&doc->atoms, name, name_length);
+    attr->name = (char*)atom_table_name(&doc->atoms, attr->name_atom);
+    attr->value = arena_strndup(doc->arena, value, value_length);
+    attr->decoded = NULL;
+    append_attribute(node, attr, doc->arena);
+    return attr;
+}
+
+void free_dom_tree(DomNode* root) {
     if (root == NULL) {
         return;
     }
-    for (int i = 0; i < indent; i++) {
-        printf("  ");
+    if (root->flags & DOM_FLAG_DOCUMENT) {
+        dom_index_free(((DomDocument*)root)->index);
+        arena_destroy(((DomDocument*)root)->arena);
+        return;
     }
+    if (root->flags & DOM_FLAG_ARENA) {
+        return;
+    }
+
+    // Walk the tree as one list: before a node is freed, its children are
+    // spliced in between it and its next sibling. Constant stack space no
+    // matter how deep or wide the tree is.
+    DomNode* node = root;
+    while (node != NULL) {
+        DomNode* child = node->first_child;
+        if (child != NULL) {
+            DomNode* last = child;
+            while (last->next_sibling != NULL) {
+                last = last->next_sibling;
+            }
+            last->next_sibling = node->next_sibling;
+            node->next_sibling = child;
+        }
+        DomNode* next = node->next_sibling;
 
-    if (root->type == ELEMENT_NODE) {
-        printf("|-<%s", root->tag_name);
-        Attribute* attr = root->attributes;
-        while (attr != NULL) {
-            printf(" %s=\"%s\"", attr->name, attr->value);
-            attr = attr->next;
+        if (node->type == ELEMENT_NODE) {
+            free(node->tag_name);
+            free(node->attribute_map);
+            Attribute* attr = node->attributes;
+            while (attr != NULL) {
+                Attribute* next_attr = attr->next;
+                if (attr->decoded != attr->value) {
+                    free(attr->decoded);
+                }
+                free(attr->name);
+                free(attr->value);
+                free(attr);
+                attr = next_attr;
+            }
         }
-        printf(">\n");
-        sleep(1);
-        DomNode* child = root->first_child;
-        while (child != NULL) {
-            print_dom_tree(child, indent + 1);
-            child = child->next_sibling;
+        else if (node->type == TEXT_NODE) {
+            if (node->decoded_text != node->text_content) {
+                free(node->decoded_text);
+            }
+            free(node->text_content);
         }
 
-    } else if (root->type == TEXT_NODE) {
-        printf("|-TEXT: %s\n", root->text_content);
+        free(node);
+        node = next;
     }
 }
 
+size_t dom_document_bytes(const DomNode* root) {
+    if (root == NULL || !(root->flags & DOM_FLAG_DOCUMENT)) {
+        return 0;
+    }
+    const DomDocument* doc = (const DomDocument*)root;
+    return sizeof(Arena) + doc->arena->bytes_reserved;
+}
+
+void print_dom_tree(DomNode* root, int indent) {
+    if (root == NULL) {
+        return;
+    }
+    // Anything already queued in stdio has to go out before our write()s.
+    fflush(stdout);
+    OutBuffer out;
+    out_init(&out, STDOUT_FILENO);
+    dom_serialize_to(&out, root, SERIALIZE_TREE, indent);
+    out_flush(&out);
+    out_free(&out);
+}
@@ -1,6 +1,10 @@
 #ifndef DOM_H
 #define DOM_H
 
+#include <stddef.h>
+#include "arena.h"
+#include "atoms.h"
+
 
 typedef enum {
     ELEMENT_NODE,
@@ -8,37 +12,143 @@ typedef enum {
 } NodeType;
 
 typedef struct Attribute {
+    Atom name_atom;
     char* name;
-    char* value;
+    char* value;               // as written in the source
+    char* decoded;             // value with character references decoded,
+                               // NULL until dom_attribute_value() needs it
     struct Attribute* next;
 } Attribute;
 
 
+// DomNode::flags
+#define DOM_FLAG_ARENA    0x1   // storage owned by a DomDocument arena
+#define DOM_FLAG_DOCUMENT 0x2   // node is the root of a DomDocument
+
 typedef struct DomNode {
     NodeType type;
+    unsigned int flags;
 
+    // In a DomDocument tag_name is the shared, interned name of tag_atom
+    // (likewise Attribute::name); it must not be modified or freed.
+    Atom tag_atom;
     char* tag_name;
     Attribute* attributes;
 
-    char* text_content;
+    Attribute* last_attribute;
+    int attribute_count;
+    // Hash of name -> first Attribute, kept once attribute_count reaches
+    // DOM_ATTRIBUTE_MAP_THRESHOLD; NULL for smaller elements.
+    struct AttributeMap* attribute_map;
+
+    char* text_content;        // as written in the source
+    char* decoded_text;        // see dom_text(); NULL until first needed
 
     struct DomNode* parent;
     struct DomNode* first_child;
+    struct DomNode* last_child;
     struct DomNode* next_sibling;
+    int child_count;
+
+    // Bytes of the parser input the node was built from: an element from
+    // its '<' to the '>' of its end tag, a text node its text. Both 0 for
+    // nodes that were not parsed.
+    size_t source_start;
+    size_t source_end;
 
 } DomNode;
 
+// Elements with at least this many attributes get an attribute_map.
+#define DOM_ATTRIBUTE_MAP_THRESHOLD 8
+
+// A document whose nodes, attributes and strings all live in one arena.
+// The root node comes first, so free_dom_tree(&doc->root) releases the
+// whole document in a single call.
+typedef struct DomDocument {
+    DomNode root;
+    Arena* arena;
+    AtomTable atoms;
+    struct DomIndex* index;    // selector lookup tables, NULL unless built
+    size_t dead_bytes;         // arena bytes (estimated) of nodes that
+                               // reparse_edit() cut out of the tree
+} DomDocument;
+
 
 DomNode* create_element_node(const char* tag_name);
 
 DomNode* create_text_node(const char* text);
 
+// Length-bounded variants for names and text that are not NUL-terminated,
+// e.g. token spans pointing into the lexer's source buffer.
+DomNode* create_element_node_n(const char* tag_name, size_t length);
+
+DomNode* create_text_node_n(const char* text, size_t length);
+
+// Appends in constant time through parent->last_child.
 void add_child(DomNode* parent, DomNode* child);
 
 void add_attribute(DomNode* node, const char* name, const char* value);
 
+void add_attribute_n(DomNode* node, const char* name, size_t name_length,
+                     const char* value, size_t value_length);
+
+// Value of the first attribute called `name`, or NULL. Linear scan for
+// small elements, a hash probe once the element has an attribute_map.
+const char* dom_get_attribute(const DomNode* node, const char* name);
+
+const char* dom_get_attribute_n(const DomNode* node, const char* name, size_t length);
+
+// Text of a text node with character references (&amp; &#x27; ...)
+// decoded, or NULL for an element. Text without '&' is returned as is;
+// anything else is decoded on first access and kept with the node, so
+// this writes to the tree the first time: call dom_decode_tree() before
+// sharing a tree between threads.
+const char* dom_text(const DomNode* node);
+
+// Decoded value of the first attribute called `name`, or NULL. Decoded
+// lazily like dom_text().
+const char* dom_attribute_value(const DomNode* node, const char* name);
+
+// Decodes every text and attribute value below `root` up front.
+void dom_decode_tree(DomNode* root);
+
+// What happens to whitespace in text: see dom_normalize_whitespace() and
+// ParserOptions.whitespace. Whitespace is ' ', '\t', '\r' and '\n'.
+typedef enum {
+    WHITESPACE_KEEP,       // text exactly as written
+    WHITESPACE_TRIM,       // strip leading and trailing whitespace; text
+                           // nodes with nothing else are dropped
+    WHITESPACE_COLLAPSE    // as TRIM, and inner runs become one space
+} WhitespaceMode;
+
+// Applies `mode` to text[0..length) in place, NUL-terminates the result
+// and returns its length.
+size_t dom_trim_text(char* text, size_t length, WhitespaceMode mode);
+
+// Applies `mode` to the text nodes below `root`, leaving the contents of
+// <pre> and <textarea> alone, and unlinks the ones left empty. Meant for
+// freshly built trees: text that was already decoded is not redone.
+void dom_normalize_whitespace(DomNode* root, WhitespaceMode mode);
+
+DomDocument* dom_document_create(const char* root_name);
+
+DomNode* document_create_element(DomDocument* doc, const char* tag_name, size_t length);
+
+DomNode* document_create_text(DomDocument* doc, const char* text, size_t length);
+
+Attribute* document_add_attribute(DomDocument* doc, DomNode* node,
+                                  const char* name, size_t name_length,
+                                  const char* value, size_t value_length);
+
+// Frees a heap-built tree node by node. For a DomDocument root it destroys
+// the arena instead; other arena-owned nodes are left to their document.
 void free_dom_tree(DomNode* root);
 
+// Bytes reserved by a document's arena (nodes, strings and atom index),
+// or 0 for a tree that was not built as a DomDocument.
+size_t dom_document_bytes(const DomNode* root);
+
+// Writes the "|-<tag>" debug listing to stdout (see serialize.h).
 void print_dom_tree(DomNode* root, int indent);
 
 #endif // DOM_H
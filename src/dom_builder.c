@@ -0,0 +1,156 @@
+#include "dom_builder.h"
+#include "utils.h"
+#include "dom_index.h"
+#include "scan.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void push_open_element(DomBuilder* builder, DomNode* node) {
+    if (builder->depth == builder->capacity) {
+        int capacity = builder->capacity ? builder->capacity * 2 : 32;
+        OpenElement* grown = (OpenElement*)realloc(builder->open_elements, capacity * sizeof(OpenElement));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        builder->open_elements = grown;
+        builder->capacity = capacity;
+    }
+    builder->open_elements[builder->depth].node = node;
+    builder->depth++;
+}
+
+static void ensure_document(DomBuilder* builder) {
+    if (builder->document == NULL) {
+        builder->document = dom_document_create("<!Doctype html>");
+        if (builder->build_index) {
+            builder->document->index = dom_index_create();
+        }
+        builder->depth = 0;
+        push_open_element(builder, &builder->document->root);
+    }
+}
+
+static void append_child(DomBuilder* builder, DomNode* child) {
+    add_child(builder->open_elements[builder->depth - 1].node, child);
+}
+
+static void on_start_element(void* user_data, const char* name, size_t length) {
+    DomBuilder* builder = (DomBuilder*)user_data;
+    ensure_document(builder);
+    DomNode* node = document_create_element(builder->document, name, length);
+    if (builder->document->index) {
+        dom_index_add_element(builder->document->index, node);
+    }
+    // The token is the name; the tag starts at the '<' before it.
+    node->source_start = builder->source_base + builder->token_start - 1;
+    append_child(builder, node);
+    push_open_element(builder, node);
+    if (node->tag_atom == ATOM_PRE || node->tag_atom == ATOM_TEXTAREA) {
+        builder->preformatted++;
+    }
+}
+
+static void on_attribute(void* user_data, const char* name, size_t name_length,
+                         const char* value, size_t value_length) {
+    DomBuilder* builder = (DomBuilder*)user_data;
+    DomNode* node = builder->open_elements[builder->depth - 1].node;
+    Attribute* attr = document_add_attribute(builder->document, node,
+                                             name, name_length, value, value_length);
+    if (builder->document->index && attr) {
+        dom_index_add_attribute(builder->document->index, node, attr);
+    }
+}
+
+static void on_text(void* user_data, const char* text, size_t length) {
+    DomBuilder* builder = (DomBuilder*)user_data;
+    ensure_document(builder);
+    int keep = builder->whitespace == WHITESPACE_KEEP || builder->preformatted > 0;
+    if (!keep && scan_skip_whitespace(text, length) == length) {
+        return;
+    }
+    DomNode* node = document_create_text(builder->document, text, length);
+    if (!keep) {
+        dom_trim_text(node->text_content, length, builder->whitespace);
+    }
+    node->source_start = builder->source_base + builder->token_start;
+    node->source_end = builder->source_base + builder->token_end;
+    append_child(builder, node);
+}
+
+static void on_end_element(void* user_data, const char* name, size_t length) {
+    (void)name;
+    (void)length;
+    DomBuilder* builder = (DomBuilder*)user_data;
+    DomNode* node = builder->open_elements[builder->depth - 1].node;
+    if (node->tag_atom == ATOM_PRE || node->tag_atom == ATOM_TEXTAREA) {
+        builder->preformatted--;
+    }
+    builder->depth--;
+    // Final for "/>" and void elements; an end tag still has its '>' to
+    // come (dom_builder_end_tag_done).
+    node->source_end = builder->source_base + builder->token_end;
+    builder->closing = node;
+}
+
+const ParserEvents dom_builder_events = {
+    on_start_element,
+    on_attribute,
+    on_text,
+    on_end_element,
+    NULL
+};
+
+void dom_builder_init(DomBuilder* builder) {
+    builder->document = NULL;
+    builder->open_elements = NULL;
+    builder->depth = 0;
+    builder->capacity = 0;
+    builder->build_index = 0;
+    builder->whitespace = WHITESPACE_KEEP;
+    builder->preformatted = 0;
+    builder->token_start = 0;
+    builder->token_end = 0;
+    builder->source_base = 0;
+    builder->closing = NULL;
+}
+
+void dom_builder_resume(DomBuilder* builder, DomDocument* document, DomNode* container) {
+    builder->document = document;
+    builder->depth = 0;
+    builder->preformatted = 0;
+    builder->closing = NULL;
+    for (DomNode* node = container; node != NULL; node = node->parent) {
+        if (node->type == ELEMENT_NODE && (node->tag_atom == ATOM_PRE || node->tag_atom == ATOM_TEXTAREA)) {
+            builder->preformatted++;
+        }
+    }
+    push_open_element(builder, container);
+}
+
+void dom_builder_end_tag_done(DomBuilder* builder) {
+    if (builder->closing != NULL) {
+        builder->closing->source_end = builder->source_base + builder->token_end;
+        builder->closing = NULL;
+    }
+}
+
+DomNode* dom_builder_take_root(DomBuilder* builder) {
+    ensure_document(builder);
+    DomNode* root = &builder->document->root;
+    builder->document = NULL;
+    builder->depth = 0;
+    builder->preformatted = 0;
+    builder->closing = NULL;
+    return root;
+}
+
+void dom_builder_free(DomBuilder* builder) {
+    if (builder->document != NULL) {
+        free_dom_tree(&builder->document->root);
+        builder->document = NULL;
+    }
+    free(builder->open_elements);
+    builder->open_elements = NULL;
+    builder->capacity = 0;
+}
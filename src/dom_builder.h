@@ -0,0 +1,49 @@
+#ifndef DOM_BUILDER_H
+#define DOM_BUILDER_H
+
+#include "dom.h"
+#include "sax.h"
+
+typedef struct {
+    DomNode* node;
+} OpenElement;
+
+// The ParserEvents consumer that turns the event stream into a
+// DomDocument. This is what parse() uses unless other events are set.
+typedef struct {
+    DomDocument* document;
+    OpenElement* open_elements; // [0] is the document root
+    int depth;
+    int capacity;
+    int build_index;            // fill a DomIndex while building
+    WhitespaceMode whitespace;  // applied to each text node as it arrives
+    int preformatted;           // open <pre>/<textarea> elements
+
+    // Input range of the token behind the current event, kept up to date
+    // by the parser; DomNode source ranges are made from it.
+    size_t token_start;
+    size_t token_end;
+    size_t source_base;         // added to source ranges, for input that
+                                // is part of a larger buffer
+    DomNode* closing;           // element whose end tag still needs its '>'
+} DomBuilder;
+
+extern const ParserEvents dom_builder_events;
+
+void dom_builder_init(DomBuilder* builder);
+
+// Builds into `document` instead of a new one: nodes are appended to
+// `container`, which is treated as open (with its <pre>/<textarea>
+// ancestors). dom_builder_take_root() hands the document back.
+void dom_builder_resume(DomBuilder* builder, DomDocument* document, DomNode* container);
+
+// Called by the parser once it has read the '>' of an end tag (the
+// current token), which is where the closed element's source range ends.
+void dom_builder_end_tag_done(DomBuilder* builder);
+
+// Hands the finished document to the caller and resets the builder.
+DomNode* dom_builder_take_root(DomBuilder* builder);
+
+void dom_builder_free(DomBuilder* builder);
+
+#endif
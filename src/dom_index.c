@@ -0,0 +1,291 @@
+#include "dom_index.h"
+#include "utils.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Keys point into the document (attribute values and interned names), so
+// they live exactly as long as the index does.
+typedef struct {
+    const char* key;        // NULL = empty slot
+    size_t length;
+    uint32_t hash;
+    DomNode** nodes;
+    int count;
+    int capacity;
+} IndexEntry;
+
+typedef struct {
+    IndexEntry* entries;
+    size_t mask;            // slot count - 1
+    size_t used;
+} IndexMap;
+
+struct DomIndex {
+    IndexMap maps[DOM_INDEX_KINDS];
+};
+
+static uint32_t hash_key(const char* key, size_t length) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        h = (h ^ (unsigned char)key[i]) * 16777619u;
+    }
+    return h;
+}
+
+static void map_init(IndexMap* map) {
+    map->mask = 63;
+    map->used = 0;
+    map->entries = (IndexEntry*)calloc(map->mask + 1, sizeof(IndexEntry));
+    if (map->entries == NULL) {
+        fprintf(stderr, "Fatal: Memory allocation failed.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void map_free(IndexMap* map) {
+    for (size_t i = 0; i <= map->mask; i++) {
+        free(map->entries[i].nodes);
+    }
+    free(map->entries);
+}
+
+static IndexEntry* map_slot(const IndexMap* map, const char* key, size_t length, uint32_t hash) {
+    size_t slot = hash & map->mask;
+    for (;;) {
+        IndexEntry* entry = &map->entries[slot];
+        if (entry->key == NULL ||
+            (entry->hash == hash && entry->length == length && memcmp(entry->key, key, length) == 0)) {
+            return entry;
+        }
+        slot = (slot + 1) & map->mask;
+    }
+}
+
+static void map_grow(IndexMap* map) {
+    IndexMap grown;
+    grown.mask = map->mask * 2 + 1;
+    grown.used = map->used;
+    grown.entries = (IndexEntry*)calloc(grown.mask + 1, sizeof(IndexEntry));
+    if (grown.entries == NULL) {
+        fprintf(stderr, "Fatal: Memory allocation failed.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i <= map->mask; i++) {
+        IndexEntry* entry = &map->entries[i];
+        if (entry->key != NULL) {
+            *map_slot(&grown, entry->key, entry->length, entry->hash) = *entry;
+        }
+    }
+    free(map->entries);
+    *map = grown;
+}
+
+static void map_add(IndexMap* map, const char* key, size_t length, DomNode* node) {
+    if ((map->used + 1) * 4 > (map->mask + 1) * 3) {
+        map_grow(map);
+    }
+    uint32_t hash = hash_key(key, length);
+    IndexEntry* entry = map_slot(map, key, length, hash);
+    if (entry->key == NULL) {
+        entry->key = key;
+        entry->length = length;
+        entry->hash = hash;
+        map->used++;
+    }
+    // Repeats within one element (class="a a") are filed once.
+    if (entry->count > 0 && entry->nodes[entry->count - 1] == node) {
+        return;
+    }
+    if (entry->count == entry->capacity) {
+        entry->capacity = entry->capacity ? entry->capacity * 2 : 4;
+        DomNode** nodes = (DomNode**)realloc(entry->nodes, entry->capacity * sizeof(DomNode*));
+        if (nodes == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        entry->nodes = nodes;
+    }
+    entry->nodes[entry->count++] = node;
+}
+
+// Position of the first node in `entry` that starts at or after `start`.
+static int lower_bound(const IndexEntry* entry, size_t start) {
+    int lo = 0;
+    int hi = entry->count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (entry->nodes[mid]->source_start < start) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void map_remove(IndexMap* map, const char* key, size_t length, DomNode* node) {
+    IndexEntry* entry = map_slot(map, key, length, hash_key(key, length));
+    if (entry->key == NULL) {
+        return;
+    }
+    // Emptied entries stay: their key still points into the document.
+    int pos = lower_bound(entry, node->source_start);
+    if (pos < entry->count && entry->nodes[pos] == node) {
+        memmove(entry->nodes + pos, entry->nodes + pos + 1, (entry->count - pos - 1) * sizeof(DomNode*));
+        entry->count--;
+    }
+}
+
+// map_add() at the node's place in document order instead of at the end.
+static void map_insert(IndexMap* map, const char* key, size_t length, DomNode* node) {
+    IndexEntry* entry = map_slot(map, key, length, hash_key(key, length));
+    if (entry->key == NULL || entry->count == 0) {
+        map_add(map, key, length, node);
+        return;
+    }
+    int pos = lower_bound(entry, node->source_start);
+    if ((pos > 0 && entry->nodes[pos - 1] == node) || (pos < entry->count && entry->nodes[pos] == node)) {
+        return;
+    }
+    map_add(map, key, length, node);    // appends; may move the entry
+    entry = map_slot(map, key, length, hash_key(key, length));
+    memmove(entry->nodes + pos + 1, entry->nodes + pos, (entry->count - 1 - pos) * sizeof(DomNode*));
+    entry->nodes[pos] = node;
+}
+
+DomIndex* dom_index_create(void) {
+    DomIndex* index = (DomIndex*)safe_malloc(sizeof(DomIndex));
+    for (int kind = 0; kind < DOM_INDEX_KINDS; kind++) {
+        map_init(&index->maps[kind]);
+    }
+    return index;
+}
+
+void dom_index_free(DomIndex* index) {
+    if (index == NULL) {
+        return;
+    }
+    for (int kind = 0; kind < DOM_INDEX_KINDS; kind++) {
+        map_free(&index->maps[kind]);
+    }
+    free(index);
+}
+
+void dom_index_add_element(DomIndex* index, DomNode* element) {
+    map_add(&index->maps[DOM_INDEX_TAG], element->tag_name, strlen(element->tag_name), element);
+}
+
+static int is_class_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+void dom_index_add_attribute(DomIndex* index, DomNode* element, const Attribute* attr) {
+    if (strcmp(attr->name, "id") == 0) {
+        map_add(&index->maps[DOM_INDEX_ID], attr->value, strlen(attr->value), element);
+    } else if (strcmp(attr->name, "class") == 0) {
+        const char* p = attr->value;
+        while (*p != '\0') {
+            while (is_class_space(*p)) p++;
+            const char* start = p;
+            while (*p != '\0' && !is_class_space(*p)) p++;
+            if (p > start) {
+                map_add(&index->maps[DOM_INDEX_CLASS], start, p - start, element);
+            }
+        }
+    }
+}
+
+void dom_build_index(DomNode* document_root) {
+    if (document_root == NULL || !(document_root->flags & DOM_FLAG_DOCUMENT)) {
+        return;
+    }
+    DomDocument* doc = (DomDocument*)document_root;
+    dom_index_free(doc->index);
+    doc->index = dom_index_create();
+
+    // Pre-order walk below the root, climbing back up through parent.
+    DomNode* node = document_root->first_child;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE) {
+            dom_index_add_element(doc->index, node);
+            for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                dom_index_add_attribute(doc->index, node, attr);
+            }
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
+        }
+        while (node != document_root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == document_root ? NULL : node->next_sibling;
+    }
+}
+
+typedef void (*KeyAction)(IndexMap* map, const char* key, size_t length, DomNode* node);
+
+// Applies `action` to every key `element` is filed under.
+static void each_key(DomIndex* index, DomNode* element, KeyAction action) {
+    action(&index->maps[DOM_INDEX_TAG], element->tag_name, strlen(element->tag_name), element);
+    for (const Attribute* attr = element->attributes; attr != NULL; attr = attr->next) {
+        if (strcmp(attr->name, "id") == 0) {
+            action(&index->maps[DOM_INDEX_ID], attr->value, strlen(attr->value), element);
+        } else if (strcmp(attr->name, "class") == 0) {
+            const char* p = attr->value;
+            while (*p != '\0') {
+                while (is_class_space(*p)) p++;
+                const char* start = p;
+                while (*p != '\0' && !is_class_space(*p)) p++;
+                if (p > start) {
+                    action(&index->maps[DOM_INDEX_CLASS], start, p - start, element);
+                }
+            }
+        }
+    }
+}
+
+// Pre-order walk of `subtree` itself and everything below it.
+static void each_element(DomIndex* index, DomNode* subtree, KeyAction action) {
+    DomNode* node = subtree;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE) {
+            each_key(index, node, action);
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
+        }
+        while (node != subtree && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == subtree ? NULL : node->next_sibling;
+    }
+}
+
+void dom_index_remove_subtree(DomIndex* index, const DomNode* subtree) {
+    each_element(index, (DomNode*)subtree, map_remove);
+}
+
+void dom_index_add_subtree(DomIndex* index, DomNode* subtree) {
+    each_element(index, subtree, map_insert);
+}
+
+const DomIndex* dom_find_index(const DomNode* node) {
+    if (node == NULL) {
+        return NULL;
+    }
+    while (node->parent != NULL) {
+        node = node->parent;
+    }
+    return (node->flags & DOM_FLAG_DOCUMENT) ? ((const DomDocument*)node)->index : NULL;
+}
+
+DomNode* const* dom_index_lookup(const DomIndex* index, DomIndexKind kind,
+                                 const char* key, size_t length, int* count) {
+    const IndexEntry* entry = map_slot(&index->maps[kind], key, length, hash_key(key, length));
+    *count = entry->key ? entry->count : 0;
+    return entry->key ? entry->nodes : NULL;
+}
@@ -0,0 +1,51 @@
+#ifndef DOM_INDEX_H
+#define DOM_INDEX_H
+
+#include <stddef.h>
+#include "dom.h"
+
+// Lookup tables from id, class name and tag name to the elements that
+// carry them, each list in document order. An index is built either while
+// parsing (ParserOptions::build_index) or afterwards with
+// dom_build_index(), and is owned by its DomDocument. It describes the
+// tree at the time it was built; rebuild it after changing the tree.
+
+typedef enum {
+    DOM_INDEX_ID,
+    DOM_INDEX_CLASS,
+    DOM_INDEX_TAG,
+    DOM_INDEX_KINDS
+} DomIndexKind;
+
+typedef struct DomIndex DomIndex;
+
+DomIndex* dom_index_create(void);
+
+void dom_index_free(DomIndex* index);
+
+// Called for every element in document order, before its attributes.
+void dom_index_add_element(DomIndex* index, DomNode* element);
+
+// Records `attr` if it is an id or class attribute of `element`.
+void dom_index_add_attribute(DomIndex* index, DomNode* element, const Attribute* attr);
+
+// (Re)builds the index of a DomDocument from its current tree.
+void dom_build_index(DomNode* document_root);
+
+// Keep an index up to date across a subtree replacement without a
+// rebuild. Both rely on the DomNode source ranges of a parsed tree, which
+// put elements in document order: remove the old subtree while its
+// ranges are still those the index was built with, and add the new one
+// once every range in the tree is current.
+void dom_index_remove_subtree(DomIndex* index, const DomNode* subtree);
+
+void dom_index_add_subtree(DomIndex* index, DomNode* subtree);
+
+// Index of the document that contains `node`, or NULL if it has none.
+const DomIndex* dom_find_index(const DomNode* node);
+
+// Elements filed under `key`, in document order; sets *count (0 if none).
+DomNode* const* dom_index_lookup(const DomIndex* index, DomIndexKind kind,
+                                 const char* key, size_t length, int* count);
+
+#endif
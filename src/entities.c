@@ -0,0 +1,171 @@
+#include "entities.h"
+#include "scan.h"
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+#include "entity_table.h"
+
+// Same hash and seed mixing as the atom table (atoms.c, gen_atoms.py).
+static uint64_t entity_hash(const char* name, size_t length) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static uint32_t entity_mix(uint64_t h, uint32_t seed) {
+    uint64_t x = h ^ (seed * 0x9E3779B97F4A7C15ULL);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (uint32_t)x;
+}
+
+// Table index of the reference `name` (without '&'), or 0.
+static int entity_lookup(const char* name, size_t length) {
+    uint64_t h = entity_hash(name, length);
+    uint32_t seed = entity_hash_seeds[(h >> 32) & (ENTITY_HASH_BUCKETS - 1)];
+    int entity = entity_hash_slots[entity_mix(h, seed) & (ENTITY_HASH_SLOTS - 1)];
+    if (entity != 0 && entity_name_lengths[entity] == length &&
+        memcmp(entity_names[entity], name, length) == 0) {
+        return entity;
+    }
+    return 0;
+}
+
+// What 0x80-0x9F stand for in a numeric reference (windows-1252); 0 where
+// the code point is kept.
+static const uint16_t c1_replacements[32] = {
+    0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+};
+
+static size_t encode_utf8(uint32_t c, char* out) {
+    if (c < 0x80) {
+        out[0] = (char)c;
+        return 1;
+    }
+    if (c < 0x800) {
+        out[0] = (char)(0xC0 | (c >> 6));
+        out[1] = (char)(0x80 | (c & 0x3F));
+        return 2;
+    }
+    if (c < 0x10000) {
+        out[0] = (char)(0xE0 | (c >> 12));
+        out[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (c & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (c >> 18));
+    out[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (c & 0x3F));
+    return 4;
+}
+
+// &#... at `p` (p[0] == '&', p[1] == '#'). Returns the bytes consumed, or
+// 0 if no digits follow.
+static size_t decode_numeric(const char* p, size_t n, char* out, size_t* written) {
+    size_t i = 2;
+    int hex = i < n && (p[i] == 'x' || p[i] == 'X');
+    if (hex) {
+        i++;
+    }
+    size_t digits_start = i;
+    uint32_t c = 0;
+    while (i < n && (hex ? isxdigit((unsigned char)p[i]) : isdigit((unsigned char)p[i]))) {
+        int digit = isdigit((unsigned char)p[i]) ? p[i] - '0' : (tolower((unsigned char)p[i]) - 'a' + 10);
+        if (c <= 0x10FFFF) {
+            c = c * (hex ? 16 : 10) + digit;
+        }
+        i++;
+    }
+    if (i == digits_start) {
+        return 0;
+    }
+    if (i < n && p[i] == ';') {
+        i++;
+    }
+
+    if (c == 0 || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+        c = 0xFFFD;
+    } else if (c >= 0x80 && c <= 0x9F && c1_replacements[c - 0x80] != 0) {
+        c = c1_replacements[c - 0x80];
+    }
+    *written = encode_utf8(c, out);
+    return i;
+}
+
+// &name at `p` (p[0] == '&'). Returns the bytes consumed, or 0 if it is
+// not a reference.
+static size_t decode_named(const char* p, size_t n, char* out, size_t* written, int attribute) {
+    size_t run = 0;
+    while (1 + run < n && run < ENTITY_MAX_NAME && isalnum((unsigned char)p[1 + run])) {
+        run++;
+    }
+    if (run == 0) {
+        return 0;
+    }
+
+    int entity = 0;
+    size_t length = 0;
+    if (1 + run < n && p[1 + run] == ';') {
+        entity = entity_lookup(p + 1, run + 1);
+        length = run + 1;
+    }
+    if (entity == 0) {
+        // Longest legacy name that prefixes the run, e.g. "&notit;" is
+        // "&not" + "it;".
+        length = run < ENTITY_MAX_LEGACY_NAME ? run : ENTITY_MAX_LEGACY_NAME;
+        for (; length > 0; length--) {
+            entity = entity_lookup(p + 1, length);
+            if (entity != 0) {
+                break;
+            }
+        }
+        if (entity == 0) {
+            return 0;
+        }
+        if (attribute && 1 + length < n && (isalnum((unsigned char)p[1 + length]) || p[1 + length] == '=')) {
+            return 0;
+        }
+    }
+    memcpy(out, entity_values[entity], entity_value_lengths[entity]);
+    *written = entity_value_lengths[entity];
+    return 1 + length;
+}
+
+size_t entity_decode(const char* text, size_t length, char* out, int attribute) {
+    size_t in = 0;
+    size_t used = 0;
+    while (in < length) {
+        size_t amp = in + scan_find_byte(text + in, length - in, '&');
+        if (amp > length) {
+            amp = length;
+        }
+        memcpy(out + used, text + in, amp - in);
+        used += amp - in;
+        in = amp;
+        if (in == length) {
+            break;
+        }
+
+        size_t written = 0;
+        size_t consumed = in + 1 < length && text[in + 1] == '#'
+            ? decode_numeric(text + in, length - in, out + used, &written)
+            : decode_named(text + in, length - in, out + used, &written, attribute);
+        if (consumed == 0) {
+            out[used++] = '&';
+            in++;
+        } else {
+            used += written;
+            in += consumed;
+        }
+    }
+    out[used] = '\0';
+    return used;
+}
@@ -0,0 +1,23 @@
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+#include <stddef.h>
+
+// HTML character references: named (&amp; &eacute; and the legacy forms
+// without ';', like &copy), decimal (&#39;) and hexadecimal (&#x27;).
+// Named references come from a generated perfect hash table
+// (tools/gen_entities.py); numeric ones follow the HTML rules for zero,
+// surrogates, out-of-range values and the windows-1252 range 0x80-0x9F.
+// Anything that is not a valid reference is copied through unchanged.
+
+// Output buffer size that is always enough for entity_decode() of
+// `length` bytes. References can expand: "&nGt;" is six bytes of UTF-8.
+#define ENTITY_DECODED_BOUND(length) ((length) + (length) / 4 + 1)
+
+// Decodes text[0..length) into `out`, which must hold
+// ENTITY_DECODED_BOUND(length) bytes, NUL-terminates it and returns the
+// decoded length. With `attribute` set, a legacy reference followed by
+// '=' or an alphanumeric is left alone, as in an attribute value.
+size_t entity_decode(const char* text, size_t length, char* out, int attribute);
+
+#endif
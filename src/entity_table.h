@@ -0,0 +1,5290 @@
+// Generated by tools/gen_entities.py. Do not edit.
+#define ENTITY_COUNT 2232
+#define ENTITY_MAX_NAME 32
+#define ENTITY_MAX_LEGACY_NAME 6
+#define ENTITY_HASH_BUCKETS 1024
+#define ENTITY_HASH_SLOTS 4096
+
+// Names include the ';' where one is required.
+static const char* const entity_names[ENTITY_COUNT] = {
+    NULL,
+    "AElig",
+    "AElig;",
+    "AMP",
+    "AMP;",
+    "Aacute",
+    "Aacute;",
+    "Abreve;",
+    "Acirc",
+    "Acirc;",
+    "Acy;",
+    "Afr;",
+    "Agrave",
+    "Agrave;",
+    "Alpha;",
+    "Amacr;",
+    "And;",
+    "Aogon;",
+    "Aopf;",
+    "ApplyFunction;",
+    "Aring",
+    "Aring;",
+    "Ascr;",
+    "Assign;",
+    "Atilde",
+    "Atilde;",
+    "Auml",
+    "Auml;",
+    "Backslash;",
+    "Barv;",
+    "Barwed;",
+    "Bcy;",
+    "Because;",
+    "Bernoullis;",
+    "Beta;",
+    "Bfr;",
+    "Bopf;",
+    "Breve;",
+    "Bscr;",
+    "Bumpeq;",
+    "CHcy;",
+    "COPY",
+    "COPY;",
+    "Cacute;",
+    "Cap;",
+    "CapitalDifferentialD;",
+    "Cayleys;",
+    "Ccaron;",
+    "Ccedil",
+    "Ccedil;",
+    "Ccirc;",
+    "Cconint;",
+    "Cdot;",
+    "Cedilla;",
+    "CenterDot;",
+    "Cfr;",
+    "Chi;",
+    "CircleDot;",
+    "CircleMinus;",
+    "CirclePlus;",
+    "CircleTimes;",
+    "ClockwiseContourIntegral;",
+    "CloseCurlyDoubleQuote;",
+    "CloseCurlyQuote;",
+    "Colon;",
+    "Colone;",
+    "Congruent;",
+    "Conint;",
+    "ContourIntegral;",
+    "Copf;",
+    "Coproduct;",
+    "CounterClockwiseContourIntegral;",
+    "Cross;",
+    "Cscr;",
+    "Cup;",
+    "CupCap;",
+    "DD;",
+    "DDotrahd;",
+    "DJcy;",
+    "DScy;",
+    "DZcy;",
+    "Dagger;",
+    "Darr;",
+    "Dashv;",
+    "Dcaron;",
+    "Dcy;",
+    "Del;",
+    "Delta;",
+    "Dfr;",
+    "DiacriticalAcute;",
+    "DiacriticalDot;",
+    "DiacriticalDoubleAcute;",
+    "DiacriticalGrave;",
+    "DiacriticalTilde;",
+    "Diamond;",
+    "DifferentialD;",
+    "Dopf;",
+    "Dot;",
+    "DotDot;",
+    "DotEqual;",
+    "DoubleContourIntegral;",
+    "DoubleDot;",
+    "DoubleDownArrow;",
+    "DoubleLeftArrow;",
+    "DoubleLeftRightArrow;",
+    "DoubleLeftTee;",
+    "DoubleLongLeftArrow;",
+    "DoubleLongLeftRightArrow;",
+    "DoubleLongRightArrow;",
+    "DoubleRightArrow;",
+    "DoubleRightTee;",
+    "DoubleUpArrow;",
+    "DoubleUpDownArrow;",
+    "DoubleVerticalBar;",
+    "DownArrow;",
+    "DownArrowBar;",
+    "DownArrowUpArrow;",
+    "DownBreve;",
+    "DownLeftRightVector;",
+    "DownLeftTeeVector;",
+    "DownLeftVector;",
+    "DownLeftVectorBar;",
+    "DownRightTeeVector;",
+    "DownRightVector;",
+    "DownRightVectorBar;",
+    "DownTee;",
+    "DownTeeArrow;",
+    "Downarrow;",
+    "Dscr;",
+    "Dstrok;",
+    "ENG;",
+    "ETH",
+    "ETH;",
+    "Eacute",
+    "Eacute;",
+    "Ecaron;",
+    "Ecirc",
+    "Ecirc;",
+    "Ecy;",
+    "Edot;",
+    "Efr;",
+    "Egrave",
+    "Egrave;",
+    "Element;",
+    "Emacr;",
+    "EmptySmallSquare;",
+    "EmptyVerySmallSquare;",
+    "Eogon;",
+    "Eopf;",
+    "Epsilon;",
+    "Equal;",
+    "EqualTilde;",
+    "Equilibrium;",
+    "Escr;",
+    "Esim;",
+    "Eta;",
+    "Euml",
+    "Euml;",
+    "Exists;",
+    "ExponentialE;",
+    "Fcy;",
+    "Ffr;",
+    "FilledSmallSquare;",
+    "FilledVerySmallSquare;",
+    "Fopf;",
+    "ForAll;",
+    "Fouriertrf;",
+    "Fscr;",
+    "GJcy;",
+    "GT",
+    "GT;",
+    "Gamma;",
+    "Gammad;",
+    "Gbreve;",
+    "Gcedil;",
+    "Gcirc;",
+    "Gcy;",
+    "Gdot;",
+    "Gfr;",
+    "Gg;",
+    "Gopf;",
+    "GreaterEqual;",
+    "GreaterEqualLess;",
+    "GreaterFullEqual;",
+    "GreaterGreater;",
+    "GreaterLess;",
+    "GreaterSlantEqual;",
+    "GreaterTilde;",
+    "Gscr;",
+    "Gt;",
+    "HARDcy;",
+    "Hacek;",
+    "Hat;",
+    "Hcirc;",
+    "Hfr;",
+    "HilbertSpace;",
+    "Hopf;",
+    "HorizontalLine;",
+    "Hscr;",
+    "Hstrok;",
+    "HumpDownHump;",
+    "HumpEqual;",
+    "IEcy;",
+    "IJlig;",
+    "IOcy;",
+    "Iacute",
+    "Iacute;",
+    "Icirc",
+    "Icirc;",
+    "Icy;",
+    "Idot;",
+    "Ifr;",
+    "Igrave",
+    "Igrave;",
+    "Im;",
+    "Imacr;",
+    "ImaginaryI;",
+    "Implies;",
+    "Int;",
+    "Integral;",
+    "Intersection;",
+    "InvisibleComma;",
+    "InvisibleTimes;",
+    "Iogon;",
+    "Iopf;",
+    "Iota;",
+    "Iscr;",
+    "Itilde;",
+    "Iukcy;",
+    "Iuml",
+    "Iuml;",
+    "Jcirc;",
+    "Jcy;",
+    "Jfr;",
+    "Jopf;",
+    "Jscr;",
+    "Jsercy;",
+    "Jukcy;",
+    "KHcy;",
+    "KJcy;",
+    "Kappa;",
+    "Kcedil;",
+    "Kcy;",
+    "Kfr;",
+    "Kopf;",
+    "Kscr;",
+    "LJcy;",
+    "LT",
+    "LT;",
+    "Lacute;",
+    "Lambda;",
+    "Lang;",
+    "Laplacetrf;",
+    "Larr;",
+    "Lcaron;",
+    "Lcedil;",
+    "Lcy;",
+    "LeftAngleBracket;",
+    "LeftArrow;",
+    "LeftArrowBar;",
+    "LeftArrowRightArrow;",
+    "LeftCeiling;",
+    "LeftDoubleBracket;",
+    "LeftDownTeeVector;",
+    "LeftDownVector;",
+    "LeftDownVectorBar;",
+    "LeftFloor;",
+    "LeftRightArrow;",
+    "LeftRightVector;",
+    "LeftTee;",
+    "LeftTeeArrow;",
+    "LeftTeeVector;",
+    "LeftTriangle;",
+    "LeftTriangleBar;",
+    "LeftTriangleEqual;",
+    "LeftUpDownVector;",
+    "LeftUpTeeVector;",
+    "LeftUpVector;",
+    "LeftUpVectorBar;",
+    "LeftVector;",
+    "LeftVectorBar;",
+    "Leftarrow;",
+    "Leftrightarrow;",
+    "LessEqualGreater;",
+    "LessFullEqual;",
+    "LessGreater;",
+    "LessLess;",
+    "LessSlantEqual;",
+    "LessTilde;",
+    "Lfr;",
+    "Ll;",
+    "Lleftarrow;",
+    "Lmidot;",
+    "LongLeftArrow;",
+    "LongLeftRightArrow;",
+    "LongRightArrow;",
+    "Longleftarrow;",
+    "Longleftrightarrow;",
+    "Longrightarrow;",
+    "Lopf;",
+    "LowerLeftArrow;",
+    "LowerRightArrow;",
+    "Lscr;",
+    "Lsh;",
+    "Lstrok;",
+    "Lt;",
+    "Map;",
+    "Mcy;",
+    "MediumSpace;",
+    "Mellintrf;",
+    "Mfr;",
+    "MinusPlus;",
+    "Mopf;",
+    "Mscr;",
+    "Mu;",
+    "NJcy;",
+    "Nacute;",
+    "Ncaron;",
+    "Ncedil;",
+    "Ncy;",
+    "NegativeMediumSpace;",
+    "NegativeThickSpace;",
+    "NegativeThinSpace;",
+    "NegativeVeryThinSpace;",
+    "NestedGreaterGreater;",
+    "NestedLessLess;",
+    "NewLine;",
+    "Nfr;",
+    "NoBreak;",
+    "NonBreakingSpace;",
+    "Nopf;",
+    "Not;",
+    "NotCongruent;",
+    "NotCupCap;",
+    "NotDoubleVerticalBar;",
+    "NotElement;",
+    "NotEqual;",
+    "NotEqualTilde;",
+    "NotExists;",
+    "NotGreater;",
+    "NotGreaterEqual;",
+    "NotGreaterFullEqual;",
+    "NotGreaterGreater;",
+    "NotGreaterLess;",
+    "NotGreaterSlantEqual;",
+    "NotGreaterTilde;",
+    "NotHumpDownHump;",
+    "NotHumpEqual;",
+    "NotLeftTriangle;",
+    "NotLeftTriangleBar;",
+    "NotLeftTriangleEqual;",
+    "NotLess;",
+    "NotLessEqual;",
+    "NotLessGreater;",
+    "NotLessLess;",
+    "NotLessSlantEqual;",
+    "NotLessTilde;",
+    "NotNestedGreaterGreater;",
+    "NotNestedLessLess;",
+    "NotPrecedes;",
+    "NotPrecedesEqual;",
+    "NotPrecedesSlantEqual;",
+    "NotReverseElement;",
+    "NotRightTriangle;",
+    "NotRightTriangleBar;",
+    "NotRightTriangleEqual;",
+    "NotSquareSubset;",
+    "NotSquareSubsetEqual;",
+    "NotSquareSuperset;",
+    "NotSquareSupersetEqual;",
+    "NotSubset;",
+    "NotSubsetEqual;",
+    "NotSucceeds;",
+    "NotSucceedsEqual;",
+    "NotSucceedsSlantEqual;",
+    "NotSucceedsTilde;",
+    "NotSuperset;",
+    "NotSupersetEqual;",
+    "NotTilde;",
+    "NotTildeEqual;",
+    "NotTildeFullEqual;",
+    "NotTildeTilde;",
+    "NotVerticalBar;",
+    "Nscr;",
+    "Ntilde",
+    "Ntilde;",
+    "Nu;",
+    "OElig;",
+    "Oacute",
+    "Oacute;",
+    "Ocirc",
+    "Ocirc;",
+    "Ocy;",
+    "Odblac;",
+    "Ofr;",
+    "Ograve",
+    "Ograve;",
+    "Omacr;",
+    "Omega;",
+    "Omicron;",
+    "Oopf;",
+    "OpenCurlyDoubleQuote;",
+    "OpenCurlyQuote;",
+    "Or;",
+    "Oscr;",
+    "Oslash",
+    "Oslash;",
+    "Otilde",
+    "Otilde;",
+    "Otimes;",
+    "Ouml",
+    "Ouml;",
+    "OverBar;",
+    "OverBrace;",
+    "OverBracket;",
+    "OverParenthesis;",
+    "PartialD;",
+    "Pcy;",
+    "Pfr;",
+    "Phi;",
+    "Pi;",
+    "PlusMinus;",
+    "Poincareplane;",
+    "Popf;",
+    "Pr;",
+    "Precedes;",
+    "PrecedesEqual;",
+    "PrecedesSlantEqual;",
+    "PrecedesTilde;",
+    "Prime;",
+    "Product;",
+    "Proportion;",
+    "Proportional;",
+    "Pscr;",
+    "Psi;",
+    "QUOT",
+    "QUOT;",
+    "Qfr;",
+    "Qopf;",
+    "Qscr;",
+    "RBarr;",
+    "REG",
+    "REG;",
+    "Racute;",
+    "Rang;",
+    "Rarr;",
+    "Rarrtl;",
+    "Rcaron;",
+    "Rcedil;",
+    "Rcy;",
+    "Re;",
+    "ReverseElement;",
+    "ReverseEquilibrium;",
+    "ReverseUpEquilibrium;",
+    "Rfr;",
+    "Rho;",
+    "RightAngleBracket;",
+    "RightArrow;",
+    "RightArrowBar;",
+    "RightArrowLeftArrow;",
+    "RightCeiling;",
+    "RightDoubleBracket;",
+    "RightDownTeeVector;",
+    "RightDownVector;",
+    "RightDownVectorBar;",
+    "RightFloor;",
+    "RightTee;",
+    "RightTeeArrow;",
+    "RightTeeVector;",
+    "RightTriangle;",
+    "RightTriangleBar;",
+    "RightTriangleEqual;",
+    "RightUpDownVector;",
+    "RightUpTeeVector;",
+    "RightUpVector;",
+    "RightUpVectorBar;",
+    "RightVector;",
+    "RightVectorBar;",
+    "Rightarrow;",
+    "Ropf;",
+    "RoundImplies;",
+    "Rrightarrow;",
+    "Rscr;",
+    "Rsh;",
+    "RuleDelayed;",
+    "SHCHcy;",
+    "SHcy;",
+    "SOFTcy;",
+    "Sacute;",
+    "Sc;",
+    "Scaron;",
+    "Scedil;",
+    "Scirc;",
+    "Scy;",
+    "Sfr;",
+    "ShortDownArrow;",
+    "ShortLeftArrow;",
+    "ShortRightArrow;",
+    "ShortUpArrow;",
+    "Sigma;",
+    "SmallCircle;",
+    "Sopf;",
+    "Sqrt;",
+    "Square;",
+    "SquareIntersection;",
+    "SquareSubset;",
+    "SquareSubsetEqual;",
+    "SquareSuperset;",
+    "SquareSupersetEqual;",
+    "SquareUnion;",
+    "Sscr;",
+    "Star;",
+    "Sub;",
+    "Subset;",
+    "SubsetEqual;",
+    "Succeeds;",
+    "SucceedsEqual;",
+    "SucceedsSlantEqual;",
+    "SucceedsTilde;",
+    "SuchThat;",
+    "Sum;",
+    "Sup;",
+    "Superset;",
+    "SupersetEqual;",
+    "Supset;",
+    "THORN",
+    "THORN;",
+    "TRADE;",
+    "TSHcy;",
+    "TScy;",
+    "Tab;",
+    "Tau;",
+    "Tcaron;",
+    "Tcedil;",
+    "Tcy;",
+    "Tfr;",
+    "Therefore;",
+    "Theta;",
+    "ThickSpace;",
+    "ThinSpace;",
+    "Tilde;",
+    "TildeEqual;",
+    "TildeFullEqual;",
+    "TildeTilde;",
+    "Topf;",
+    "TripleDot;",
+    "Tscr;",
+    "Tstrok;",
+    "Uacute",
+    "Uacute;",
+    "Uarr;",
+    "Uarrocir;",
+    "Ubrcy;",
+    "Ubreve;",
+    "Ucirc",
+    "Ucirc;",
+    "Ucy;",
+    "Udblac;",
+    "Ufr;",
+    "Ugrave",
+    "Ugrave;",
+    "Umacr;",
+    "UnderBar;",
+    "UnderBrace;",
+    "UnderBracket;",
+    "UnderParenthesis;",
+    "Union;",
+    "UnionPlus;",
+    "Uogon;",
+    "Uopf;",
+    "UpArrow;",
+    "UpArrowBar;",
+    "UpArrowDownArrow;",
+    "UpDownArrow;",
+    "UpEquilibrium;",
+    "UpTee;",
+    "UpTeeArrow;",
+    "Uparrow;",
+    "Updownarrow;",
+    "UpperLeftArrow;",
+    "UpperRightArrow;",
+    "Upsi;",
+    "Upsilon;",
+    "Uring;",
+    "Uscr;",
+    "Utilde;",
+    "Uuml",
+    "Uuml;",
+    "VDash;",
+    "Vbar;",
+    "Vcy;",
+    "Vdash;",
+    "Vdashl;",
+    "Vee;",
+    "Verbar;",
+    "Vert;",
+    "VerticalBar;",
+    "VerticalLine;",
+    "VerticalSeparator;",
+    "VerticalTilde;",
+    "VeryThinSpace;",
+    "Vfr;",
+    "Vopf;",
+    "Vscr;",
+    "Vvdash;",
+    "Wcirc;",
+    "Wedge;",
+    "Wfr;",
+    "Wopf;",
+    "Wscr;",
+    "Xfr;",
+    "Xi;",
+    "Xopf;",
+    "Xscr;",
+    "YAcy;",
+    "YIcy;",
+    "YUcy;",
+    "Yacute",
+    "Yacute;",
+    "Ycirc;",
+    "Ycy;",
+    "Yfr;",
+    "Yopf;",
+    "Yscr;",
+    "Yuml;",
+    "ZHcy;",
+    "Zacute;",
+    "Zcaron;",
+    "Zcy;",
+    "Zdot;",
+    "ZeroWidthSpace;",
+    "Zeta;",
+    "Zfr;",
+    "Zopf;",
+    "Zscr;",
+    "aacute",
+    "aacute;",
+    "abreve;",
+    "ac;",
+    "acE;",
+    "acd;",
+    "acirc",
+    "acirc;",
+    "acute",
+    "acute;",
+    "acy;",
+    "aelig",
+    "aelig;",
+    "af;",
+    "afr;",
+    "agrave",
+    "agrave;",
+    "alefsym;",
+    "aleph;",
+    "alpha;",
+    "amacr;",
+    "amalg;",
+    "amp",
+    "amp;",
+    "and;",
+    "andand;",
+    "andd;",
+    "andslope;",
+    "andv;",
+    "ang;",
+    "ange;",
+    "angle;",
+    "angmsd;",
+    "angmsdaa;",
+    "angmsdab;",
+    "angmsdac;",
+    "angmsdad;",
+    "angmsdae;",
+    "angmsdaf;",
+    "angmsdag;",
+    "angmsdah;",
+    "angrt;",
+    "angrtvb;",
+    "angrtvbd;",
+    "angsph;",
+    "angst;",
+    "angzarr;",
+    "aogon;",
+    "aopf;",
+    "ap;",
+    "apE;",
+    "apacir;",
+    "ape;",
+    "apid;",
+    "apos;",
+    "approx;",
+    "approxeq;",
+    "aring",
+    "aring;",
+    "ascr;",
+    "ast;",
+    "asymp;",
+    "asympeq;",
+    "atilde",
+    "atilde;",
+    "auml",
+    "auml;",
+    "awconint;",
+    "awint;",
+    "bNot;",
+    "backcong;",
+    "backepsilon;",
+    "backprime;",
+    "backsim;",
+    "backsimeq;",
+    "barvee;",
+    "barwed;",
+    "barwedge;",
+    "bbrk;",
+    "bbrktbrk;",
+    "bcong;",
+    "bcy;",
+    "bdquo;",
+    "becaus;",
+    "because;",
+    "bemptyv;",
+    "bepsi;",
+    "bernou;",
+    "beta;",
+    "beth;",
+    "between;",
+    "bfr;",
+    "bigcap;",
+    "bigcirc;",
+    "bigcup;",
+    "bigodot;",
+    "bigoplus;",
+    "bigotimes;",
+    "bigsqcup;",
+    "bigstar;",
+    "bigtriangledown;",
+    "bigtriangleup;",
+    "biguplus;",
+    "bigvee;",
+    "bigwedge;",
+    "bkarow;",
+    "blacklozenge;",
+    "blacksquare;",
+    "blacktriangle;",
+    "blacktriangledown;",
+    "blacktriangleleft;",
+    "blacktriangleright;",
+    "blank;",
+    "blk12;",
+    "blk14;",
+    "blk34;",
+    "block;",
+    "bne;",
+    "bnequiv;",
+    "bnot;",
+    "bopf;",
+    "bot;",
+    "bottom;",
+    "bowtie;",
+    "boxDL;",
+    "boxDR;",
+    "boxDl;",
+    "boxDr;",
+    "boxH;",
+    "boxHD;",
+    "boxHU;",
+    "boxHd;",
+    "boxHu;",
+    "boxUL;",
+    "boxUR;",
+    "boxUl;",
+    "boxUr;",
+    "boxV;",
+    "boxVH;",
+    "boxVL;",
+    "boxVR;",
+    "boxVh;",
+    "boxVl;",
+    "boxVr;",
+    "boxbox;",
+    "boxdL;",
+    "boxdR;",
+    "boxdl;",
+    "boxdr;",
+    "boxh;",
+    "boxhD;",
+    "boxhU;",
+    "boxhd;",
+    "boxhu;",
+    "boxminus;",
+    "boxplus;",
+    "boxtimes;",
+    "boxuL;",
+    "boxuR;",
+    "boxul;",
+    "boxur;",
+    "boxv;",
+    "boxvH;",
+    "boxvL;",
+    "boxvR;",
+    "boxvh;",
+    "boxvl;",
+    "boxvr;",
+    "bprime;",
+    "breve;",
+    "brvbar",
+    "brvbar;",
+    "bscr;",
+    "bsemi;",
+    "bsim;",
+    "bsime;",
+    "bsol;",
+    "bsolb;",
+    "bsolhsub;",
+    "bull;",
+    "bullet;",
+    "bump;",
+    "bumpE;",
+    "bumpe;",
+    "bumpeq;",
+    "cacute;",
+    "cap;",
+    "capand;",
+    "capbrcup;",
+    "capcap;",
+    "capcup;",
+    "capdot;",
+    "caps;",
+    "caret;",
+    "caron;",
+    "ccaps;",
+    "ccaron;",
+    "ccedil",
+    "ccedil;",
+    "ccirc;",
+    "ccups;",
+    "ccupssm;",
+    "cdot;",
+    "cedil",
+    "cedil;",
+    "cemptyv;",
+    "cent",
+    "cent;",
+    "centerdot;",
+    "cfr;",
+    "chcy;",
+    "check;",
+    "checkmark;",
+    "chi;",
+    "cir;",
+    "cirE;",
+    "circ;",
+    "circeq;",
+    "circlearrowleft;",
+    "circlearrowright;",
+    "circledR;",
+    "circledS;",
+    "circledast;",
+    "circledcirc;",
+    "circleddash;",
+    "cire;",
+    "cirfnint;",
+    "cirmid;",
+    "cirscir;",
+    "clubs;",
+    "clubsuit;",
+    "colon;",
+    "colone;",
+    "coloneq;",
+    "comma;",
+    "commat;",
+    "comp;",
+    "compfn;",
+    "complement;",
+    "complexes;",
+    "cong;",
+    "congdot;",
+    "conint;",
+    "copf;",
+    "coprod;",
+    "copy",
+    "copy;",
+    "copysr;",
+    "crarr;",
+    "cross;",
+    "cscr;",
+    "csub;",
+    "csube;",
+    "csup;",
+    "csupe;",
+    "ctdot;",
+    "cudarrl;",
+    "cudarrr;",
+    "cuepr;",
+    "cuesc;",
+    "cularr;",
+    "cularrp;",
+    "cup;",
+    "cupbrcap;",
+    "cupcap;",
+    "cupcup;",
+    "cupdot;",
+    "cupor;",
+    "cups;",
+    "curarr;",
+    "curarrm;",
+    "curlyeqprec;",
+    "curlyeqsucc;",
+    "curlyvee;",
+    "curlywedge;",
+    "curren",
+    "curren;",
+    "curvearrowleft;",
+    "curvearrowright;",
+    "cuvee;",
+    "cuwed;",
+    "cwconint;",
+    "cwint;",
+    "cylcty;",
+    "dArr;",
+    "dHar;",
+    "dagger;",
+    "daleth;",
+    "darr;",
+    "dash;",
+    "dashv;",
+    "dbkarow;",
+    "dblac;",
+    "dcaron;",
+    "dcy;",
+    "dd;",
+    "ddagger;",
+    "ddarr;",
+    "ddotseq;",
+    "deg",
+    "deg;",
+    "delta;",
+    "demptyv;",
+    "dfisht;",
+    "dfr;",
+    "dharl;",
+    "dharr;",
+    "diam;",
+    "diamond;",
+    "diamondsuit;",
+    "diams;",
+    "die;",
+    "digamma;",
+    "disin;",
+    "div;",
+    "divide",
+    "divide;",
+    "divideontimes;",
+    "divonx;",
+    "djcy;",
+    "dlcorn;",
+    "dlcrop;",
+    "dollar;",
+    "dopf;",
+    "dot;",
+    "doteq;",
+    "doteqdot;",
+    "dotminus;",
+    "dotplus;",
+    "dotsquare;",
+    "doublebarwedge;",
+    "downarrow;",
+    "downdownarrows;",
+    "downharpoonleft;",
+    "downharpoonright;",
+    "drbkarow;",
+    "drcorn;",
+    "drcrop;",
+    "dscr;",
+    "dscy;",
+    "dsol;",
+    "dstrok;",
+    "dtdot;",
+    "dtri;",
+    "dtrif;",
+    "duarr;",
+    "duhar;",
+    "dwangle;",
+    "dzcy;",
+    "dzigrarr;",
+    "eDDot;",
+    "eDot;",
+    "eacute",
+    "eacute;",
+    "easter;",
+    "ecaron;",
+    "ecir;",
+    "ecirc",
+    "ecirc;",
+    "ecolon;",
+    "ecy;",
+    "edot;",
+    "ee;",
+    "efDot;",
+    "efr;",
+    "eg;",
+    "egrave",
+    "egrave;",
+    "egs;",
+    "egsdot;",
+    "el;",
+    "elinters;",
+    "ell;",
+    "els;",
+    "elsdot;",
+    "emacr;",
+    "empty;",
+    "emptyset;",
+    "emptyv;",
+    "emsp13;",
+    "emsp14;",
+    "emsp;",
+    "eng;",
+    "ensp;",
+    "eogon;",
+    "eopf;",
+    "epar;",
+    "eparsl;",
+    "eplus;",
+    "epsi;",
+    "epsilon;",
+    "epsiv;",
+    "eqcirc;",
+    "eqcolon;",
+    "eqsim;",
+    "eqslantgtr;",
+    "eqslantless;",
+    "equals;",
+    "equest;",
+    "equiv;",
+    "equivDD;",
+    "eqvparsl;",
+    "erDot;",
+    "erarr;",
+    "escr;",
+    "esdot;",
+    "esim;",
+    "eta;",
+    "eth",
+    "eth;",
+    "euml",
+    "euml;",
+    "euro;",
+    "excl;",
+    "exist;",
+    "expectation;",
+    "exponentiale;",
+    "fallingdotseq;",
+    "fcy;",
+    "female;",
+    "ffilig;",
+    "fflig;",
+    "ffllig;",
+    "ffr;",
+    "filig;",
+    "fjlig;",
+    "flat;",
+    "fllig;",
+    "fltns;",
+    "fnof;",
+    "fopf;",
+    "forall;",
+    "fork;",
+    "forkv;",
+    "fpartint;",
+    "frac12",
+    "frac12;",
+    "frac13;",
+    "frac14",
+    "frac14;",
+    "frac15;",
+    "frac16;",
+    "frac18;",
+    "frac23;",
+    "frac25;",
+    "frac34",
+    "frac34;",
+    "frac35;",
+    "frac38;",
+    "frac45;",
+    "frac56;",
+    "frac58;",
+    "frac78;",
+    "frasl;",
+    "frown;",
+    "fscr;",
+    "gE;",
+    "gEl;",
+    "gacute;",
+    "gamma;",
+    "gammad;",
+    "gap;",
+    "gbreve;",
+    "gcirc;",
+    "gcy;",
+    "gdot;",
+    "ge;",
+    "gel;",
+    "geq;",
+    "geqq;",
+    "geqslant;",
+    "ges;",
+    "gescc;",
+    "gesdot;",
+    "gesdoto;",
+    "gesdotol;",
+    "gesl;",
+    "gesles;",
+    "gfr;",
+    "gg;",
+    "ggg;",
+    "gimel;",
+    "gjcy;",
+    "gl;",
+    "glE;",
+    "gla;",
+    "glj;",
+    "gnE;",
+    "gnap;",
+    "gnapprox;",
+    "gne;",
+    "gneq;",
+    "gneqq;",
+    "gnsim;",
+    "gopf;",
+    "grave;",
+    "gscr;",
+    "gsim;",
+    "gsime;",
+    "gsiml;",
+    "gt",
+    "gt;",
+    "gtcc;",
+    "gtcir;",
+    "gtdot;",
+    "gtlPar;",
+    "gtquest;",
+    "gtrapprox;",
+    "gtrarr;",
+    "gtrdot;",
+    "gtreqless;",
+    "gtreqqless;",
+    "gtrless;",
+    "gtrsim;",
+    "gvertneqq;",
+    "gvnE;",
+    "hArr;",
+    "hairsp;",
+    "half;",
+    "hamilt;",
+    "hardcy;",
+    "harr;",
+    "harrcir;",
+    "harrw;",
+    "hbar;",
+    "hcirc;",
+    "hearts;",
+    "heartsuit;",
+    "hellip;",
+    "hercon;",
+    "hfr;",
+    "hksearow;",
+    "hkswarow;",
+    "hoarr;",
+    "homtht;",
+    "hookleftarrow;",
+    "hookrightarrow;",
+    "hopf;",
+    "horbar;",
+    "hscr;",
+    "hslash;",
+    "hstrok;",
+    "hybull;",
+    "hyphen;",
+    "iacute",
+    "iacute;",
+    "ic;",
+    "icirc",
+    "icirc;",
+    "icy;",
+    "iecy;",
+    "iexcl",
+    "iexcl;",
+    "iff;",
+    "ifr;",
+    "igrave",
+    "igrave;",
+    "ii;",
+    "iiiint;",
+    "iiint;",
+    "iinfin;",
+    "iiota;",
+    "ijlig;",
+    "imacr;",
+    "image;",
+    "imagline;",
+    "imagpart;",
+    "imath;",
+    "imof;",
+    "imped;",
+    "in;",
+    "incare;",
+    "infin;",
+    "infintie;",
+    "inodot;",
+    "int;",
+    "intcal;",
+    "integers;",
+    "intercal;",
+    "intlarhk;",
+    "intprod;",
+    "iocy;",
+    "iogon;",
+    "iopf;",
+    "iota;",
+    "iprod;",
+    "iquest",
+    "iquest;",
+    "iscr;",
+    "isin;",
+    "isinE;",
+    "isindot;",
+    "isins;",
+    "isinsv;",
+    "isinv;",
+    "it;",
+    "itilde;",
+    "iukcy;",
+    "iuml",
+    "iuml;",
+    "jcirc;",
+    "jcy;",
+    "jfr;",
+    "jmath;",
+    "jopf;",
+    "jscr;",
+    "jsercy;",
+    "jukcy;",
+    "kappa;",
+    "kappav;",
+    "kcedil;",
+    "kcy;",
+    "kfr;",
+    "kgreen;",
+    "khcy;",
+    "kjcy;",
+    "kopf;",
+    "kscr;",
+    "lAarr;",
+    "lArr;",
+    "lAtail;",
+    "lBarr;",
+    "lE;",
+    "lEg;",
+    "lHar;",
+    "lacute;",
+    "laemptyv;",
+    "lagran;",
+    "lambda;",
+    "lang;",
+    "langd;",
+    "langle;",
+    "lap;",
+    "laquo",
+    "laquo;",
+    "larr;",
+    "larrb;",
+    "larrbfs;",
+    "larrfs;",
+    "larrhk;",
+    "larrlp;",
+    "larrpl;",
+    "larrsim;",
+    "larrtl;",
+    "lat;",
+    "latail;",
+    "late;",
+    "lates;",
+    "lbarr;",
+    "lbbrk;",
+    "lbrace;",
+    "lbrack;",
+    "lbrke;",
+    "lbrksld;",
+    "lbrkslu;",
+    "lcaron;",
+    "lcedil;",
+    "lceil;",
+    "lcub;",
+    "lcy;",
+    "ldca;",
+    "ldquo;",
+    "ldquor;",
+    "ldrdhar;",
+    "ldrushar;",
+    "ldsh;",
+    "le;",
+    "leftarrow;",
+    "leftarrowtail;",
+    "leftharpoondown;",
+    "leftharpoonup;",
+    "leftleftarrows;",
+    "leftrightarrow;",
+    "leftrightarrows;",
+    "leftrightharpoons;",
+    "leftrightsquigarrow;",
+    "leftthreetimes;",
+    "leg;",
+    "leq;",
+    "leqq;",
+    "leqslant;",
+    "les;",
+    "lescc;",
+    "lesdot;",
+    "lesdoto;",
+    "lesdotor;",
+    "lesg;",
+    "lesges;",
+    "lessapprox;",
+    "lessdot;",
+    "lesseqgtr;",
+    "lesseqqgtr;",
+    "lessgtr;",
+    "lesssim;",
+    "lfisht;",
+    "lfloor;",
+    "lfr;",
+    "lg;",
+    "lgE;",
+    "lhard;",
+    "lharu;",
+    "lharul;",
+    "lhblk;",
+    "ljcy;",
+    "ll;",
+    "llarr;",
+    "llcorner;",
+    "llhard;",
+    "lltri;",
+    "lmidot;",
+    "lmoust;",
+    "lmoustache;",
+    "lnE;",
+    "lnap;",
+    "lnapprox;",
+    "lne;",
+    "lneq;",
+    "lneqq;",
+    "lnsim;",
+    "loang;",
+    "loarr;",
+    "lobrk;",
+    "longleftarrow;",
+    "longleftrightarrow;",
+    "longmapsto;",
+    "longrightarrow;",
+    "looparrowleft;",
+    "looparrowright;",
+    "lopar;",
+    "lopf;",
+    "loplus;",
+    "lotimes;",
+    "lowast;",
+    "lowbar;",
+    "loz;",
+    "lozenge;",
+    "lozf;",
+    "lpar;",
+    "lparlt;",
+    "lrarr;",
+    "lrcorner;",
+    "lrhar;",
+    "lrhard;",
+    "lrm;",
+    "lrtri;",
+    "lsaquo;",
+    "lscr;",
+    "lsh;",
+    "lsim;",
+    "lsime;",
+    "lsimg;",
+    "lsqb;",
+    "lsquo;",
+    "lsquor;",
+    "lstrok;",
+    "lt",
+    "lt;",
+    "ltcc;",
+    "ltcir;",
+    "ltdot;",
+    "lthree;",
+    "ltimes;",
+    "ltlarr;",
+    "ltquest;",
+    "ltrPar;",
+    "ltri;",
+    "ltrie;",
+    "ltrif;",
+    "lurdshar;",
+    "luruhar;",
+    "lvertneqq;",
+    "lvnE;",
+    "mDDot;",
+    "macr",
+    "macr;",
+    "male;",
+    "malt;",
+    "maltese;",
+    "map;",
+    "mapsto;",
+    "mapstodown;",
+    "mapstoleft;",
+    "mapstoup;",
+    "marker;",
+    "mcomma;",
+    "mcy;",
+    "mdash;",
+    "measuredangle;",
+    "mfr;",
+    "mho;",
+    "micro",
+    "micro;",
+    "mid;",
+    "midast;",
+    "midcir;",
+    "middot",
+    "middot;",
+    "minus;",
+    "minusb;",
+    "minusd;",
+    "minusdu;",
+    "mlcp;",
+    "mldr;",
+    "mnplus;",
+    "models;",
+    "mopf;",
+    "mp;",
+    "mscr;",
+    "mstpos;",
+    "mu;",
+    "multimap;",
+    "mumap;",
+    "nGg;",
+    "nGt;",
+    "nGtv;",
+    "nLeftarrow;",
+    "nLeftrightarrow;",
+    "nLl;",
+    "nLt;",
+    "nLtv;",
+    "nRightarrow;",
+    "nVDash;",
+    "nVdash;",
+    "nabla;",
+    "nacute;",
+    "nang;",
+    "nap;",
+    "napE;",
+    "napid;",
+    "napos;",
+    "napprox;",
+    "natur;",
+    "natural;",
+    "naturals;",
+    "nbsp",
+    "nbsp;",
+    "nbump;",
+    "nbumpe;",
+    "ncap;",
+    "ncaron;",
+    "ncedil;",
+    "ncong;",
+    "ncongdot;",
+    "ncup;",
+    "ncy;",
+    "ndash;",
+    "ne;",
+    "neArr;",
+    "nearhk;",
+    "nearr;",
+    "nearrow;",
+    "nedot;",
+    "nequiv;",
+    "nesear;",
+    "nesim;",
+    "nexist;",
+    "nexists;",
+    "nfr;",
+    "ngE;",
+    "nge;",
+    "ngeq;",
+    "ngeqq;",
+    "ngeqslant;",
+    "nges;",
+    "ngsim;",
+    "ngt;",
+    "ngtr;",
+    "nhArr;",
+    "nharr;",
+    "nhpar;",
+    "ni;",
+    "nis;",
+    "nisd;",
+    "niv;",
+    "njcy;",
+    "nlArr;",
+    "nlE;",
+    "nlarr;",
+    "nldr;",
+    "nle;",
+    "nleftarrow;",
+    "nleftrightarrow;",
+    "nleq;",
+    "nleqq;",
+    "nleqslant;",
+    "nles;",
+    "nless;",
+    "nlsim;",
+    "nlt;",
+    "nltri;",
+    "nltrie;",
+    "nmid;",
+    "nopf;",
+    "not",
+    "not;",
+    "notin;",
+    "notinE;",
+    "notindot;",
+    "notinva;",
+    "notinvb;",
+    "notinvc;",
+    "notni;",
+    "notniva;",
+    "notnivb;",
+    "notnivc;",
+    "npar;",
+    "nparallel;",
+    "nparsl;",
+    "npart;",
+    "npolint;",
+    "npr;",
+    "nprcue;",
+    "npre;",
+    "nprec;",
+    "npreceq;",
+    "nrArr;",
+    "nrarr;",
+    "nrarrc;",
+    "nrarrw;",
+    "nrightarrow;",
+    "nrtri;",
+    "nrtrie;",
+    "nsc;",
+    "nsccue;",
+    "nsce;",
+    "nscr;",
+    "nshortmid;",
+    "nshortparallel;",
+    "nsim;",
+    "nsime;",
+    "nsimeq;",
+    "nsmid;",
+    "nspar;",
+    "nsqsube;",
+    "nsqsupe;",
+    "nsub;",
+    "nsubE;",
+    "nsube;",
+    "nsubset;",
+    "nsubseteq;",
+    "nsubseteqq;",
+    "nsucc;",
+    "nsucceq;",
+    "nsup;",
+    "nsupE;",
+    "nsupe;",
+    "nsupset;",
+    "nsupseteq;",
+    "nsupseteqq;",
+    "ntgl;",
+    "ntilde",
+    "ntilde;",
+    "ntlg;",
+    "ntriangleleft;",
+    "ntrianglelefteq;",
+    "ntriangleright;",
+    "ntrianglerighteq;",
+    "nu;",
+    "num;",
+    "numero;",
+    "numsp;",
+    "nvDash;",
+    "nvHarr;",
+    "nvap;",
+    "nvdash;",
+    "nvge;",
+    "nvgt;",
+    "nvinfin;",
+    "nvlArr;",
+    "nvle;",
+    "nvlt;",
+    "nvltrie;",
+    "nvrArr;",
+    "nvrtrie;",
+    "nvsim;",
+    "nwArr;",
+    "nwarhk;",
+    "nwarr;",
+    "nwarrow;",
+    "nwnear;",
+    "oS;",
+    "oacute",
+    "oacute;",
+    "oast;",
+    "ocir;",
+    "ocirc",
+    "ocirc;",
+    "ocy;",
+    "odash;",
+    "odblac;",
+    "odiv;",
+    "odot;",
+    "odsold;",
+    "oelig;",
+    "ofcir;",
+    "ofr;",
+    "ogon;",
+    "ograve",
+    "ograve;",
+    "ogt;",
+    "ohbar;",
+    "ohm;",
+    "oint;",
+    "olarr;",
+    "olcir;",
+    "olcross;",
+    "oline;",
+    "olt;",
+    "omacr;",
+    "omega;",
+    "omicron;",
+    "omid;",
+    "ominus;",
+    "oopf;",
+    "opar;",
+    "operp;",
+    "oplus;",
+    "or;",
+    "orarr;",
+    "ord;",
+    "order;",
+    "orderof;",
+    "ordf",
+    "ordf;",
+    "ordm",
+    "ordm;",
+    "origof;",
+    "oror;",
+    "orslope;",
+    "orv;",
+    "oscr;",
+    "oslash",
+    "oslash;",
+    "osol;",
+    "otilde",
+    "otilde;",
+    "otimes;",
+    "otimesas;",
+    "ouml",
+    "ouml;",
+    "ovbar;",
+    "par;",
+    "para",
+    "para;",
+    "parallel;",
+    "parsim;",
+    "parsl;",
+    "part;",
+    "pcy;",
+    "percnt;",
+    "period;",
+    "permil;",
+    "perp;",
+    "pertenk;",
+    "pfr;",
+    "phi;",
+    "phiv;",
+    "phmmat;",
+    "phone;",
+    "pi;",
+    "pitchfork;",
+    "piv;",
+    "planck;",
+    "planckh;",
+    "plankv;",
+    "plus;",
+    "plusacir;",
+    "plusb;",
+    "pluscir;",
+    "plusdo;",
+    "plusdu;",
+    "pluse;",
+    "plusmn",
+    "plusmn;",
+    "plussim;",
+    "plustwo;",
+    "pm;",
+    "pointint;",
+    "popf;",
+    "pound",
+    "pound;",
+    "pr;",
+    "prE;",
+    "prap;",
+    "prcue;",
+    "pre;",
+    "prec;",
+    "precapprox;",
+    "preccurlyeq;",
+    "preceq;",
+    "precnapprox;",
+    "precneqq;",
+    "precnsim;",
+    "precsim;",
+    "prime;",
+    "primes;",
+    "prnE;",
+    "prnap;",
+    "prnsim;",
+    "prod;",
+    "profalar;",
+    "profline;",
+    "profsurf;",
+    "prop;",
+    "propto;",
+    "prsim;",
+    "prurel;",
+    "pscr;",
+    "psi;",
+    "puncsp;",
+    "qfr;",
+    "qint;",
+    "qopf;",
+    "qprime;",
+    "qscr;",
+    "quaternions;",
+    "quatint;",
+    "quest;",
+    "questeq;",
+    "quot",
+    "quot;",
+    "rAarr;",
+    "rArr;",
+    "rAtail;",
+    "rBarr;",
+    "rHar;",
+    "race;",
+    "racute;",
+    "radic;",
+    "raemptyv;",
+    "rang;",
+    "rangd;",
+    "range;",
+    "rangle;",
+    "raquo",
+    "raquo;",
+    "rarr;",
+    "rarrap;",
+    "rarrb;",
+    "rarrbfs;",
+    "rarrc;",
+    "rarrfs;",
+    "rarrhk;",
+    "rarrlp;",
+    "rarrpl;",
+    "rarrsim;",
+    "rarrtl;",
+    "rarrw;",
+    "ratail;",
+    "ratio;",
+    "rationals;",
+    "rbarr;",
+    "rbbrk;",
+    "rbrace;",
+    "rbrack;",
+    "rbrke;",
+    "rbrksld;",
+    "rbrkslu;",
+    "rcaron;",
+    "rcedil;",
+    "rceil;",
+    "rcub;",
+    "rcy;",
+    "rdca;",
+    "rdldhar;",
+    "rdquo;",
+    "rdquor;",
+    "rdsh;",
+    "real;",
+    "realine;",
+    "realpart;",
+    "reals;",
+    "rect;",
+    "reg",
+    "reg;",
+    "rfisht;",
+    "rfloor;",
+    "rfr;",
+    "rhard;",
+    "rharu;",
+    "rharul;",
+    "rho;",
+    "rhov;",
+    "rightarrow;",
+    "rightarrowtail;",
+    "rightharpoondown;",
+    "rightharpoonup;",
+    "rightleftarrows;",
+    "rightleftharpoons;",
+    "rightrightarrows;",
+    "rightsquigarrow;",
+    "rightthreetimes;",
+    "ring;",
+    "risingdotseq;",
+    "rlarr;",
+    "rlhar;",
+    "rlm;",
+    "rmoust;",
+    "rmoustache;",
+    "rnmid;",
+    "roang;",
+    "roarr;",
+    "robrk;",
+    "ropar;",
+    "ropf;",
+    "roplus;",
+    "rotimes;",
+    "rpar;",
+    "rpargt;",
+    "rppolint;",
+    "rrarr;",
+    "rsaquo;",
+    "rscr;",
+    "rsh;",
+    "rsqb;",
+    "rsquo;",
+    "rsquor;",
+    "rthree;",
+    "rtimes;",
+    "rtri;",
+    "rtrie;",
+    "rtrif;",
+    "rtriltri;",
+    "ruluhar;",
+    "rx;",
+    "sacute;",
+    "sbquo;",
+    "sc;",
+    "scE;",
+    "scap;",
+    "scaron;",
+    "sccue;",
+    "sce;",
+    "scedil;",
+    "scirc;",
+    "scnE;",
+    "scnap;",
+    "scnsim;",
+    "scpolint;",
+    "scsim;",
+    "scy;",
+    "sdot;",
+    "sdotb;",
+    "sdote;",
+    "seArr;",
+    "searhk;",
+    "searr;",
+    "searrow;",
+    "sect",
+    "sect;",
+    "semi;",
+    "seswar;",
+    "setminus;",
+    "setmn;",
+    "sext;",
+    "sfr;",
+    "sfrown;",
+    "sharp;",
+    "shchcy;",
+    "shcy;",
+    "shortmid;",
+    "shortparallel;",
+    "shy",
+    "shy;",
+    "sigma;",
+    "sigmaf;",
+    "sigmav;",
+    "sim;",
+    "simdot;",
+    "sime;",
+    "simeq;",
+    "simg;",
+    "simgE;",
+    "siml;",
+    "simlE;",
+    "simne;",
+    "simplus;",
+    "simrarr;",
+    "slarr;",
+    "smallsetminus;",
+    "smashp;",
+    "smeparsl;",
+    "smid;",
+    "smile;",
+    "smt;",
+    "smte;",
+    "smtes;",
+    "softcy;",
+    "sol;",
+    "solb;",
+    "solbar;",
+    "sopf;",
+    "spades;",
+    "spadesuit;",
+    "spar;",
+    "sqcap;",
+    "sqcaps;",
+    "sqcup;",
+    "sqcups;",
+    "sqsub;",
+    "sqsube;",
+    "sqsubset;",
+    "sqsubseteq;",
+    "sqsup;",
+    "sqsupe;",
+    "sqsupset;",
+    "sqsupseteq;",
+    "squ;",
+    "square;",
+    "squarf;",
+    "squf;",
+    "srarr;",
+    "sscr;",
+    "ssetmn;",
+    "ssmile;",
+    "sstarf;",
+    "star;",
+    "starf;",
+    "straightepsilon;",
+    "straightphi;",
+    "strns;",
+    "sub;",
+    "subE;",
+    "subdot;",
+    "sube;",
+    "subedot;",
+    "submult;",
+    "subnE;",
+    "subne;",
+    "subplus;",
+    "subrarr;",
+    "subset;",
+    "subseteq;",
+    "subseteqq;",
+    "subsetneq;",
+    "subsetneqq;",
+    "subsim;",
+    "subsub;",
+    "subsup;",
+    "succ;",
+    "succapprox;",
+    "succcurlyeq;",
+    "succeq;",
+    "succnapprox;",
+    "succneqq;",
+    "succnsim;",
+    "succsim;",
+    "sum;",
+    "sung;",
+    "sup1",
+    "sup1;",
+    "sup2",
+    "sup2;",
+    "sup3",
+    "sup3;",
+    "sup;",
+    "supE;",
+    "supdot;",
+    "supdsub;",
+    "supe;",
+    "supedot;",
+    "suphsol;",
+    "suphsub;",
+    "suplarr;",
+    "supmult;",
+    "supnE;",
+    "supne;",
+    "supplus;",
+    "supset;",
+    "supseteq;",
+    "supseteqq;",
+    "supsetneq;",
+    "supsetneqq;",
+    "supsim;",
+    "supsub;",
+    "supsup;",
+    "swArr;",
+    "swarhk;",
+    "swarr;",
+    "swarrow;",
+    "swnwar;",
+    "szlig",
+    "szlig;",
+    "target;",
+    "tau;",
+    "tbrk;",
+    "tcaron;",
+    "tcedil;",
+    "tcy;",
+    "tdot;",
+    "telrec;",
+    "tfr;",
+    "there4;",
+    "therefore;",
+    "theta;",
+    "thetasym;",
+    "thetav;",
+    "thickapprox;",
+    "thicksim;",
+    "thinsp;",
+    "thkap;",
+    "thksim;",
+    "thorn",
+    "thorn;",
+    "tilde;",
+    "times",
+    "times;",
+    "timesb;",
+    "timesbar;",
+    "timesd;",
+    "tint;",
+    "toea;",
+    "top;",
+    "topbot;",
+    "topcir;",
+    "topf;",
+    "topfork;",
+    "tosa;",
+    "tprime;",
+    "trade;",
+    "triangle;",
+    "triangledown;",
+    "triangleleft;",
+    "trianglelefteq;",
+    "triangleq;",
+    "triangleright;",
+    "trianglerighteq;",
+    "tridot;",
+    "trie;",
+    "triminus;",
+    "triplus;",
+    "trisb;",
+    "tritime;",
+    "trpezium;",
+    "tscr;",
+    "tscy;",
+    "tshcy;",
+    "tstrok;",
+    "twixt;",
+    "twoheadleftarrow;",
+    "twoheadrightarrow;",
+    "uArr;",
+    "uHar;",
+    "uacute",
+    "uacute;",
+    "uarr;",
+    "ubrcy;",
+    "ubreve;",
+    "ucirc",
+    "ucirc;",
+    "ucy;",
+    "udarr;",
+    "udblac;",
+    "udhar;",
+    "ufisht;",
+    "ufr;",
+    "ugrave",
+    "ugrave;",
+    "uharl;",
+    "uharr;",
+    "uhblk;",
+    "ulcorn;",
+    "ulcorner;",
+    "ulcrop;",
+    "ultri;",
+    "umacr;",
+    "uml",
+    "uml;",
+    "uogon;",
+    "uopf;",
+    "uparrow;",
+    "updownarrow;",
+    "upharpoonleft;",
+    "upharpoonright;",
+    "uplus;",
+    "upsi;",
+    "upsih;",
+    "upsilon;",
+    "upuparrows;",
+    "urcorn;",
+    "urcorner;",
+    "urcrop;",
+    "uring;",
+    "urtri;",
+    "uscr;",
+    "utdot;",
+    "utilde;",
+    "utri;",
+    "utrif;",
+    "uuarr;",
+    "uuml",
+    "uuml;",
+    "uwangle;",
+    "vArr;",
+    "vBar;",
+    "vBarv;",
+    "vDash;",
+    "vangrt;",
+    "varepsilon;",
+    "varkappa;",
+    "varnothing;",
+    "varphi;",
+    "varpi;",
+    "varpropto;",
+    "varr;",
+    "varrho;",
+    "varsigma;",
+    "varsubsetneq;",
+    "varsubsetneqq;",
+    "varsupsetneq;",
+    "varsupsetneqq;",
+    "vartheta;",
+    "vartriangleleft;",
+    "vartriangleright;",
+    "vcy;",
+    "vdash;",
+    "vee;",
+    "veebar;",
+    "veeeq;",
+    "vellip;",
+    "verbar;",
+    "vert;",
+    "vfr;",
+    "vltri;",
+    "vnsub;",
+    "vnsup;",
+    "vopf;",
+    "vprop;",
+    "vrtri;",
+    "vscr;",
+    "vsubnE;",
+    "vsubne;",
+    "vsupnE;",
+    "vsupne;",
+    "vzigzag;",
+    "wcirc;",
+    "wedbar;",
+    "wedge;",
+    "wedgeq;",
+    "weierp;",
+    "wfr;",
+    "wopf;",
+    "wp;",
+    "wr;",
+    "wreath;",
+    "wscr;",
+    "xcap;",
+    "xcirc;",
+    "xcup;",
+    "xdtri;",
+    "xfr;",
+    "xhArr;",
+    "xharr;",
+    "xi;",
+    "xlArr;",
+    "xlarr;",
+    "xmap;",
+    "xnis;",
+    "xodot;",
+    "xopf;",
+    "xoplus;",
+    "xotime;",
+    "xrArr;",
+    "xrarr;",
+    "xscr;",
+    "xsqcup;",
+    "xuplus;",
+    "xutri;",
+    "xvee;",
+    "xwedge;",
+    "yacute",
+    "yacute;",
+    "yacy;",
+    "ycirc;",
+    "ycy;",
+    "yen",
+    "yen;",
+    "yfr;",
+    "yicy;",
+    "yopf;",
+    "yscr;",
+    "yucy;",
+    "yuml",
+    "yuml;",
+    "zacute;",
+    "zcaron;",
+    "zcy;",
+    "zdot;",
+    "zeetrf;",
+    "zeta;",
+    "zfr;",
+    "zhcy;",
+    "zigrarr;",
+    "zopf;",
+    "zscr;",
+    "zwj;",
+    "zwnj;",
+};
+
+static const unsigned char entity_name_lengths[ENTITY_COUNT] = {
+    0, 5, 6, 3, 4, 6, 7, 7, 5, 6, 4, 4,
+    6, 7, 6, 6, 4, 6, 5, 14, 5, 6, 5, 7,
+    6, 7, 4, 5, 10, 5, 7, 4, 8, 11, 5, 4,
+    5, 6, 5, 7, 5, 4, 5, 7, 4, 21, 8, 7,
+    6, 7, 6, 8, 5, 8, 10, 4, 4, 10, 12, 11,
+    12, 25, 22, 16, 6, 7, 10, 7, 16, 5, 10, 32,
+    6, 5, 4, 7, 3, 9, 5, 5, 5, 7, 5, 6,
+    7, 4, 4, 6, 4, 17, 15, 23, 17, 17, 8, 14,
+    5, 4, 7, 9, 22, 10, 16, 16, 21, 14, 20, 25,
+    21, 17, 15, 14, 18, 18, 10, 13, 17, 10, 20, 18,
+    15, 18, 19, 16, 19, 8, 13, 10, 5, 7, 4, 3,
+    4, 6, 7, 7, 5, 6, 4, 5, 4, 6, 7, 8,
+    6, 17, 21, 6, 5, 8, 6, 11, 12, 5, 5, 4,
+    4, 5, 7, 13, 4, 4, 18, 22, 5, 7, 11, 5,
+    5, 2, 3, 6, 7, 7, 7, 6, 4, 5, 4, 3,
+    5, 13, 17, 17, 15, 12, 18, 13, 5, 3, 7, 6,
+    4, 6, 4, 13, 5, 15, 5, 7, 13, 10, 5, 6,
+    5, 6, 7, 5, 6, 4, 5, 4, 6, 7, 3, 6,
+    11, 8, 4, 9, 13, 15, 15, 6, 5, 5, 5, 7,
+    6, 4, 5, 6, 4, 4, 5, 5, 7, 6, 5, 5,
+    6, 7, 4, 4, 5, 5, 5, 2, 3, 7, 7, 5,
+    11, 5, 7, 7, 4, 17, 10, 13, 20, 12, 18, 18,
+    15, 18, 10, 15, 16, 8, 13, 14, 13, 16, 18, 17,
+    16, 13, 16, 11, 14, 10, 15, 17, 14, 12, 9, 15,
+    10, 4, 3, 11, 7, 14, 19, 15, 14, 19, 15, 5,
+    15, 16, 5, 4, 7, 3, 4, 4, 12, 10, 4, 10,
+    5, 5, 3, 5, 7, 7, 7, 4, 20, 19, 18, 22,
+    21, 15, 8, 4, 8, 17, 5, 4, 13, 10, 21, 11,
+    9, 14, 10, 11, 16, 20, 18, 15, 21, 16, 16, 13,
+    16, 19, 21, 8, 13, 15, 12, 18, 13, 24, 18, 12,
+    17, 22, 18, 17, 20, 22, 16, 21, 18, 23, 10, 15,
+    12, 17, 22, 17, 12, 17, 9, 14, 18, 14, 15, 5,
+    6, 7, 3, 6, 6, 7, 5, 6, 4, 7, 4, 6,
+    7, 6, 6, 8, 5, 21, 15, 3, 5, 6, 7, 6,
+    7, 7, 4, 5, 8, 10, 12, 16, 9, 4, 4, 4,
+    3, 10, 14, 5, 3, 9, 14, 19, 14, 6, 8, 11,
+    13, 5, 4, 4, 5, 4, 5, 5, 6, 3, 4, 7,
+    5, 5, 7, 7, 7, 4, 3, 15, 19, 21, 4, 4,
+    18, 11, 14, 20, 13, 19, 19, 16, 19, 11, 9, 14,
+    15, 14, 17, 19, 18, 17, 14, 17, 12, 15, 11, 5,
+    13, 12, 5, 4, 12, 7, 5, 7, 7, 3, 7, 7,
+    6, 4, 4, 15, 15, 16, 13, 6, 12, 5, 5, 7,
+    19, 13, 18, 15, 20, 12, 5, 5, 4, 7, 12, 9,
+    14, 19, 14, 9, 4, 4, 9, 14, 7, 5, 6, 6,
+    6, 5, 4, 4, 7, 7, 4, 4, 10, 6, 11, 10,
+    6, 11, 15, 11, 5, 10, 5, 7, 6, 7, 5, 9,
+    6, 7, 5, 6, 4, 7, 4, 6, 7, 6, 9, 11,
+    13, 17, 6, 10, 6, 5, 8, 11, 17, 12, 14, 6,
+    11, 8, 12, 15, 16, 5, 8, 6, 5, 7, 4, 5,
+    6, 5, 4, 6, 7, 4, 7, 5, 12, 13, 18, 14,
+    14, 4, 5, 5, 7, 6, 6, 4, 5, 5, 4, 3,
+    5, 5, 5, 5, 5, 6, 7, 6, 4, 4, 5, 5,
+    5, 5, 7, 7, 4, 5, 15, 5, 4, 5, 5, 6,
+    7, 7, 3, 4, 4, 5, 6, 5, 6, 4, 5, 6,
+    3, 4, 6, 7, 8, 6, 6, 6, 6, 3, 4, 4,
+    7, 5, 9, 5, 4, 5, 6, 7, 9, 9, 9, 9,
+    9, 9, 9, 9, 6, 8, 9, 7, 6, 8, 6, 5,
+    3, 4, 7, 4, 5, 5, 7, 9, 5, 6, 5, 4,
+    6, 8, 6, 7, 4, 5, 9, 6, 5, 9, 12, 10,
+    8, 10, 7, 7, 9, 5, 9, 6, 4, 6, 7, 8,
+    8, 6, 7, 5, 5, 8, 4, 7, 8, 7, 8, 9,
+    10, 9, 8, 16, 14, 9, 7, 9, 7, 13, 12, 14,
+    18, 18, 19, 6, 6, 6, 6, 6, 4, 8, 5, 5,
+    4, 7, 7, 6, 6, 6, 6, 5, 6, 6, 6, 6,
+    6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 7,
+    6, 6, 6, 6, 5, 6, 6, 6, 6, 9, 8, 9,
+    6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 7,
+    6, 6, 7, 5, 6, 5, 6, 5, 6, 9, 5, 7,
+    5, 6, 6, 7, 7, 4, 7, 9, 7, 7, 7, 5,
+    6, 6, 6, 7, 6, 7, 6, 6, 8, 5, 5, 6,
+    8, 4, 5, 10, 4, 5, 6, 10, 4, 4, 5, 5,
+    7, 16, 17, 9, 9, 11, 12, 12, 5, 9, 7, 8,
+    6, 9, 6, 7, 8, 6, 7, 5, 7, 11, 10, 5,
+    8, 7, 5, 7, 4, 5, 7, 6, 6, 5, 5, 6,
+    5, 6, 6, 8, 8, 6, 6, 7, 8, 4, 9, 7,
+    7, 7, 6, 5, 7, 8, 12, 12, 9, 11, 6, 7,
+    15, 16, 6, 6, 9, 6, 7, 5, 5, 7, 7, 5,
+    5, 6, 8, 6, 7, 4, 3, 8, 6, 8, 3, 4,
+    6, 8, 7, 4, 6, 6, 5, 8, 12, 6, 4, 8,
+    6, 4, 6, 7, 14, 7, 5, 7, 7, 7, 5, 4,
+    6, 9, 9, 8, 10, 15, 10, 15, 16, 17, 9, 7,
+    7, 5, 5, 5, 7, 6, 5, 6, 6, 6, 8, 5,
+    9, 6, 5, 6, 7, 7, 7, 5, 5, 6, 7, 4,
+    5, 3, 6, 4, 3, 6, 7, 4, 7, 3, 9, 4,
+    4, 7, 6, 6, 9, 7, 7, 7, 5, 4, 5, 6,
+    5, 5, 7, 6, 5, 8, 6, 7, 8, 6, 11, 12,
+    7, 7, 6, 8, 9, 6, 6, 5, 6, 5, 4, 3,
+    4, 4, 5, 5, 5, 6, 12, 13, 14, 4, 7, 7,
+    6, 7, 4, 6, 6, 5, 6, 6, 5, 5, 7, 5,
+    6, 9, 6, 7, 7, 6, 7, 7, 7, 7, 7, 7,
+    6, 7, 7, 7, 7, 7, 7, 7, 6, 6, 5, 3,
+    4, 7, 6, 7, 4, 7, 6, 4, 5, 3, 4, 4,
+    5, 9, 4, 6, 7, 8, 9, 5, 7, 4, 3, 4,
+    6, 5, 3, 4, 4, 4, 4, 5, 9, 4, 5, 6,
+    6, 5, 6, 5, 5, 6, 6, 2, 3, 5, 6, 6,
+    7, 8, 10, 7, 7, 10, 11, 8, 7, 10, 5, 5,
+    7, 5, 7, 7, 5, 8, 6, 5, 6, 7, 10, 7,
+    7, 4, 9, 9, 6, 7, 14, 15, 5, 7, 5, 7,
+    7, 7, 7, 6, 7, 3, 5, 6, 4, 5, 5, 6,
+    4, 4, 6, 7, 3, 7, 6, 7, 6, 6, 6, 6,
+    9, 9, 6, 5, 6, 3, 7, 6, 9, 7, 4, 7,
+    9, 9, 9, 8, 5, 6, 5, 5, 6, 6, 7, 5,
+    5, 6, 8, 6, 7, 6, 3, 7, 6, 4, 5, 6,
+    4, 4, 6, 5, 5, 7, 6, 6, 7, 7, 4, 4,
+    7, 5, 5, 5, 5, 6, 5, 7, 6, 3, 4, 5,
+    7, 9, 7, 7, 5, 6, 7, 4, 5, 6, 5, 6,
+    8, 7, 7, 7, 7, 8, 7, 4, 7, 5, 6, 6,
+    6, 7, 7, 6, 8, 8, 7, 7, 6, 5, 4, 5,
+    6, 7, 8, 9, 5, 3, 10, 14, 16, 14, 15, 15,
+    16, 18, 20, 15, 4, 4, 5, 9, 4, 6, 7, 8,
+    9, 5, 7, 11, 8, 10, 11, 8, 8, 7, 7, 4,
+    3, 4, 6, 6, 7, 6, 5, 3, 6, 9, 7, 6,
+    7, 7, 11, 4, 5, 9, 4, 5, 6, 6, 6, 6,
+    6, 14, 19, 11, 15, 14, 15, 6, 5, 7, 8, 7,
+    7, 4, 8, 5, 5, 7, 6, 9, 6, 7, 4, 6,
+    7, 5, 4, 5, 6, 6, 5, 6, 7, 7, 2, 3,
+    5, 6, 6, 7, 7, 7, 8, 7, 5, 6, 6, 9,
+    8, 10, 5, 6, 4, 5, 5, 5, 8, 4, 7, 11,
+    11, 9, 7, 7, 4, 6, 14, 4, 4, 5, 6, 4,
+    7, 7, 6, 7, 6, 7, 7, 8, 5, 5, 7, 7,
+    5, 3, 5, 7, 3, 9, 6, 4, 4, 5, 11, 16,
+    4, 4, 5, 12, 7, 7, 6, 7, 5, 4, 5, 6,
+    6, 8, 6, 8, 9, 4, 5, 6, 7, 5, 7, 7,
+    6, 9, 5, 4, 6, 3, 6, 7, 6, 8, 6, 7,
+    7, 6, 7, 8, 4, 4, 4, 5, 6, 10, 5, 6,
+    4, 5, 6, 6, 6, 3, 4, 5, 4, 5, 6, 4,
+    6, 5, 4, 11, 16, 5, 6, 10, 5, 6, 6, 4,
+    6, 7, 5, 5, 3, 4, 6, 7, 9, 8, 8, 8,
+    6, 8, 8, 8, 5, 10, 7, 6, 8, 4, 7, 5,
+    6, 8, 6, 6, 7, 7, 12, 6, 7, 4, 7, 5,
+    5, 10, 15, 5, 6, 7, 6, 6, 8, 8, 5, 6,
+    6, 8, 10, 11, 6, 8, 5, 6, 6, 8, 10, 11,
+    5, 6, 7, 5, 14, 16, 15, 17, 3, 4, 7, 6,
+    7, 7, 5, 7, 5, 5, 8, 7, 5, 5, 8, 7,
+    8, 6, 6, 7, 6, 8, 7, 3, 6, 7, 5, 5,
+    5, 6, 4, 6, 7, 5, 5, 7, 6, 6, 4, 5,
+    6, 7, 4, 6, 4, 5, 6, 6, 8, 6, 4, 6,
+    6, 8, 5, 7, 5, 5, 6, 6, 3, 6, 4, 6,
+    8, 4, 5, 4, 5, 7, 5, 8, 4, 5, 6, 7,
+    5, 6, 7, 7, 9, 4, 5, 6, 4, 4, 5, 9,
+    7, 6, 5, 4, 7, 7, 7, 5, 8, 4, 4, 5,
+    7, 6, 3, 10, 4, 7, 8, 7, 5, 9, 6, 8,
+    7, 7, 6, 6, 7, 8, 8, 3, 9, 5, 5, 6,
+    3, 4, 5, 6, 4, 5, 11, 12, 7, 12, 9, 9,
+    8, 6, 7, 5, 6, 7, 5, 9, 9, 9, 5, 7,
+    6, 7, 5, 4, 7, 4, 5, 5, 7, 5, 12, 8,
+    6, 8, 4, 5, 6, 5, 7, 6, 5, 5, 7, 6,
+    9, 5, 6, 6, 7, 5, 6, 5, 7, 6, 8, 6,
+    7, 7, 7, 7, 8, 7, 6, 7, 6, 10, 6, 6,
+    7, 7, 6, 8, 8, 7, 7, 6, 5, 4, 5, 8,
+    6, 7, 5, 5, 8, 9, 6, 5, 3, 4, 7, 7,
+    4, 6, 6, 7, 4, 5, 11, 15, 17, 15, 16, 18,
+    17, 16, 16, 5, 13, 6, 6, 4, 7, 11, 6, 6,
+    6, 6, 6, 5, 7, 8, 5, 7, 9, 6, 7, 5,
+    4, 5, 6, 7, 7, 7, 5, 6, 6, 9, 8, 3,
+    7, 6, 3, 4, 5, 7, 6, 4, 7, 6, 5, 6,
+    7, 9, 6, 4, 5, 6, 6, 6, 7, 6, 8, 4,
+    5, 5, 7, 9, 6, 5, 4, 7, 6, 7, 5, 9,
+    14, 3, 4, 6, 7, 7, 4, 7, 5, 6, 5, 6,
+    5, 6, 6, 8, 8, 6, 14, 7, 9, 5, 6, 4,
+    5, 6, 7, 4, 5, 7, 5, 7, 10, 5, 6, 7,
+    6, 7, 6, 7, 9, 11, 6, 7, 9, 11, 4, 7,
+    7, 5, 6, 5, 7, 7, 7, 5, 6, 16, 12, 6,
+    4, 5, 7, 5, 8, 8, 6, 6, 8, 8, 7, 9,
+    10, 10, 11, 7, 7, 7, 5, 11, 12, 7, 12, 9,
+    9, 8, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+    7, 8, 5, 8, 8, 8, 8, 8, 6, 6, 8, 7,
+    9, 10, 10, 11, 7, 7, 7, 6, 7, 6, 8, 7,
+    5, 6, 7, 4, 5, 7, 7, 4, 5, 7, 4, 7,
+    10, 6, 9, 7, 12, 9, 7, 6, 7, 5, 6, 6,
+    5, 6, 7, 9, 7, 5, 5, 4, 7, 7, 5, 8,
+    5, 7, 6, 9, 13, 13, 15, 10, 14, 16, 7, 5,
+    9, 8, 6, 8, 9, 5, 5, 6, 7, 6, 17, 18,
+    5, 5, 6, 7, 5, 6, 7, 5, 6, 4, 6, 7,
+    6, 7, 4, 6, 7, 6, 6, 6, 7, 9, 7, 6,
+    6, 3, 4, 6, 5, 8, 12, 14, 15, 6, 5, 6,
+    8, 11, 7, 9, 7, 6, 6, 5, 6, 7, 5, 6,
+    6, 4, 5, 8, 5, 5, 6, 6, 7, 11, 9, 11,
+    7, 6, 10, 5, 7, 9, 13, 14, 13, 14, 9, 16,
+    17, 4, 6, 4, 7, 6, 7, 7, 5, 4, 6, 6,
+    6, 5, 6, 6, 5, 7, 7, 7, 7, 8, 6, 7,
+    6, 7, 7, 4, 5, 3, 3, 7, 5, 5, 6, 5,
+    6, 4, 6, 6, 3, 6, 6, 5, 5, 6, 5, 7,
+    7, 6, 6, 5, 7, 7, 6, 5, 7, 6, 7, 5,
+    6, 4, 3, 4, 4, 5, 5, 5, 5, 4, 5, 7,
+    7, 4, 5, 7, 5, 4, 5, 8, 5, 5, 4, 5,
+};
+
+// UTF-8 expansions.
+static const char* const entity_values[ENTITY_COUNT] = {
+    NULL,
+    "\303\206",
+    "\303\206",
+    "&",
+    "&",
+    "\303\201",
+    "\303\201",
+    "\304\202",
+    "\303\202",
+    "\303\202",
+    "\320\220",
+    "\360\235\224\204",
+    "\303\200",
+    "\303\200",
+    "\316\221",
+    "\304\200",
+    "\342\251\223",
+    "\304\204",
+    "\360\235\224\270",
+    "\342\201\241",
+    "\303\205",
+    "\303\205",
+    "\360\235\222\234",
+    "\342\211\224",
+    "\303\203",
+    "\303\203",
+    "\303\204",
+    "\303\204",
+    "\342\210\226",
+    "\342\253\247",
+    "\342\214\206",
+    "\320\221",
+    "\342\210\265",
+    "\342\204\254",
+    "\316\222",
+    "\360\235\224\205",
+    "\360\235\224\271",
+    "\313\230",
+    "\342\204\254",
+    "\342\211\216",
+    "\320\247",
+    "\302\251",
+    "\302\251",
+    "\304\206",
+    "\342\213\222",
+    "\342\205\205",
+    "\342\204\255",
+    "\304\214",
+    "\303\207",
+    "\303\207",
+    "\304\210",
+    "\342\210\260",
+    "\304\212",
+    "\302\270",
+    "\302\267",
+    "\342\204\255",
+    "\316\247",
+    "\342\212\231",
+    "\342\212\226",
+    "\342\212\225",
+    "\342\212\227",
+    "\342\210\262",
+    "\342\200\235",
+    "\342\200\231",
+    "\342\210\267",
+    "\342\251\264",
+    "\342\211\241",
+    "\342\210\257",
+    "\342\210\256",
+    "\342\204\202",
+    "\342\210\220",
+    "\342\210\263",
+    "\342\250\257",
+    "\360\235\222\236",
+    "\342\213\223",
+    "\342\211\215",
+    "\342\205\205",
+    "\342\244\221",
+    "\320\202",
+    "\320\205",
+    "\320\217",
+    "\342\200\241",
+    "\342\206\241",
+    "\342\253\244",
+    "\304\216",
+    "\320\224",
+    "\342\210\207",
+    "\316\224",
+    "\360\235\224\207",
+    "\302\264",
+    "\313\231",
+    "\313\235",
+    "`",
+    "\313\234",
+    "\342\213\204",
+    "\342\205\206",
+    "\360\235\224\273",
+    "\302\250",
+    "\342\203\234",
+    "\342\211\220",
+    "\342\210\257",
+    "\302\250",
+    "\342\207\223",
+    "\342\207\220",
+    "\342\207\224",
+    "\342\253\244",
+    "\342\237\270",
+    "\342\237\272",
+    "\342\237\271",
+    "\342\207\222",
+    "\342\212\250",
+    "\342\207\221",
+    "\342\207\225",
+    "\342\210\245",
+    "\342\206\223",
+    "\342\244\223",
+    "\342\207\265",
+    "\314\221",
+    "\342\245\220",
+    "\342\245\236",
+    "\342\206\275",
+    "\342\245\226",
+    "\342\245\237",
+    "\342\207\201",
+    "\342\245\227",
+    "\342\212\244",
+    "\342\206\247",
+    "\342\207\223",
+    "\360\235\222\237",
+    "\304\220",
+    "\305\212",
+    "\303\220",
+    "\303\220",
+    "\303\211",
+    "\303\211",
+    "\304\232",
+    "\303\212",
+    "\303\212",
+    "\320\255",
+    "\304\226",
+    "\360\235\224\210",
+    "\303\210",
+    "\303\210",
+    "\342\210\210",
+    "\304\222",
+    "\342\227\273",
+    "\342\226\253",
+    "\304\230",
+    "\360\235\224\274",
+    "\316\225",
+    "\342\251\265",
+    "\342\211\202",
+    "\342\207\214",
+    "\342\204\260",
+    "\342\251\263",
+    "\316\227",
+    "\303\213",
+    "\303\213",
+    "\342\210\203",
+    "\342\205\207",
+    "\320\244",
+    "\360\235\224\211",
+    "\342\227\274",
+    "\342\226\252",
+    "\360\235\224\275",
+    "\342\210\200",
+    "\342\204\261",
+    "\342\204\261",
+    "\320\203",
+    ">",
+    ">",
+    "\316\223",
+    "\317\234",
+    "\304\236",
+    "\304\242",
+    "\304\234",
+    "\320\223",
+    "\304\240",
+    "\360\235\224\212",
+    "\342\213\231",
+    "\360\235\224\276",
+    "\342\211\245",
+    "\342\213\233",
+    "\342\211\247",
+    "\342\252\242",
+    "\342\211\267",
+    "\342\251\276",
+    "\342\211\263",
+    "\360\235\222\242",
+    "\342\211\253",
+    "\320\252",
+    "\313\207",
+    "^",
+    "\304\244",
+    "\342\204\214",
+    "\342\204\213",
+    "\342\204\215",
+    "\342\224\200",
+    "\342\204\213",
+    "\304\246",
+    "\342\211\216",
+    "\342\211\217",
+    "\320\225",
+    "\304\262",
+    "\320\201",
+    "\303\215",
+    "\303\215",
+    "\303\216",
+    "\303\216",
+    "\320\230",
+    "\304\260",
+    "\342\204\221",
+    "\303\214",
+    "\303\214",
+    "\342\204\221",
+    "\304\252",
+    "\342\205\210",
+    "\342\207\222",
+    "\342\210\254",
+    "\342\210\253",
+    "\342\213\202",
+    "\342\201\243",
+    "\342\201\242",
+    "\304\256",
+    "\360\235\225\200",
+    "\316\231",
+    "\342\204\220",
+    "\304\250",
+    "\320\206",
+    "\303\217",
+    "\303\217",
+    "\304\264",
+    "\320\231",
+    "\360\235\224\215",
+    "\360\235\225\201",
+    "\360\235\222\245",
+    "\320\210",
+    "\320\204",
+    "\320\245",
+    "\320\214",
+    "\316\232",
+    "\304\266",
+    "\320\232",
+    "\360\235\224\216",
+    "\360\235\225\202",
+    "\360\235\222\246",
+    "\320\211",
+    "<",
+    "<",
+    "\304\271",
+    "\316\233",
+    "\342\237\252",
+    "\342\204\222",
+    "\342\206\236",
+    "\304\275",
+    "\304\273",
+    "\320\233",
+    "\342\237\250",
+    "\342\206\220",
+    "\342\207\244",
+    "\342\207\206",
+    "\342\214\210",
+    "\342\237\246",
+    "\342\245\241",
+    "\342\207\203",
+    "\342\245\231",
+    "\342\214\212",
+    "\342\206\224",
+    "\342\245\216",
+    "\342\212\243",
+    "\342\206\244",
+    "\342\245\232",
+    "\342\212\262",
+    "\342\247\217",
+    "\342\212\264",
+    "\342\245\221",
+    "\342\245\240",
+    "\342\206\277",
+    "\342\245\230",
+    "\342\206\274",
+    "\342\245\222",
+    "\342\207\220",
+    "\342\207\224",
+    "\342\213\232",
+    "\342\211\246",
+    "\342\211\266",
+    "\342\252\241",
+    "\342\251\275",
+    "\342\211\262",
+    "\360\235\224\217",
+    "\342\213\230",
+    "\342\207\232",
+    "\304\277",
+    "\342\237\265",
+    "\342\237\267",
+    "\342\237\266",
+    "\342\237\270",
+    "\342\237\272",
+    "\342\237\271",
+    "\360\235\225\203",
+    "\342\206\231",
+    "\342\206\230",
+    "\342\204\222",
+    "\342\206\260",
+    "\305\201",
+    "\342\211\252",
+    "\342\244\205",
+    "\320\234",
+    "\342\201\237",
+    "\342\204\263",
+    "\360\235\224\220",
+    "\342\210\223",
+    "\360\235\225\204",
+    "\342\204\263",
+    "\316\234",
+    "\320\212",
+    "\305\203",
+    "\305\207",
+    "\305\205",
+    "\320\235",
+    "\342\200\213",
+    "\342\200\213",
+    "\342\200\213",
+    "\342\200\213",
+    "\342\211\253",
+    "\342\211\252",
+    "\012",
+    "\360\235\224\221",
+    "\342\201\240",
+    "\302\240",
+    "\342\204\225",
+    "\342\253\254",
+    "\342\211\242",
+    "\342\211\255",
+    "\342\210\246",
+    "\342\210\211",
+    "\342\211\240",
+    "\342\211\202\314\270",
+    "\342\210\204",
+    "\342\211\257",
+    "\342\211\261",
+    "\342\211\247\314\270",
+    "\342\211\253\314\270",
+    "\342\211\271",
+    "\342\251\276\314\270",
+    "\342\211\265",
+    "\342\211\216\314\270",
+    "\342\211\217\314\270",
+    "\342\213\252",
+    "\342\247\217\314\270",
+    "\342\213\254",
+    "\342\211\256",
+    "\342\211\260",
+    "\342\211\270",
+    "\342\211\252\314\270",
+    "\342\251\275\314\270",
+    "\342\211\264",
+    "\342\252\242\314\270",
+    "\342\252\241\314\270",
+    "\342\212\200",
+    "\342\252\257\314\270",
+    "\342\213\240",
+    "\342\210\214",
+    "\342\213\253",
+    "\342\247\220\314\270",
+    "\342\213\255",
+    "\342\212\217\314\270",
+    "\342\213\242",
+    "\342\212\220\314\270",
+    "\342\213\243",
+    "\342\212\202\342\203\222",
+    "\342\212\210",
+    "\342\212\201",
+    "\342\252\260\314\270",
+    "\342\213\241",
+    "\342\211\277\314\270",
+    "\342\212\203\342\203\222",
+    "\342\212\211",
+    "\342\211\201",
+    "\342\211\204",
+    "\342\211\207",
+    "\342\211\211",
+    "\342\210\244",
+    "\360\235\222\251",
+    "\303\221",
+    "\303\221",
+    "\316\235",
+    "\305\222",
+    "\303\223",
+    "\303\223",
+    "\303\224",
+    "\303\224",
+    "\320\236",
+    "\305\220",
+    "\360\235\224\222",
+    "\303\222",
+    "\303\222",
+    "\305\214",
+    "\316\251",
+    "\316\237",
+    "\360\235\225\206",
+    "\342\200\234",
+    "\342\200\230",
+    "\342\251\224",
+    "\360\235\222\252",
+    "\303\230",
+    "\303\230",
+    "\303\225",
+    "\303\225",
+    "\342\250\267",
+    "\303\226",
+    "\303\226",
+    "\342\200\276",
+    "\342\217\236",
+    "\342\216\264",
+    "\342\217\234",
+    "\342\210\202",
+    "\320\237",
+    "\360\235\224\223",
+    "\316\246",
+    "\316\240",
+    "\302\261",
+    "\342\204\214",
+    "\342\204\231",
+    "\342\252\273",
+    "\342\211\272",
+    "\342\252\257",
+    "\342\211\274",
+    "\342\211\276",
+    "\342\200\263",
+    "\342\210\217",
+    "\342\210\267",
+    "\342\210\235",
+    "\360\235\222\253",
+    "\316\250",
+    "\042",
+    "\042",
+    "\360\235\224\224",
+    "\342\204\232",
+    "\360\235\222\254",
+    "\342\244\220",
+    "\302\256",
+    "\302\256",
+    "\305\224",
+    "\342\237\253",
+    "\342\206\240",
+    "\342\244\226",
+    "\305\230",
+    "\305\226",
+    "\320\240",
+    "\342\204\234",
+    "\342\210\213",
+    "\342\207\213",
+    "\342\245\257",
+    "\342\204\234",
+    "\316\241",
+    "\342\237\251",
+    "\342\206\222",
+    "\342\207\245",
+    "\342\207\204",
+    "\342\214\211",
+    "\342\237\247",
+    "\342\245\235",
+    "\342\207\202",
+    "\342\245\225",
+    "\342\214\213",
+    "\342\212\242",
+    "\342\206\246",
+    "\342\245\233",
+    "\342\212\263",
+    "\342\247\220",
+    "\342\212\265",
+    "\342\245\217",
+    "\342\245\234",
+    "\342\206\276",
+    "\342\245\224",
+    "\342\207\200",
+    "\342\245\223",
+    "\342\207\222",
+    "\342\204\235",
+    "\342\245\260",
+    "\342\207\233",
+    "\342\204\233",
+    "\342\206\261",
+    "\342\247\264",
+    "\320\251",
+    "\320\250",
+    "\320\254",
+    "\305\232",
+    "\342\252\274",
+    "\305\240",
+    "\305\236",
+    "\305\234",
+    "\320\241",
+    "\360\235\224\226",
+    "\342\206\223",
+    "\342\206\220",
+    "\342\206\222",
+    "\342\206\221",
+    "\316\243",
+    "\342\210\230",
+    "\360\235\225\212",
+    "\342\210\232",
+    "\342\226\241",
+    "\342\212\223",
+    "\342\212\217",
+    "\342\212\221",
+    "\342\212\220",
+    "\342\212\222",
+    "\342\212\224",
+    "\360\235\222\256",
+    "\342\213\206",
+    "\342\213\220",
+    "\342\213\220",
+    "\342\212\206",
+    "\342\211\273",
+    "\342\252\260",
+    "\342\211\275",
+    "\342\211\277",
+    "\342\210\213",
+    "\342\210\221",
+    "\342\213\221",
+    "\342\212\203",
+    "\342\212\207",
+    "\342\213\221",
+    "\303\236",
+    "\303\236",
+    "\342\204\242",
+    "\320\213",
+    "\320\246",
+    "\011",
+    "\316\244",
+    "\305\244",
+    "\305\242",
+    "\320\242",
+    "\360\235\224\227",
+    "\342\210\264",
+    "\316\230",
+    "\342\201\237\342\200\212",
+    "\342\200\211",
+    "\342\210\274",
+    "\342\211\203",
+    "\342\211\205",
+    "\342\211\210",
+    "\360\235\225\213",
+    "\342\203\233",
+    "\360\235\222\257",
+    "\305\246",
+    "\303\232",
+    "\303\232",
+    "\342\206\237",
+    "\342\245\211",
+    "\320\216",
+    "\305\254",
+    "\303\233",
+    "\303\233",
+    "\320\243",
+    "\305\260",
+    "\360\235\224\230",
+    "\303\231",
+    "\303\231",
+    "\305\252",
+    "_",
+    "\342\217\237",
+    "\342\216\265",
+    "\342\217\235",
+    "\342\213\203",
+    "\342\212\216",
+    "\305\262",
+    "\360\235\225\214",
+    "\342\206\221",
+    "\342\244\222",
+    "\342\207\205",
+    "\342\206\225",
+    "\342\245\256",
+    "\342\212\245",
+    "\342\206\245",
+    "\342\207\221",
+    "\342\207\225",
+    "\342\206\226",
+    "\342\206\227",
+    "\317\222",
+    "\316\245",
+    "\305\256",
+    "\360\235\222\260",
+    "\305\250",
+    "\303\234",
+    "\303\234",
+    "\342\212\253",
+    "\342\253\253",
+    "\320\222",
+    "\342\212\251",
+    "\342\253\246",
+    "\342\213\201",
+    "\342\200\226",
+    "\342\200\226",
+    "\342\210\243",
+    "|",
+    "\342\235\230",
+    "\342\211\200",
+    "\342\200\212",
+    "\360\235\224\231",
+    "\360\235\225\215",
+    "\360\235\222\261",
+    "\342\212\252",
+    "\305\264",
+    "\342\213\200",
+    "\360\235\224\232",
+    "\360\235\225\216",
+    "\360\235\222\262",
+    "\360\235\224\233",
+    "\316\236",
+    "\360\235\225\217",
+    "\360\235\222\263",
+    "\320\257",
+    "\320\207",
+    "\320\256",
+    "\303\235",
+    "\303\235",
+    "\305\266",
+    "\320\253",
+    "\360\235\224\234",
+    "\360\235\225\220",
+    "\360\235\222\264",
+    "\305\270",
+    "\320\226",
+    "\305\271",
+    "\305\275",
+    "\320\227",
+    "\305\273",
+    "\342\200\213",
+    "\316\226",
+    "\342\204\250",
+    "\342\204\244",
+    "\360\235\222\265",
+    "\303\241",
+    "\303\241",
+    "\304\203",
+    "\342\210\276",
+    "\342\210\276\314\263",
+    "\342\210\277",
+    "\303\242",
+    "\303\242",
+    "\302\264",
+    "\302\264",
+    "\320\260",
+    "\303\246",
+    "\303\246",
+    "\342\201\241",
+    "\360\235\224\236",
+    "\303\240",
+    "\303\240",
+    "\342\204\265",
+    "\342\204\265",
+    "\316\261",
+    "\304\201",
+    "\342\250\277",
+    "&",
+    "&",
+    "\342\210\247",
+    "\342\251\225",
+    "\342\251\234",
+    "\342\251\230",
+    "\342\251\232",
+    "\342\210\240",
+    "\342\246\244",
+    "\342\210\240",
+    "\342\210\241",
+    "\342\246\250",
+    "\342\246\251",
+    "\342\246\252",
+    "\342\246\253",
+    "\342\246\254",
+    "\342\246\255",
+    "\342\246\256",
+    "\342\246\257",
+    "\342\210\237",
+    "\342\212\276",
+    "\342\246\235",
+    "\342\210\242",
+    "\303\205",
+    "\342\215\274",
+    "\304\205",
+    "\360\235\225\222",
+    "\342\211\210",
+    "\342\251\260",
+    "\342\251\257",
+    "\342\211\212",
+    "\342\211\213",
+    "'",
+    "\342\211\210",
+    "\342\211\212",
+    "\303\245",
+    "\303\245",
+    "\360\235\222\266",
+    "*",
+    "\342\211\210",
+    "\342\211\215",
+    "\303\243",
+    "\303\243",
+    "\303\244",
+    "\303\244",
+    "\342\210\263",
+    "\342\250\221",
+    "\342\253\255",
+    "\342\211\214",
+    "\317\266",
+    "\342\200\265",
+    "\342\210\275",
+    "\342\213\215",
+    "\342\212\275",
+    "\342\214\205",
+    "\342\214\205",
+    "\342\216\265",
+    "\342\216\266",
+    "\342\211\214",
+    "\320\261",
+    "\342\200\236",
+    "\342\210\265",
+    "\342\210\265",
+    "\342\246\260",
+    "\317\266",
+    "\342\204\254",
+    "\316\262",
+    "\342\204\266",
+    "\342\211\254",
+    "\360\235\224\237",
+    "\342\213\202",
+    "\342\227\257",
+    "\342\213\203",
+    "\342\250\200",
+    "\342\250\201",
+    "\342\250\202",
+    "\342\250\206",
+    "\342\230\205",
+    "\342\226\275",
+    "\342\226\263",
+    "\342\250\204",
+    "\342\213\201",
+    "\342\213\200",
+    "\342\244\215",
+    "\342\247\253",
+    "\342\226\252",
+    "\342\226\264",
+    "\342\226\276",
+    "\342\227\202",
+    "\342\226\270",
+    "\342\220\243",
+    "\342\226\222",
+    "\342\226\221",
+    "\342\226\223",
+    "\342\226\210",
+    "=\342\203\245",
+    "\342\211\241\342\203\245",
+    "\342\214\220",
+    "\360\235\225\223",
+    "\342\212\245",
+    "\342\212\245",
+    "\342\213\210",
+    "\342\225\227",
+    "\342\225\224",
+    "\342\225\226",
+    "\342\225\223",
+    "\342\225\220",
+    "\342\225\246",
+    "\342\225\251",
+    "\342\225\244",
+    "\342\225\247",
+    "\342\225\235",
+    "\342\225\232",
+    "\342\225\234",
+    "\342\225\231",
+    "\342\225\221",
+    "\342\225\254",
+    "\342\225\243",
+    "\342\225\240",
+    "\342\225\253",
+    "\342\225\242",
+    "\342\225\237",
+    "\342\247\211",
+    "\342\225\225",
+    "\342\225\222",
+    "\342\224\220",
+    "\342\224\214",
+    "\342\224\200",
+    "\342\225\245",
+    "\342\225\250",
+    "\342\224\254",
+    "\342\224\264",
+    "\342\212\237",
+    "\342\212\236",
+    "\342\212\240",
+    "\342\225\233",
+    "\342\225\230",
+    "\342\224\230",
+    "\342\224\224",
+    "\342\224\202",
+    "\342\225\252",
+    "\342\225\241",
+    "\342\225\236",
+    "\342\224\274",
+    "\342\224\244",
+    "\342\224\234",
+    "\342\200\265",
+    "\313\230",
+    "\302\246",
+    "\302\246",
+    "\360\235\222\267",
+    "\342\201\217",
+    "\342\210\275",
+    "\342\213\215",
+    "\134",
+    "\342\247\205",
+    "\342\237\210",
+    "\342\200\242",
+    "\342\200\242",
+    "\342\211\216",
+    "\342\252\256",
+    "\342\211\217",
+    "\342\211\217",
+    "\304\207",
+    "\342\210\251",
+    "\342\251\204",
+    "\342\251\211",
+    "\342\251\213",
+    "\342\251\207",
+    "\342\251\200",
+    "\342\210\251\357\270\200",
+    "\342\201\201",
+    "\313\207",
+    "\342\251\215",
+    "\304\215",
+    "\303\247",
+    "\303\247",
+    "\304\211",
+    "\342\251\214",
+    "\342\251\220",
+    "\304\213",
+    "\302\270",
+    "\302\270",
+    "\342\246\262",
+    "\302\242",
+    "\302\242",
+    "\302\267",
+    "\360\235\224\240",
+    "\321\207",
+    "\342\234\223",
+    "\342\234\223",
+    "\317\207",
+    "\342\227\213",
+    "\342\247\203",
+    "\313\206",
+    "\342\211\227",
+    "\342\206\272",
+    "\342\206\273",
+    "\302\256",
+    "\342\223\210",
+    "\342\212\233",
+    "\342\212\232",
+    "\342\212\235",
+    "\342\211\227",
+    "\342\250\220",
+    "\342\253\257",
+    "\342\247\202",
+    "\342\231\243",
+    "\342\231\243",
+    ":",
+    "\342\211\224",
+    "\342\211\224",
+    ",",
+    "@",
+    "\342\210\201",
+    "\342\210\230",
+    "\342\210\201",
+    "\342\204\202",
+    "\342\211\205",
+    "\342\251\255",
+    "\342\210\256",
+    "\360\235\225\224",
+    "\342\210\220",
+    "\302\251",
+    "\302\251",
+    "\342\204\227",
+    "\342\206\265",
+    "\342\234\227",
+    "\360\235\222\270",
+    "\342\253\217",
+    "\342\253\221",
+    "\342\253\220",
+    "\342\253\222",
+    "\342\213\257",
+    "\342\244\270",
+    "\342\244\265",
+    "\342\213\236",
+    "\342\213\237",
+    "\342\206\266",
+    "\342\244\275",
+    "\342\210\252",
+    "\342\251\210",
+    "\342\251\206",
+    "\342\251\212",
+    "\342\212\215",
+    "\342\251\205",
+    "\342\210\252\357\270\200",
+    "\342\206\267",
+    "\342\244\274",
+    "\342\213\236",
+    "\342\213\237",
+    "\342\213\216",
+    "\342\213\217",
+    "\302\244",
+    "\302\244",
+    "\342\206\266",
+    "\342\206\267",
+    "\342\213\216",
+    "\342\213\217",
+    "\342\210\262",
+    "\342\210\261",
+    "\342\214\255",
+    "\342\207\223",
+    "\342\245\245",
+    "\342\200\240",
+    "\342\204\270",
+    "\342\206\223",
+    "\342\200\220",
+    "\342\212\243",
+    "\342\244\217",
+    "\313\235",
+    "\304\217",
+    "\320\264",
+    "\342\205\206",
+    "\342\200\241",
+    "\342\207\212",
+    "\342\251\267",
+    "\302\260",
+    "\302\260",
+    "\316\264",
+    "\342\246\261",
+    "\342\245\277",
+    "\360\235\224\241",
+    "\342\207\203",
+    "\342\207\202",
+    "\342\213\204",
+    "\342\213\204",
+    "\342\231\246",
+    "\342\231\246",
+    "\302\250",
+    "\317\235",
+    "\342\213\262",
+    "\303\267",
+    "\303\267",
+    "\303\267",
+    "\342\213\207",
+    "\342\213\207",
+    "\321\222",
+    "\342\214\236",
+    "\342\214\215",
+    "$",
+    "\360\235\225\225",
+    "\313\231",
+    "\342\211\220",
+    "\342\211\221",
+    "\342\210\270",
+    "\342\210\224",
+    "\342\212\241",
+    "\342\214\206",
+    "\342\206\223",
+    "\342\207\212",
+    "\342\207\203",
+    "\342\207\202",
+    "\342\244\220",
+    "\342\214\237",
+    "\342\214\214",
+    "\360\235\222\271",
+    "\321\225",
+    "\342\247\266",
+    "\304\221",
+    "\342\213\261",
+    "\342\226\277",
+    "\342\226\276",
+    "\342\207\265",
+    "\342\245\257",
+    "\342\246\246",
+    "\321\237",
+    "\342\237\277",
+    "\342\251\267",
+    "\342\211\221",
+    "\303\251",
+    "\303\251",
+    "\342\251\256",
+    "\304\233",
+    "\342\211\226",
+    "\303\252",
+    "\303\252",
+    "\342\211\225",
+    "\321\215",
+    "\304\227",
+    "\342\205\207",
+    "\342\211\222",
+    "\360\235\224\242",
+    "\342\252\232",
+    "\303\250",
+    "\303\250",
+    "\342\252\226",
+    "\342\252\230",
+    "\342\252\231",
+    "\342\217\247",
+    "\342\204\223",
+    "\342\252\225",
+    "\342\252\227",
+    "\304\223",
+    "\342\210\205",
+    "\342\210\205",
+    "\342\210\205",
+    "\342\200\204",
+    "\342\200\205",
+    "\342\200\203",
+    "\305\213",
+    "\342\200\202",
+    "\304\231",
+    "\360\235\225\226",
+    "\342\213\225",
+    "\342\247\243",
+    "\342\251\261",
+    "\316\265",
+    "\316\265",
+    "\317\265",
+    "\342\211\226",
+    "\342\211\225",
+    "\342\211\202",
+    "\342\252\226",
+    "\342\252\225",
+    "=",
+    "\342\211\237",
+    "\342\211\241",
+    "\342\251\270",
+    "\342\247\245",
+    "\342\211\223",
+    "\342\245\261",
+    "\342\204\257",
+    "\342\211\220",
+    "\342\211\202",
+    "\316\267",
+    "\303\260",
+    "\303\260",
+    "\303\253",
+    "\303\253",
+    "\342\202\254",
+    "!",
+    "\342\210\203",
+    "\342\204\260",
+    "\342\205\207",
+    "\342\211\222",
+    "\321\204",
+    "\342\231\200",
+    "\357\254\203",
+    "\357\254\200",
+    "\357\254\204",
+    "\360\235\224\243",
+    "\357\254\201",
+    "fj",
+    "\342\231\255",
+    "\357\254\202",
+    "\342\226\261",
+    "\306\222",
+    "\360\235\225\227",
+    "\342\210\200",
+    "\342\213\224",
+    "\342\253\231",
+    "\342\250\215",
+    "\302\275",
+    "\302\275",
+    "\342\205\223",
+    "\302\274",
+    "\302\274",
+    "\342\205\225",
+    "\342\205\231",
+    "\342\205\233",
+    "\342\205\224",
+    "\342\205\226",
+    "\302\276",
+    "\302\276",
+    "\342\205\227",
+    "\342\205\234",
+    "\342\205\230",
+    "\342\205\232",
+    "\342\205\235",
+    "\342\205\236",
+    "\342\201\204",
+    "\342\214\242",
+    "\360\235\222\273",
+    "\342\211\247",
+    "\342\252\214",
+    "\307\265",
+    "\316\263",
+    "\317\235",
+    "\342\252\206",
+    "\304\237",
+    "\304\235",
+    "\320\263",
+    "\304\241",
+    "\342\211\245",
+    "\342\213\233",
+    "\342\211\245",
+    "\342\211\247",
+    "\342\251\276",
+    "\342\251\276",
+    "\342\252\251",
+    "\342\252\200",
+    "\342\252\202",
+    "\342\252\204",
+    "\342\213\233\357\270\200",
+    "\342\252\224",
+    "\360\235\224\244",
+    "\342\211\253",
+    "\342\213\231",
+    "\342\204\267",
+    "\321\223",
+    "\342\211\267",
+    "\342\252\222",
+    "\342\252\245",
+    "\342\252\244",
+    "\342\211\251",
+    "\342\252\212",
+    "\342\252\212",
+    "\342\252\210",
+    "\342\252\210",
+    "\342\211\251",
+    "\342\213\247",
+    "\360\235\225\230",
+    "`",
+    "\342\204\212",
+    "\342\211\263",
+    "\342\252\216",
+    "\342\252\220",
+    ">",
+    ">",
+    "\342\252\247",
+    "\342\251\272",
+    "\342\213\227",
+    "\342\246\225",
+    "\342\251\274",
+    "\342\252\206",
+    "\342\245\270",
+    "\342\213\227",
+    "\342\213\233",
+    "\342\252\214",
+    "\342\211\267",
+    "\342\211\263",
+    "\342\211\251\357\270\200",
+    "\342\211\251\357\270\200",
+    "\342\207\224",
+    "\342\200\212",
+    "\302\275",
+    "\342\204\213",
+    "\321\212",
+    "\342\206\224",
+    "\342\245\210",
+    "\342\206\255",
+    "\342\204\217",
+    "\304\245",
+    "\342\231\245",
+    "\342\231\245",
+    "\342\200\246",
+    "\342\212\271",
+    "\360\235\224\245",
+    "\342\244\245",
+    "\342\244\246",
+    "\342\207\277",
+    "\342\210\273",
+    "\342\206\251",
+    "\342\206\252",
+    "\360\235\225\231",
+    "\342\200\225",
+    "\360\235\222\275",
+    "\342\204\217",
+    "\304\247",
+    "\342\201\203",
+    "\342\200\220",
+    "\303\255",
+    "\303\255",
+    "\342\201\243",
+    "\303\256",
+    "\303\256",
+    "\320\270",
+    "\320\265",
+    "\302\241",
+    "\302\241",
+    "\342\207\224",
+    "\360\235\224\246",
+    "\303\254",
+    "\303\254",
+    "\342\205\210",
+    "\342\250\214",
+    "\342\210\255",
+    "\342\247\234",
+    "\342\204\251",
+    "\304\263",
+    "\304\253",
+    "\342\204\221",
+    "\342\204\220",
+    "\342\204\221",
+    "\304\261",
+    "\342\212\267",
+    "\306\265",
+    "\342\210\210",
+    "\342\204\205",
+    "\342\210\236",
+    "\342\247\235",
+    "\304\261",
+    "\342\210\253",
+    "\342\212\272",
+    "\342\204\244",
+    "\342\212\272",
+    "\342\250\227",
+    "\342\250\274",
+    "\321\221",
+    "\304\257",
+    "\360\235\225\232",
+    "\316\271",
+    "\342\250\274",
+    "\302\277",
+    "\302\277",
+    "\360\235\222\276",
+    "\342\210\210",
+    "\342\213\271",
+    "\342\213\265",
+    "\342\213\264",
+    "\342\213\263",
+    "\342\210\210",
+    "\342\201\242",
+    "\304\251",
+    "\321\226",
+    "\303\257",
+    "\303\257",
+    "\304\265",
+    "\320\271",
+    "\360\235\224\247",
+    "\310\267",
+    "\360\235\225\233",
+    "\360\235\222\277",
+    "\321\230",
+    "\321\224",
+    "\316\272",
+    "\317\260",
+    "\304\267",
+    "\320\272",
+    "\360\235\224\250",
+    "\304\270",
+    "\321\205",
+    "\321\234",
+    "\360\235\225\234",
+    "\360\235\223\200",
+    "\342\207\232",
+    "\342\207\220",
+    "\342\244\233",
+    "\342\244\216",
+    "\342\211\246",
+    "\342\252\213",
+    "\342\245\242",
+    "\304\272",
+    "\342\246\264",
+    "\342\204\222",
+    "\316\273",
+    "\342\237\250",
+    "\342\246\221",
+    "\342\237\250",
+    "\342\252\205",
+    "\302\253",
+    "\302\253",
+    "\342\206\220",
+    "\342\207\244",
+    "\342\244\237",
+    "\342\244\235",
+    "\342\206\251",
+    "\342\206\253",
+    "\342\244\271",
+    "\342\245\263",
+    "\342\206\242",
+    "\342\252\253",
+    "\342\244\231",
+    "\342\252\255",
+    "\342\252\255\357\270\200",
+    "\342\244\214",
+    "\342\235\262",
+    "{",
+    "[",
+    "\342\246\213",
+    "\342\246\217",
+    "\342\246\215",
+    "\304\276",
+    "\304\274",
+    "\342\214\210",
+    "{",
+    "\320\273",
+    "\342\244\266",
+    "\342\200\234",
+    "\342\200\236",
+    "\342\245\247",
+    "\342\245\213",
+    "\342\206\262",
+    "\342\211\244",
+    "\342\206\220",
+    "\342\206\242",
+    "\342\206\275",
+    "\342\206\274",
+    "\342\207\207",
+    "\342\206\224",
+    "\342\207\206",
+    "\342\207\213",
+    "\342\206\255",
+    "\342\213\213",
+    "\342\213\232",
+    "\342\211\244",
+    "\342\211\246",
+    "\342\251\275",
+    "\342\251\275",
+    "\342\252\250",
+    "\342\251\277",
+    "\342\252\201",
+    "\342\252\203",
+    "\342\213\232\357\270\200",
+    "\342\252\223",
+    "\342\252\205",
+    "\342\213\226",
+    "\342\213\232",
+    "\342\252\213",
+    "\342\211\266",
+    "\342\211\262",
+    "\342\245\274",
+    "\342\214\212",
+    "\360\235\224\251",
+    "\342\211\266",
+    "\342\252\221",
+    "\342\206\275",
+    "\342\206\274",
+    "\342\245\252",
+    "\342\226\204",
+    "\321\231",
+    "\342\211\252",
+    "\342\207\207",
+    "\342\214\236",
+    "\342\245\253",
+    "\342\227\272",
+    "\305\200",
+    "\342\216\260",
+    "\342\216\260",
+    "\342\211\250",
+    "\342\252\211",
+    "\342\252\211",
+    "\342\252\207",
+    "\342\252\207",
+    "\342\211\250",
+    "\342\213\246",
+    "\342\237\254",
+    "\342\207\275",
+    "\342\237\246",
+    "\342\237\265",
+    "\342\237\267",
+    "\342\237\274",
+    "\342\237\266",
+    "\342\206\253",
+    "\342\206\254",
+    "\342\246\205",
+    "\360\235\225\235",
+    "\342\250\255",
+    "\342\250\264",
+    "\342\210\227",
+    "_",
+    "\342\227\212",
+    "\342\227\212",
+    "\342\247\253",
+    "(",
+    "\342\246\223",
+    "\342\207\206",
+    "\342\214\237",
+    "\342\207\213",
+    "\342\245\255",
+    "\342\200\216",
+    "\342\212\277",
+    "\342\200\271",
+    "\360\235\223\201",
+    "\342\206\260",
+    "\342\211\262",
+    "\342\252\215",
+    "\342\252\217",
+    "[",
+    "\342\200\230",
+    "\342\200\232",
+    "\305\202",
+    "<",
+    "<",
+    "\342\252\246",
+    "\342\251\271",
+    "\342\213\226",
+    "\342\213\213",
+    "\342\213\211",
+    "\342\245\266",
+    "\342\251\273",
+    "\342\246\226",
+    "\342\227\203",
+    "\342\212\264",
+    "\342\227\202",
+    "\342\245\212",
+    "\342\245\246",
+    "\342\211\250\357\270\200",
+    "\342\211\250\357\270\200",
+    "\342\210\272",
+    "\302\257",
+    "\302\257",
+    "\342\231\202",
+    "\342\234\240",
+    "\342\234\240",
+    "\342\206\246",
+    "\342\206\246",
+    "\342\206\247",
+    "\342\206\244",
+    "\342\206\245",
+    "\342\226\256",
+    "\342\250\251",
+    "\320\274",
+    "\342\200\224",
+    "\342\210\241",
+    "\360\235\224\252",
+    "\342\204\247",
+    "\302\265",
+    "\302\265",
+    "\342\210\243",
+    "*",
+    "\342\253\260",
+    "\302\267",
+    "\302\267",
+    "\342\210\222",
+    "\342\212\237",
+    "\342\210\270",
+    "\342\250\252",
+    "\342\253\233",
+    "\342\200\246",
+    "\342\210\223",
+    "\342\212\247",
+    "\360\235\225\236",
+    "\342\210\223",
+    "\360\235\223\202",
+    "\342\210\276",
+    "\316\274",
+    "\342\212\270",
+    "\342\212\270",
+    "\342\213\231\314\270",
+    "\342\211\253\342\203\222",
+    "\342\211\253\314\270",
+    "\342\207\215",
+    "\342\207\216",
+    "\342\213\230\314\270",
+    "\342\211\252\342\203\222",
+    "\342\211\252\314\270",
+    "\342\207\217",
+    "\342\212\257",
+    "\342\212\256",
+    "\342\210\207",
+    "\305\204",
+    "\342\210\240\342\203\222",
+    "\342\211\211",
+    "\342\251\260\314\270",
+    "\342\211\213\314\270",
+    "\305\211",
+    "\342\211\211",
+    "\342\231\256",
+    "\342\231\256",
+    "\342\204\225",
+    "\302\240",
+    "\302\240",
+    "\342\211\216\314\270",
+    "\342\211\217\314\270",
+    "\342\251\203",
+    "\305\210",
+    "\305\206",
+    "\342\211\207",
+    "\342\251\255\314\270",
+    "\342\251\202",
+    "\320\275",
+    "\342\200\223",
+    "\342\211\240",
+    "\342\207\227",
+    "\342\244\244",
+    "\342\206\227",
+    "\342\206\227",
+    "\342\211\220\314\270",
+    "\342\211\242",
+    "\342\244\250",
+    "\342\211\202\314\270",
+    "\342\210\204",
+    "\342\210\204",
+    "\360\235\224\253",
+    "\342\211\247\314\270",
+    "\342\211\261",
+    "\342\211\261",
+    "\342\211\247\314\270",
+    "\342\251\276\314\270",
+    "\342\251\276\314\270",
+    "\342\211\265",
+    "\342\211\257",
+    "\342\211\257",
+    "\342\207\216",
+    "\342\206\256",
+    "\342\253\262",
+    "\342\210\213",
+    "\342\213\274",
+    "\342\213\272",
+    "\342\210\213",
+    "\321\232",
+    "\342\207\215",
+    "\342\211\246\314\270",
+    "\342\206\232",
+    "\342\200\245",
+    "\342\211\260",
+    "\342\206\232",
+    "\342\206\256",
+    "\342\211\260",
+    "\342\211\246\314\270",
+    "\342\251\275\314\270",
+    "\342\251\275\314\270",
+    "\342\211\256",
+    "\342\211\264",
+    "\342\211\256",
+    "\342\213\252",
+    "\342\213\254",
+    "\342\210\244",
+    "\360\235\225\237",
+    "\302\254",
+    "\302\254",
+    "\342\210\211",
+    "\342\213\271\314\270",
+    "\342\213\265\314\270",
+    "\342\210\211",
+    "\342\213\267",
+    "\342\213\266",
+    "\342\210\214",
+    "\342\210\214",
+    "\342\213\276",
+    "\342\213\275",
+    "\342\210\246",
+    "\342\210\246",
+    "\342\253\275\342\203\245",
+    "\342\210\202\314\270",
+    "\342\250\224",
+    "\342\212\200",
+    "\342\213\240",
+    "\342\252\257\314\270",
+    "\342\212\200",
+    "\342\252\257\314\270",
+    "\342\207\217",
+    "\342\206\233",
+    "\342\244\263\314\270",
+    "\342\206\235\314\270",
+    "\342\206\233",
+    "\342\213\253",
+    "\342\213\255",
+    "\342\212\201",
+    "\342\213\241",
+    "\342\252\260\314\270",
+    "\360\235\223\203",
+    "\342\210\244",
+    "\342\210\246",
+    "\342\211\201",
+    "\342\211\204",
+    "\342\211\204",
+    "\342\210\244",
+    "\342\210\246",
+    "\342\213\242",
+    "\342\213\243",
+    "\342\212\204",
+    "\342\253\205\314\270",
+    "\342\212\210",
+    "\342\212\202\342\203\222",
+    "\342\212\210",
+    "\342\253\205\314\270",
+    "\342\212\201",
+    "\342\252\260\314\270",
+    "\342\212\205",
+    "\342\253\206\314\270",
+    "\342\212\211",
+    "\342\212\203\342\203\222",
+    "\342\212\211",
+    "\342\253\206\314\270",
+    "\342\211\271",
+    "\303\261",
+    "\303\261",
+    "\342\211\270",
+    "\342\213\252",
+    "\342\213\254",
+    "\342\213\253",
+    "\342\213\255",
+    "\316\275",
+    "#",
+    "\342\204\226",
+    "\342\200\207",
+    "\342\212\255",
+    "\342\244\204",
+    "\342\211\215\342\203\222",
+    "\342\212\254",
+    "\342\211\245\342\203\222",
+    ">\342\203\222",
+    "\342\247\236",
+    "\342\244\202",
+    "\342\211\244\342\203\222",
+    "<\342\203\222",
+    "\342\212\264\342\203\222",
+    "\342\244\203",
+    "\342\212\265\342\203\222",
+    "\342\210\274\342\203\222",
+    "\342\207\226",
+    "\342\244\243",
+    "\342\206\226",
+    "\342\206\226",
+    "\342\244\247",
+    "\342\223\210",
+    "\303\263",
+    "\303\263",
+    "\342\212\233",
+    "\342\212\232",
+    "\303\264",
+    "\303\264",
+    "\320\276",
+    "\342\212\235",
+    "\305\221",
+    "\342\250\270",
+    "\342\212\231",
+    "\342\246\274",
+    "\305\223",
+    "\342\246\277",
+    "\360\235\224\254",
+    "\313\233",
+    "\303\262",
+    "\303\262",
+    "\342\247\201",
+    "\342\246\265",
+    "\316\251",
+    "\342\210\256",
+    "\342\206\272",
+    "\342\246\276",
+    "\342\246\273",
+    "\342\200\276",
+    "\342\247\200",
+    "\305\215",
+    "\317\211",
+    "\316\277",
+    "\342\246\266",
+    "\342\212\226",
+    "\360\235\225\240",
+    "\342\246\267",
+    "\342\246\271",
+    "\342\212\225",
+    "\342\210\250",
+    "\342\206\273",
+    "\342\251\235",
+    "\342\204\264",
+    "\342\204\264",
+    "\302\252",
+    "\302\252",
+    "\302\272",
+    "\302\272",
+    "\342\212\266",
+    "\342\251\226",
+    "\342\251\227",
+    "\342\251\233",
+    "\342\204\264",
+    "\303\270",
+    "\303\270",
+    "\342\212\230",
+    "\303\265",
+    "\303\265",
+    "\342\212\227",
+    "\342\250\266",
+    "\303\266",
+    "\303\266",
+    "\342\214\275",
+    "\342\210\245",
+    "\302\266",
+    "\302\266",
+    "\342\210\245",
+    "\342\253\263",
+    "\342\253\275",
+    "\342\210\202",
+    "\320\277",
+    "%",
+    ".",
+    "\342\200\260",
+    "\342\212\245",
+    "\342\200\261",
+    "\360\235\224\255",
+    "\317\206",
+    "\317\225",
+    "\342\204\263",
+    "\342\230\216",
+    "\317\200",
+    "\342\213\224",
+    "\317\226",
+    "\342\204\217",
+    "\342\204\216",
+    "\342\204\217",
+    "+",
+    "\342\250\243",
+    "\342\212\236",
+    "\342\250\242",
+    "\342\210\224",
+    "\342\250\245",
+    "\342\251\262",
+    "\302\261",
+    "\302\261",
+    "\342\250\246",
+    "\342\250\247",
+    "\302\261",
+    "\342\250\225",
+    "\360\235\225\241",
+    "\302\243",
+    "\302\243",
+    "\342\211\272",
+    "\342\252\263",
+    "\342\252\267",
+    "\342\211\274",
+    "\342\252\257",
+    "\342\211\272",
+    "\342\252\267",
+    "\342\211\274",
+    "\342\252\257",
+    "\342\252\271",
+    "\342\252\265",
+    "\342\213\250",
+    "\342\211\276",
+    "\342\200\262",
+    "\342\204\231",
+    "\342\252\265",
+    "\342\252\271",
+    "\342\213\250",
+    "\342\210\217",
+    "\342\214\256",
+    "\342\214\222",
+    "\342\214\223",
+    "\342\210\235",
+    "\342\210\235",
+    "\342\211\276",
+    "\342\212\260",
+    "\360\235\223\205",
+    "\317\210",
+    "\342\200\210",
+    "\360\235\224\256",
+    "\342\250\214",
+    "\360\235\225\242",
+    "\342\201\227",
+    "\360\235\223\206",
+    "\342\204\215",
+    "\342\250\226",
+    "\077",
+    "\342\211\237",
+    "\042",
+    "\042",
+    "\342\207\233",
+    "\342\207\222",
+    "\342\244\234",
+    "\342\244\217",
+    "\342\245\244",
+    "\342\210\275\314\261",
+    "\305\225",
+    "\342\210\232",
+    "\342\246\263",
+    "\342\237\251",
+    "\342\246\222",
+    "\342\246\245",
+    "\342\237\251",
+    "\302\273",
+    "\302\273",
+    "\342\206\222",
+    "\342\245\265",
+    "\342\207\245",
+    "\342\244\240",
+    "\342\244\263",
+    "\342\244\236",
+    "\342\206\252",
+    "\342\206\254",
+    "\342\245\205",
+    "\342\245\264",
+    "\342\206\243",
+    "\342\206\235",
+    "\342\244\232",
+    "\342\210\266",
+    "\342\204\232",
+    "\342\244\215",
+    "\342\235\263",
+    "}",
+    "]",
+    "\342\246\214",
+    "\342\246\216",
+    "\342\246\220",
+    "\305\231",
+    "\305\227",
+    "\342\214\211",
+    "}",
+    "\321\200",
+    "\342\244\267",
+    "\342\245\251",
+    "\342\200\235",
+    "\342\200\235",
+    "\342\206\263",
+    "\342\204\234",
+    "\342\204\233",
+    "\342\204\234",
+    "\342\204\235",
+    "\342\226\255",
+    "\302\256",
+    "\302\256",
+    "\342\245\275",
+    "\342\214\213",
+    "\360\235\224\257",
+    "\342\207\201",
+    "\342\207\200",
+    "\342\245\254",
+    "\317\201",
+    "\317\261",
+    "\342\206\222",
+    "\342\206\243",
+    "\342\207\201",
+    "\342\207\200",
+    "\342\207\204",
+    "\342\207\214",
+    "\342\207\211",
+    "\342\206\235",
+    "\342\213\214",
+    "\313\232",
+    "\342\211\223",
+    "\342\207\204",
+    "\342\207\214",
+    "\342\200\217",
+    "\342\216\261",
+    "\342\216\261",
+    "\342\253\256",
+    "\342\237\255",
+    "\342\207\276",
+    "\342\237\247",
+    "\342\246\206",
+    "\360\235\225\243",
+    "\342\250\256",
+    "\342\250\265",
+    ")",
+    "\342\246\224",
+    "\342\250\222",
+    "\342\207\211",
+    "\342\200\272",
+    "\360\235\223\207",
+    "\342\206\261",
+    "]",
+    "\342\200\231",
+    "\342\200\231",
+    "\342\213\214",
+    "\342\213\212",
+    "\342\226\271",
+    "\342\212\265",
+    "\342\226\270",
+    "\342\247\216",
+    "\342\245\250",
+    "\342\204\236",
+    "\305\233",
+    "\342\200\232",
+    "\342\211\273",
+    "\342\252\264",
+    "\342\252\270",
+    "\305\241",
+    "\342\211\275",
+    "\342\252\260",
+    "\305\237",
+    "\305\235",
+    "\342\252\266",
+    "\342\252\272",
+    "\342\213\251",
+    "\342\250\223",
+    "\342\211\277",
+    "\321\201",
+    "\342\213\205",
+    "\342\212\241",
+    "\342\251\246",
+    "\342\207\230",
+    "\342\244\245",
+    "\342\206\230",
+    "\342\206\230",
+    "\302\247",
+    "\302\247",
+    ";",
+    "\342\244\251",
+    "\342\210\226",
+    "\342\210\226",
+    "\342\234\266",
+    "\360\235\224\260",
+    "\342\214\242",
+    "\342\231\257",
+    "\321\211",
+    "\321\210",
+    "\342\210\243",
+    "\342\210\245",
+    "\302\255",
+    "\302\255",
+    "\317\203",
+    "\317\202",
+    "\317\202",
+    "\342\210\274",
+    "\342\251\252",
+    "\342\211\203",
+    "\342\211\203",
+    "\342\252\236",
+    "\342\252\240",
+    "\342\252\235",
+    "\342\252\237",
+    "\342\211\206",
+    "\342\250\244",
+    "\342\245\262",
+    "\342\206\220",
+    "\342\210\226",
+    "\342\250\263",
+    "\342\247\244",
+    "\342\210\243",
+    "\342\214\243",
+    "\342\252\252",
+    "\342\252\254",
+    "\342\252\254\357\270\200",
+    "\321\214",
+    "/",
+    "\342\247\204",
+    "\342\214\277",
+    "\360\235\225\244",
+    "\342\231\240",
+    "\342\231\240",
+    "\342\210\245",
+    "\342\212\223",
+    "\342\212\223\357\270\200",
+    "\342\212\224",
+    "\342\212\224\357\270\200",
+    "\342\212\217",
+    "\342\212\221",
+    "\342\212\217",
+    "\342\212\221",
+    "\342\212\220",
+    "\342\212\222",
+    "\342\212\220",
+    "\342\212\222",
+    "\342\226\241",
+    "\342\226\241",
+    "\342\226\252",
+    "\342\226\252",
+    "\342\206\222",
+    "\360\235\223\210",
+    "\342\210\226",
+    "\342\214\243",
+    "\342\213\206",
+    "\342\230\206",
+    "\342\230\205",
+    "\317\265",
+    "\317\225",
+    "\302\257",
+    "\342\212\202",
+    "\342\253\205",
+    "\342\252\275",
+    "\342\212\206",
+    "\342\253\203",
+    "\342\253\201",
+    "\342\253\213",
+    "\342\212\212",
+    "\342\252\277",
+    "\342\245\271",
+    "\342\212\202",
+    "\342\212\206",
+    "\342\253\205",
+    "\342\212\212",
+    "\342\253\213",
+    "\342\253\207",
+    "\342\253\225",
+    "\342\253\223",
+    "\342\211\273",
+    "\342\252\270",
+    "\342\211\275",
+    "\342\252\260",
+    "\342\252\272",
+    "\342\252\266",
+    "\342\213\251",
+    "\342\211\277",
+    "\342\210\221",
+    "\342\231\252",
+    "\302\271",
+    "\302\271",
+    "\302\262",
+    "\302\262",
+    "\302\263",
+    "\302\263",
+    "\342\212\203",
+    "\342\253\206",
+    "\342\252\276",
+    "\342\253\230",
+    "\342\212\207",
+    "\342\253\204",
+    "\342\237\211",
+    "\342\253\227",
+    "\342\245\273",
+    "\342\253\202",
+    "\342\253\214",
+    "\342\212\213",
+    "\342\253\200",
+    "\342\212\203",
+    "\342\212\207",
+    "\342\253\206",
+    "\342\212\213",
+    "\342\253\214",
+    "\342\253\210",
+    "\342\253\224",
+    "\342\253\226",
+    "\342\207\231",
+    "\342\244\246",
+    "\342\206\231",
+    "\342\206\231",
+    "\342\244\252",
+    "\303\237",
+    "\303\237",
+    "\342\214\226",
+    "\317\204",
+    "\342\216\264",
+    "\305\245",
+    "\305\243",
+    "\321\202",
+    "\342\203\233",
+    "\342\214\225",
+    "\360\235\224\261",
+    "\342\210\264",
+    "\342\210\264",
+    "\316\270",
+    "\317\221",
+    "\317\221",
+    "\342\211\210",
+    "\342\210\274",
+    "\342\200\211",
+    "\342\211\210",
+    "\342\210\274",
+    "\303\276",
+    "\303\276",
+    "\313\234",
+    "\303\227",
+    "\303\227",
+    "\342\212\240",
+    "\342\250\261",
+    "\342\250\260",
+    "\342\210\255",
+    "\342\244\250",
+    "\342\212\244",
+    "\342\214\266",
+    "\342\253\261",
+    "\360\235\225\245",
+    "\342\253\232",
+    "\342\244\251",
+    "\342\200\264",
+    "\342\204\242",
+    "\342\226\265",
+    "\342\226\277",
+    "\342\227\203",
+    "\342\212\264",
+    "\342\211\234",
+    "\342\226\271",
+    "\342\212\265",
+    "\342\227\254",
+    "\342\211\234",
+    "\342\250\272",
+    "\342\250\271",
+    "\342\247\215",
+    "\342\250\273",
+    "\342\217\242",
+    "\360\235\223\211",
+    "\321\206",
+    "\321\233",
+    "\305\247",
+    "\342\211\254",
+    "\342\206\236",
+    "\342\206\240",
+    "\342\207\221",
+    "\342\245\243",
+    "\303\272",
+    "\303\272",
+    "\342\206\221",
+    "\321\236",
+    "\305\255",
+    "\303\273",
+    "\303\273",
+    "\321\203",
+    "\342\207\205",
+    "\305\261",
+    "\342\245\256",
+    "\342\245\276",
+    "\360\235\224\262",
+    "\303\271",
+    "\303\271",
+    "\342\206\277",
+    "\342\206\276",
+    "\342\226\200",
+    "\342\214\234",
+    "\342\214\234",
+    "\342\214\217",
+    "\342\227\270",
+    "\305\253",
+    "\302\250",
+    "\302\250",
+    "\305\263",
+    "\360\235\225\246",
+    "\342\206\221",
+    "\342\206\225",
+    "\342\206\277",
+    "\342\206\276",
+    "\342\212\216",
+    "\317\205",
+    "\317\222",
+    "\317\205",
+    "\342\207\210",
+    "\342\214\235",
+    "\342\214\235",
+    "\342\214\216",
+    "\305\257",
+    "\342\227\271",
+    "\360\235\223\212",
+    "\342\213\260",
+    "\305\251",
+    "\342\226\265",
+    "\342\226\264",
+    "\342\207\210",
+    "\303\274",
+    "\303\274",
+    "\342\246\247",
+    "\342\207\225",
+    "\342\253\250",
+    "\342\253\251",
+    "\342\212\250",
+    "\342\246\234",
+    "\317\265",
+    "\317\260",
+    "\342\210\205",
+    "\317\225",
+    "\317\226",
+    "\342\210\235",
+    "\342\206\225",
+    "\317\261",
+    "\317\202",
+    "\342\212\212\357\270\200",
+    "\342\253\213\357\270\200",
+    "\342\212\213\357\270\200",
+    "\342\253\214\357\270\200",
+    "\317\221",
+    "\342\212\262",
+    "\342\212\263",
+    "\320\262",
+    "\342\212\242",
+    "\342\210\250",
+    "\342\212\273",
+    "\342\211\232",
+    "\342\213\256",
+    "|",
+    "|",
+    "\360\235\224\263",
+    "\342\212\262",
+    "\342\212\202\342\203\222",
+    "\342\212\203\342\203\222",
+    "\360\235\225\247",
+    "\342\210\235",
+    "\342\212\263",
+    "\360\235\223\213",
+    "\342\253\213\357\270\200",
+    "\342\212\212\357\270\200",
+    "\342\253\214\357\270\200",
+    "\342\212\213\357\270\200",
+    "\342\246\232",
+    "\305\265",
+    "\342\251\237",
+    "\342\210\247",
+    "\342\211\231",
+    "\342\204\230",
+    "\360\235\224\264",
+    "\360\235\225\250",
+    "\342\204\230",
+    "\342\211\200",
+    "\342\211\200",
+    "\360\235\223\214",
+    "\342\213\202",
+    "\342\227\257",
+    "\342\213\203",
+    "\342\226\275",
+    "\360\235\224\265",
+    "\342\237\272",
+    "\342\237\267",
+    "\316\276",
+    "\342\237\270",
+    "\342\237\265",
+    "\342\237\274",
+    "\342\213\273",
+    "\342\250\200",
+    "\360\235\225\251",
+    "\342\250\201",
+    "\342\250\202",
+    "\342\237\271",
+    "\342\237\266",
+    "\360\235\223\215",
+    "\342\250\206",
+    "\342\250\204",
+    "\342\226\263",
+    "\342\213\201",
+    "\342\213\200",
+    "\303\275",
+    "\303\275",
+    "\321\217",
+    "\305\267",
+    "\321\213",
+    "\302\245",
+    "\302\245",
+    "\360\235\224\266",
+    "\321\227",
+    "\360\235\225\252",
+    "\360\235\223\216",
+    "\321\216",
+    "\303\277",
+    "\303\277",
+    "\305\272",
+    "\305\276",
+    "\320\267",
+    "\305\274",
+    "\342\204\250",
+    "\316\266",
+    "\360\235\224\267",
+    "\320\266",
+    "\342\207\235",
+    "\360\235\225\253",
+    "\360\235\223\217",
+    "\342\200\215",
+    "\342\200\214",
+};
+
+static const unsigned char entity_value_lengths[ENTITY_COUNT] = {
+    0, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 4,
+    2, 2, 2, 2, 3, 2, 4, 3, 2, 2, 4, 3,
+    2, 2, 2, 2, 3, 3, 3, 2, 3, 3, 2, 4,
+    4, 2, 3, 3, 2, 2, 2, 2, 3, 3, 3, 2,
+    2, 2, 2, 3, 2, 2, 2, 3, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 3, 3, 3, 3, 2, 2, 2, 3, 3, 3,
+    2, 2, 3, 2, 4, 2, 2, 2, 1, 2, 3, 3,
+    4, 2, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 3,
+    2, 3, 3, 2, 4, 2, 3, 3, 3, 3, 3, 2,
+    2, 2, 3, 3, 2, 4, 3, 3, 4, 3, 3, 3,
+    2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 4, 3,
+    4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 2, 2,
+    1, 2, 3, 3, 3, 3, 3, 2, 3, 3, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2,
+    3, 3, 3, 3, 3, 3, 3, 2, 4, 2, 3, 2,
+    2, 2, 2, 2, 2, 4, 4, 4, 2, 2, 2, 2,
+    2, 2, 2, 4, 4, 4, 2, 1, 1, 2, 2, 3,
+    3, 3, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 3, 3, 2, 3, 3, 3, 3, 3, 3, 4,
+    3, 3, 3, 3, 2, 3, 3, 2, 3, 3, 4, 3,
+    4, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    3, 3, 1, 4, 3, 2, 3, 3, 3, 3, 3, 3,
+    3, 5, 3, 3, 3, 5, 5, 3, 5, 3, 5, 5,
+    3, 5, 3, 3, 3, 3, 5, 5, 3, 5, 5, 3,
+    5, 3, 3, 3, 5, 3, 5, 3, 5, 3, 6, 3,
+    3, 5, 3, 5, 6, 3, 3, 3, 3, 3, 3, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2,
+    2, 2, 2, 2, 4, 3, 3, 3, 4, 2, 2, 2,
+    2, 3, 2, 2, 3, 3, 3, 3, 3, 2, 4, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 2, 1, 1, 4, 3, 4, 3, 2, 2, 2,
+    3, 3, 3, 2, 2, 2, 3, 3, 3, 3, 3, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 2, 2, 2, 2, 3, 2, 2,
+    2, 2, 4, 3, 3, 3, 3, 2, 3, 4, 3, 3,
+    3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 3,
+    2, 2, 1, 2, 2, 2, 2, 4, 3, 2, 6, 3,
+    3, 3, 3, 3, 4, 3, 4, 2, 2, 2, 3, 3,
+    2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 1, 3,
+    3, 3, 3, 3, 2, 4, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 2, 2, 2, 4, 2, 2, 2,
+    3, 3, 2, 3, 3, 3, 3, 3, 3, 1, 3, 3,
+    3, 4, 4, 4, 3, 2, 3, 4, 4, 4, 4, 2,
+    4, 4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2,
+    2, 2, 3, 5, 3, 2, 2, 2, 2, 2, 2, 2,
+    3, 4, 2, 2, 3, 3, 2, 2, 3, 1, 1, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 2, 4,
+    3, 3, 3, 3, 3, 1, 3, 3, 2, 2, 4, 1,
+    3, 3, 2, 2, 2, 2, 3, 3, 3, 3, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3,
+    3, 2, 3, 2, 3, 3, 4, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 6, 3, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 4, 3, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 6,
+    3, 2, 3, 2, 2, 2, 2, 3, 3, 2, 2, 2,
+    3, 2, 2, 2, 4, 2, 3, 3, 2, 3, 3, 2,
+    3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 1, 3, 3, 1, 1, 3, 3, 3, 3, 3,
+    3, 3, 4, 3, 2, 2, 3, 3, 3, 4, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 6, 3, 3, 3, 3, 3, 3, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 2, 2, 2, 3, 3, 3, 3, 2, 2,
+    2, 3, 3, 4, 3, 3, 3, 3, 3, 3, 2, 2,
+    3, 2, 2, 2, 3, 3, 2, 3, 3, 1, 4, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 2, 3, 2, 3, 3, 3, 3, 3, 3, 2,
+    3, 3, 3, 2, 2, 3, 2, 3, 2, 2, 3, 2,
+    2, 3, 3, 4, 3, 2, 2, 3, 3, 3, 3, 3,
+    3, 3, 2, 3, 3, 3, 3, 3, 3, 2, 3, 2,
+    4, 3, 3, 3, 2, 2, 2, 3, 3, 3, 3, 3,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
+    2, 2, 2, 3, 1, 3, 3, 3, 3, 2, 3, 3,
+    3, 3, 4, 3, 2, 3, 3, 3, 2, 4, 3, 3,
+    3, 3, 2, 2, 3, 2, 2, 3, 3, 3, 3, 3,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3,
+    3, 2, 2, 2, 3, 2, 2, 2, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 6, 3, 4, 3, 3,
+    3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 1, 3, 3, 3, 3, 1, 1, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 6, 6, 3,
+    3, 2, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3,
+    3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3,
+    2, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2,
+    3, 4, 2, 2, 3, 3, 3, 3, 3, 2, 2, 3,
+    3, 3, 2, 3, 2, 3, 3, 3, 3, 2, 3, 3,
+    3, 3, 3, 3, 2, 2, 4, 2, 3, 2, 2, 4,
+    3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2,
+    2, 4, 2, 4, 4, 2, 2, 2, 2, 2, 2, 4,
+    2, 2, 2, 4, 4, 3, 3, 3, 3, 3, 3, 3,
+    2, 3, 3, 2, 3, 3, 3, 3, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 6, 3,
+    3, 1, 1, 3, 3, 3, 2, 2, 3, 1, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+    3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3,
+    1, 3, 3, 3, 1, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 3, 3, 3, 3, 1, 3, 3, 2, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 6, 6, 3, 2, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 2, 3, 3, 4, 3, 2, 2, 3,
+    1, 3, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 3, 4, 3, 2, 3, 3, 5, 6, 5, 3, 3,
+    5, 6, 5, 3, 3, 3, 3, 2, 6, 3, 5, 5,
+    2, 3, 3, 3, 3, 2, 2, 5, 5, 3, 2, 2,
+    3, 5, 3, 2, 3, 3, 3, 3, 3, 3, 5, 3,
+    3, 5, 3, 3, 4, 5, 3, 3, 5, 5, 5, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 5,
+    3, 3, 3, 3, 3, 3, 5, 5, 5, 3, 3, 3,
+    3, 3, 3, 4, 2, 2, 3, 5, 5, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 6, 5, 3, 3, 3, 5,
+    3, 5, 3, 3, 5, 5, 3, 3, 3, 3, 3, 5,
+    4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5,
+    3, 6, 3, 5, 3, 5, 3, 5, 3, 6, 3, 5,
+    3, 2, 2, 3, 3, 3, 3, 3, 2, 1, 3, 3,
+    3, 3, 6, 3, 6, 4, 3, 3, 6, 4, 6, 3,
+    6, 6, 3, 3, 3, 3, 3, 3, 2, 2, 3, 3,
+    2, 2, 2, 3, 2, 3, 3, 3, 2, 3, 4, 2,
+    2, 2, 3, 3, 2, 3, 3, 3, 3, 3, 3, 2,
+    2, 2, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3,
+    3, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2,
+    3, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 3,
+    3, 3, 3, 2, 1, 1, 3, 3, 3, 4, 2, 2,
+    3, 3, 2, 3, 2, 3, 3, 3, 1, 3, 3, 3,
+    3, 3, 3, 2, 2, 3, 3, 2, 3, 4, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 2, 3, 4, 3, 4, 3, 4, 3, 3,
+    1, 3, 1, 1, 3, 3, 3, 3, 3, 5, 2, 3,
+    3, 3, 3, 3, 3, 2, 2, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    1, 1, 3, 3, 3, 2, 2, 3, 1, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 3, 3,
+    4, 3, 3, 3, 2, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 4, 3, 3, 1, 3, 3, 3, 3, 4,
+    3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 3, 3, 3, 3, 2, 3, 3, 2, 2, 3, 3,
+    3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2,
+    2, 1, 3, 3, 3, 3, 4, 3, 3, 2, 2, 3,
+    3, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 6, 2, 1, 3, 3, 4, 3, 3, 3, 3, 6,
+    3, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 4, 3, 3, 3, 3, 3, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 3, 2, 3, 2, 2, 2, 3, 3, 4, 3,
+    3, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 4, 2, 2, 2, 3, 3, 3,
+    3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 3, 2,
+    3, 3, 4, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 4, 3, 3, 3, 3, 3, 2, 2,
+    2, 3, 3, 3, 3, 2, 3, 4, 3, 2, 3, 3,
+    3, 2, 2, 3, 3, 3, 3, 3, 3, 2, 2, 3,
+    2, 2, 3, 3, 2, 2, 6, 6, 6, 6, 2, 3,
+    3, 2, 3, 3, 3, 3, 3, 1, 1, 4, 3, 6,
+    6, 4, 3, 3, 4, 6, 6, 6, 6, 3, 2, 3,
+    3, 3, 3, 4, 4, 3, 3, 3, 4, 3, 3, 3,
+    3, 4, 3, 3, 2, 3, 3, 3, 3, 3, 4, 3,
+    3, 3, 3, 4, 3, 3, 3, 3, 3, 2, 2, 2,
+    2, 2, 2, 2, 4, 2, 4, 4, 2, 2, 2, 2,
+    2, 2, 2, 3, 2, 4, 2, 3, 4, 4, 3, 3,
+};
+
+static const unsigned short entity_hash_seeds[ENTITY_HASH_BUCKETS] = {
+    2, 1, 0, 2, 9, 2, 2, 2, 2, 1, 2, 3,
+    2, 2, 2, 1, 2, 0, 0, 1, 3, 5, 1, 0,
+    1, 2, 2, 1, 1, 3, 1, 4, 0, 1, 3, 1,
+    1, 0, 1, 1, 1, 0, 2, 1, 3, 2, 6, 1,
+    2, 0, 0, 1, 0, 2, 4, 2, 4, 1, 2, 0,
+    1, 4, 4, 1, 2, 2, 7, 2, 1, 2, 2, 1,
+    1, 1, 1, 2, 0, 1, 4, 4, 3, 1, 3, 5,
+    1, 2, 2, 0, 0, 1, 1, 4, 1, 0, 1, 2,
+    1, 1, 0, 3, 0, 1, 5, 0, 1, 3, 6, 2,
+    1, 2, 0, 3, 1, 1, 1, 2, 14, 0, 2, 0,
+    7, 1, 0, 2, 2, 7, 1, 1, 1, 2, 1, 1,
+    2, 3, 1, 3, 1, 1, 7, 5, 1, 1, 2, 2,
+    4, 0, 0, 1, 3, 1, 1, 1, 2, 1, 2, 1,
+    1, 2, 4, 1, 1, 0, 2, 1, 0, 4, 1, 1,
+    0, 1, 4, 2, 0, 3, 2, 1, 1, 0, 1, 1,
+    3, 2, 0, 1, 0, 0, 1, 2, 1, 2, 1, 4,
+    0, 1, 1, 2, 1, 2, 1, 6, 0, 0, 1, 1,
+    3, 2, 1, 1, 7, 4, 3, 4, 3, 0, 0, 1,
+    2, 2, 8, 1, 0, 0, 0, 1, 6, 2, 1, 1,
+    4, 1, 1, 2, 3, 4, 5, 3, 3, 1, 1, 2,
+    2, 1, 1, 1, 4, 4, 4, 1, 0, 0, 1, 1,
+    1, 4, 7, 1, 0, 3, 2, 1, 1, 3, 5, 3,
+    3, 0, 1, 0, 0, 2, 0, 6, 2, 1, 0, 3,
+    0, 1, 3, 5, 1, 3, 0, 3, 7, 1, 1, 1,
+    2, 1, 1, 1, 3, 1, 0, 3, 1, 2, 1, 1,
+    1, 0, 1, 1, 1, 0, 0, 0, 1, 5, 1, 1,
+    2, 3, 5, 3, 1, 1, 1, 0, 2, 5, 2, 4,
+    3, 1, 2, 3, 5, 1, 3, 1, 4, 1, 1, 0,
+    4, 1, 2, 2, 4, 2, 0, 0, 0, 0, 1, 0,
+    1, 1, 1, 1, 5, 4, 2, 2, 3, 1, 4, 1,
+    2, 3, 3, 3, 2, 1, 2, 7, 6, 2, 1, 2,
+    1, 2, 6, 2, 1, 1, 3, 2, 1, 1, 1, 1,
+    1, 1, 3, 1, 6, 0, 0, 0, 4, 2, 1, 3,
+    4, 4, 1, 1, 1, 1, 1, 2, 1, 2, 2, 1,
+    3, 4, 0, 1, 6, 3, 4, 5, 2, 1, 1, 1,
+    1, 1, 2, 10, 0, 2, 1, 0, 0, 1, 1, 0,
+    7, 1, 1, 2, 1, 0, 2, 1, 3, 3, 1, 2,
+    0, 3, 1, 2, 2, 3, 2, 3, 4, 2, 0, 1,
+    0, 5, 3, 4, 0, 1, 1, 1, 1, 3, 1, 2,
+    3, 3, 0, 3, 1, 6, 4, 3, 4, 1, 1, 0,
+    1, 1, 1, 0, 2, 1, 2, 1, 1, 20, 2, 2,
+    4, 1, 2, 3, 7, 7, 1, 3, 1, 3, 2, 0,
+    0, 1, 0, 0, 1, 0, 3, 2, 2, 2, 1, 1,
+    6, 1, 1, 10, 1, 0, 1, 0, 1, 1, 7, 0,
+    1, 2, 0, 1, 9, 1, 2, 1, 1, 1, 2, 3,
+    2, 1, 6, 2, 0, 1, 6, 1, 2, 8, 0, 2,
+    4, 4, 8, 1, 6, 4, 0, 3, 3, 0, 4, 3,
+    2, 8, 4, 4, 2, 4, 1, 1, 2, 2, 1, 4,
+    0, 0, 1, 0, 0, 2, 2, 0, 1, 5, 2, 5,
+    3, 2, 4, 1, 3, 1, 2, 3, 0, 5, 7, 1,
+    3, 2, 1, 6, 1, 9, 3, 0, 1, 1, 3, 1,
+    0, 2, 6, 9, 2, 2, 2, 3, 2, 1, 5, 5,
+    0, 4, 4, 3, 1, 2, 1, 3, 3, 3, 3, 3,
+    2, 7, 9, 1, 15, 2, 1, 2, 2, 2, 2, 0,
+    4, 13, 0, 2, 5, 1, 2, 3, 2, 1, 1, 9,
+    2, 1, 1, 2, 2, 0, 1, 2, 2, 1, 1, 1,
+    1, 1, 1, 1, 3, 4, 5, 1, 3, 5, 0, 7,
+    1, 1, 3, 2, 1, 4, 1, 2, 1, 3, 1, 1,
+    4, 1, 4, 1, 0, 3, 6, 2, 1, 1, 1, 2,
+    0, 6, 2, 1, 7, 2, 2, 4, 1, 3, 0, 2,
+    1, 1, 0, 6, 8, 4, 0, 0, 0, 9, 0, 7,
+    1, 6, 3, 3, 5, 1, 1, 2, 1, 1, 2, 2,
+    1, 3, 2, 1, 1, 0, 1, 4, 6, 4, 1, 2,
+    2, 1, 1, 1, 4, 1, 1, 1, 2, 0, 0, 1,
+    1, 6, 0, 0, 0, 7, 1, 4, 8, 1, 1, 2,
+    5, 1, 6, 0, 10, 1, 3, 4, 4, 1, 3, 1,
+    1, 1, 2, 3, 4, 0, 4, 3, 2, 5, 0, 0,
+    3, 5, 0, 1, 2, 7, 2, 3, 9, 2, 0, 1,
+    1, 4, 9, 0, 1, 4, 4, 2, 0, 2, 4, 2,
+    6, 3, 1, 3, 3, 3, 2, 6, 2, 8, 8, 0,
+    0, 3, 3, 22, 0, 2, 2, 5, 5, 1, 2, 0,
+    1, 3, 0, 1, 3, 1, 3, 1, 0, 5, 1, 0,
+    1, 2, 1, 3, 0, 2, 1, 3, 16, 2, 1, 3,
+    1, 1, 2, 0, 5, 1, 2, 1, 0, 4, 2, 2,
+    12, 1, 2, 1, 0, 1, 6, 6, 4, 15, 3, 2,
+    0, 5, 4, 2, 2, 0, 1, 4, 2, 2, 1, 0,
+    3, 2, 1, 2, 1, 1, 5, 1, 0, 10, 1, 4,
+    1, 2, 0, 0, 5, 2, 1, 4, 7, 1, 0, 5,
+    7, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 2,
+    1, 2, 1, 6, 1, 4, 1, 5, 2, 2, 3, 2,
+    3, 4, 9, 2, 10, 3, 7, 2, 4, 4, 1, 0,
+    2, 6, 1, 0, 1, 2, 0, 4, 0, 1, 0, 0,
+    2, 2, 0, 1, 3, 1, 2, 2, 3, 2, 2, 4,
+    6, 9, 2, 6, 2, 2, 5, 1, 3, 1, 1, 1,
+    1, 0, 2, 0, 1, 2, 1, 3, 2, 3, 6, 2,
+    2, 0, 0, 4,
+};
+
+static const unsigned short entity_hash_slots[ENTITY_HASH_SLOTS] = {
+    0, 842, 0, 0, 0, 184, 0, 1387, 2065, 625, 1238, 798,
+    0, 658, 0, 0, 0, 0, 0, 490, 0, 1088, 466, 0,
+    0, 945, 1348, 0, 0, 0, 2037, 0, 0, 851, 478, 0,
+    0, 0, 0, 2025, 1526, 982, 1808, 0, 752, 0, 0, 0,
+    2007, 0, 0, 1424, 0, 2012, 0, 0, 0, 0, 956, 0,
+    682, 0, 0, 0, 369, 0, 1869, 1987, 641, 0, 0, 1212,
+    0, 0, 0, 1710, 0, 965, 0, 1333, 398, 1219, 0, 1438,
+    0, 0, 0, 2220, 0, 831, 2155, 0, 1247, 1742, 0, 0,
+    0, 0, 348, 176, 0, 0, 0, 26, 0, 0, 1239, 284,
+    0, 0, 0, 0, 2128, 0, 0, 813, 1385, 0, 1384, 0,
+    1393, 1094, 772, 0, 1188, 0, 1046, 744, 0, 190, 1662, 112,
+    0, 1442, 0, 0, 1851, 0, 1955, 1303, 0, 0, 765, 0,
+    840, 1914, 1307, 0, 0, 679, 1552, 1124, 1559, 0, 0, 0,
+    775, 0, 0, 0, 0, 0, 395, 0, 1177, 159, 1805, 612,
+    960, 562, 1292, 0, 1133, 122, 0, 273, 1280, 675, 92, 267,
+    0, 1372, 1211, 0, 2132, 1645, 1977, 2049, 0, 0, 1149, 0,
+    816, 1514, 0, 1251, 0, 0, 0, 0, 1221, 85, 691, 726,
+    1657, 0, 312, 0, 1918, 0, 0, 0, 0, 0, 0, 1395,
+    2178, 1077, 666, 0, 1680, 0, 1226, 1589, 494, 0, 0, 0,
+    2222, 0, 1528, 0, 0, 1484, 0, 921, 473, 0, 532, 879,
+    2059, 0, 1577, 0, 0, 0, 1588, 1529, 565, 0, 2212, 0,
+    0, 0, 1670, 0, 0, 0, 1551, 158, 1230, 0, 0, 1207,
+    0, 0, 2161, 0, 1030, 1831, 0, 0, 0, 0, 0, 2057,
+    0, 1622, 0, 1389, 247, 2160, 0, 191, 0, 1100, 0, 0,
+    199, 1345, 753, 0, 0, 1440, 0, 2116, 1079, 1011, 0, 985,
+    1993, 1252, 1056, 475, 743, 387, 731, 1774, 0, 0, 1503, 0,
+    0, 0, 1724, 0, 11, 1784, 0, 804, 0, 0, 2111, 1610,
+    1799, 4, 995, 1747, 0, 0, 2148, 1489, 2221, 0, 1557, 0,
+    0, 1938, 0, 0, 1003, 0, 0, 0, 0, 0, 69, 818,
+    0, 0, 0, 1667, 1144, 2104, 1184, 0, 1587, 1131, 1039, 28,
+    0, 0, 310, 271, 249, 0, 0, 1753, 1585, 706, 1715, 0,
+    0, 694, 0, 0, 431, 0, 1008, 0, 0, 141, 0, 498,
+    519, 0, 0, 2083, 2152, 0, 252, 1032, 0, 0, 1624, 1607,
+    96, 0, 0, 0, 471, 0, 1854, 570, 0, 0, 0, 0,
+    0, 137, 0, 0, 0, 0, 954, 1314, 0, 936, 827, 189,
+    0, 1852, 0, 124, 0, 0, 0, 0, 0, 575, 1929, 0,
+    1974, 1038, 1916, 1170, 1376, 1909, 0, 0, 961, 1156, 2048, 947,
+    0, 441, 0, 1765, 741, 1183, 0, 0, 1483, 0, 2165, 0,
+    0, 1167, 503, 0, 1882, 2167, 1458, 0, 0, 0, 259, 0,
+    1886, 0, 210, 0, 0, 0, 0, 0, 2078, 2107, 97, 0,
+    0, 1637, 1903, 0, 0, 0, 0, 0, 0, 539, 1937, 0,
+    1639, 1114, 281, 1187, 331, 1352, 0, 0, 1132, 1535, 0, 1460,
+    0, 0, 999, 0, 421, 1821, 1669, 48, 0, 49, 2175, 0,
+    2129, 0, 1076, 1086, 0, 0, 0, 0, 0, 270, 52, 0,
+    315, 0, 0, 89, 728, 1545, 326, 0, 1306, 1160, 0, 0,
+    1477, 0, 0, 550, 0, 0, 916, 2088, 1414, 1235, 0, 0,
+    0, 704, 244, 0, 0, 0, 0, 1284, 841, 1172, 0, 0,
+    1502, 2210, 0, 0, 0, 1053, 593, 2054, 0, 0, 0, 0,
+    0, 76, 1047, 0, 0, 0, 0, 204, 1456, 0, 0, 1921,
+    1040, 0, 0, 293, 1165, 600, 0, 583, 314, 0, 517, 1487,
+    134, 1334, 0, 125, 142, 0, 1523, 147, 373, 931, 0, 518,
+    298, 2137, 686, 0, 0, 0, 0, 1257, 0, 1791, 0, 972,
+    0, 0, 2207, 2190, 0, 0, 1910, 0, 2005, 1632, 0, 803,
+    0, 0, 0, 1543, 1666, 185, 1443, 0, 760, 0, 0, 1270,
+    0, 0, 0, 20, 0, 2149, 0, 838, 358, 1684, 0, 1001,
+    1296, 0, 0, 427, 520, 708, 2193, 0, 0, 0, 0, 778,
+    1836, 0, 0, 1000, 115, 0, 0, 1542, 0, 817, 1626, 720,
+    0, 0, 2022, 335, 0, 77, 0, 0, 0, 30, 1255, 734,
+    444, 0, 1427, 0, 239, 0, 2125, 1663, 1421, 0, 1995, 0,
+    1692, 0, 0, 0, 0, 1042, 909, 0, 0, 0, 1005, 0,
+    0, 513, 287, 0, 291, 0, 1556, 630, 2070, 1337, 1820, 0,
+    1864, 0, 1900, 1196, 1078, 1641, 0, 0, 0, 966, 2117, 0,
+    0, 0, 100, 14, 0, 953, 108, 0, 0, 1423, 0, 256,
+    663, 0, 1145, 1243, 1493, 1653, 0, 0, 0, 0, 0, 0,
+    793, 0, 0, 0, 0, 0, 0, 381, 0, 1576, 0, 1795,
+    2000, 0, 0, 419, 1672, 372, 977, 457, 797, 0, 88, 0,
+    1013, 0, 0, 809, 288, 0, 90, 0, 0, 1553, 1899, 0,
+    0, 2171, 1971, 44, 2001, 1434, 0, 0, 182, 0, 0, 1022,
+    317, 0, 417, 0, 385, 1417, 0, 577, 0, 1043, 0, 0,
+    447, 585, 1263, 389, 0, 0, 1250, 238, 0, 536, 0, 1262,
+    123, 0, 1541, 1142, 713, 0, 2150, 1628, 0, 0, 2196, 487,
+    2101, 0, 1354, 2138, 0, 0, 0, 2134, 352, 1579, 0, 353,
+    1850, 0, 1697, 1369, 525, 38, 0, 1127, 0, 143, 0, 1063,
+    0, 1186, 791, 196, 0, 1892, 0, 0, 0, 1431, 0, 0,
+    0, 0, 127, 0, 2228, 0, 1261, 0, 0, 1789, 1826, 0,
+    1194, 1353, 0, 0, 0, 662, 1870, 1699, 1394, 0, 0, 1844,
+    1631, 1179, 0, 572, 661, 0, 0, 1817, 0, 1572, 620, 0,
+    526, 65, 788, 451, 0, 614, 1174, 0, 53, 1912, 1782, 0,
+    0, 1614, 1162, 0, 1997, 450, 2018, 0, 522, 0, 0, 699,
+    223, 755, 344, 455, 0, 0, 286, 1586, 0, 680, 1618, 0,
+    2034, 1448, 1495, 0, 0, 1846, 602, 362, 0, 563, 918, 849,
+    332, 1777, 0, 1234, 0, 0, 0, 1104, 0, 0, 1027, 1633,
+    1560, 1245, 1894, 232, 66, 721, 0, 1192, 1231, 1635, 705, 1498,
+    0, 0, 0, 0, 0, 0, 1136, 807, 1738, 0, 0, 1400,
+    0, 2177, 0, 0, 0, 3, 2186, 2015, 2192, 0, 0, 0,
+    17, 222, 0, 1956, 0, 555, 0, 913, 0, 0, 1178, 0,
+    1010, 767, 1744, 1940, 869, 0, 0, 1527, 805, 309, 0, 1476,
+    2008, 236, 31, 1285, 0, 1464, 1825, 0, 0, 1015, 1982, 1839,
+    0, 0, 0, 118, 0, 0, 0, 534, 1129, 640, 0, 627,
+    2135, 0, 0, 0, 582, 0, 875, 1934, 1054, 0, 0, 1853,
+    1729, 1958, 0, 523, 687, 1665, 0, 2216, 347, 511, 2089, 0,
+    6, 306, 135, 1922, 0, 0, 1913, 0, 0, 0, 13, 0,
+    891, 1930, 2053, 783, 454, 0, 1896, 0, 613, 0, 0, 888,
+    907, 0, 1193, 183, 0, 833, 164, 799, 285, 0, 1419, 1564,
+    871, 0, 438, 0, 1611, 881, 716, 1403, 0, 0, 1754, 2073,
+    1964, 0, 0, 432, 0, 591, 524, 0, 0, 1173, 0, 962,
+    0, 0, 0, 2195, 1980, 0, 1708, 354, 1681, 2100, 0, 0,
+    1984, 0, 0, 0, 0, 1318, 0, 0, 1848, 0, 1361, 1718,
+    1814, 0, 0, 924, 491, 0, 0, 0, 657, 0, 63, 0,
+    55, 0, 1793, 584, 0, 0, 2066, 0, 0, 0, 1931, 0,
+    1813, 0, 1119, 0, 0, 0, 2188, 0, 0, 414, 0, 0,
+    0, 0, 0, 0, 0, 1012, 1351, 1957, 8, 0, 0, 0,
+    1763, 1319, 0, 0, 1224, 1317, 43, 890, 1267, 580, 0, 1936,
+    1335, 0, 1733, 0, 0, 1781, 1291, 0, 0, 0, 0, 0,
+    0, 56, 0, 0, 1863, 1823, 0, 0, 0, 1412, 970, 0,
+    1748, 0, 1168, 0, 0, 1058, 0, 1060, 1843, 0, 0, 1651,
+    0, 929, 0, 0, 474, 1016, 1643, 0, 1413, 0, 0, 0,
+    1113, 1428, 1087, 0, 1166, 0, 2042, 0, 1195, 368, 75, 857,
+    1152, 904, 2230, 1469, 1630, 509, 338, 0, 206, 1690, 1544, 1294,
+    628, 0, 0, 2074, 0, 0, 0, 445, 1002, 0, 408, 0,
+    1565, 1336, 2225, 0, 0, 0, 355, 951, 589, 0, 212, 2121,
+    0, 0, 971, 258, 420, 0, 0, 0, 893, 0, 1137, 0,
+    2094, 1409, 559, 0, 0, 0, 1696, 1432, 0, 1518, 1095, 1213,
+    0, 0, 0, 1154, 2106, 656, 0, 1604, 0, 0, 1034, 1563,
+    0, 747, 0, 1358, 1819, 2141, 629, 2223, 759, 1349, 0, 462,
+    0, 0, 60, 0, 717, 0, 0, 1942, 0, 425, 2200, 0,
+    2061, 0, 1018, 2156, 250, 1067, 1069, 0, 1719, 231, 0, 0,
+    412, 0, 0, 0, 0, 2097, 1331, 83, 1654, 664, 901, 361,
+    0, 0, 0, 0, 0, 0, 1256, 59, 1755, 1216, 0, 320,
+    1727, 0, 0, 0, 676, 146, 0, 0, 0, 0, 1890, 2090,
+    1300, 0, 1471, 0, 886, 0, 0, 0, 0, 1965, 0, 0,
+    0, 1794, 0, 0, 0, 0, 1809, 0, 0, 0, 611, 669,
+    0, 1804, 1522, 1907, 0, 377, 380, 0, 1214, 0, 0, 1279,
+    1741, 2091, 23, 2144, 1377, 0, 1951, 2131, 0, 836, 0, 0,
+    0, 0, 1992, 0, 0, 1898, 0, 771, 393, 1386, 0, 0,
+    0, 1462, 411, 681, 515, 0, 1445, 0, 810, 0, 51, 843,
+    1441, 0, 0, 430, 1591, 1726, 1402, 0, 0, 1968, 0, 0,
+    1480, 586, 2115, 1357, 428, 1829, 974, 558, 0, 0, 0, 0,
+    1276, 1642, 1935, 308, 0, 0, 0, 948, 16, 0, 1772, 0,
+    180, 0, 0, 1286, 0, 1760, 903, 1787, 219, 0, 1830, 0,
+    0, 0, 578, 449, 2123, 1959, 42, 1723, 0, 730, 1525, 1969,
+    1845, 46, 0, 0, 2166, 1573, 0, 0, 773, 0, 820, 819,
+    0, 0, 1379, 588, 0, 0, 1169, 2044, 0, 400, 0, 604,
+    1233, 928, 592, 1254, 350, 0, 0, 0, 0, 0, 169, 197,
+    0, 0, 1339, 850, 0, 0, 203, 549, 0, 0, 0, 873,
+    0, 0, 0, 0, 0, 1875, 1677, 1735, 0, 1757, 0, 501,
+    553, 0, 0, 1849, 0, 426, 1549, 1531, 0, 0, 0, 0,
+    1762, 0, 98, 333, 0, 1998, 133, 2203, 2109, 0, 0, 1023,
+    0, 0, 0, 557, 0, 0, 646, 465, 1051, 802, 1634, 1598,
+    0, 0, 0, 179, 0, 1045, 33, 0, 2157, 567, 116, 1444,
+    1902, 148, 0, 0, 1298, 742, 811, 1277, 166, 0, 0, 460,
+    1595, 452, 1125, 0, 0, 0, 0, 2023, 0, 0, 1915, 0,
+    7, 0, 0, 544, 546, 0, 792, 0, 0, 1919, 0, 0,
+    0, 872, 0, 0, 0, 99, 650, 2227, 1240, 1271, 0, 986,
+    1671, 0, 1312, 0, 1146, 1975, 784, 745, 1201, 1802, 111, 0,
+    1031, 0, 0, 221, 0, 1490, 0, 302, 0, 703, 1288, 0,
+    1454, 1676, 193, 0, 1151, 1650, 1939, 0, 2002, 0, 569, 397,
+    0, 0, 0, 0, 0, 853, 938, 647, 1877, 1388, 944, 216,
+    0, 1788, 156, 2205, 601, 0, 1608, 0, 1803, 1574, 0, 0,
+    2031, 1439, 275, 0, 0, 0, 1150, 0, 2063, 0, 0, 0,
+    263, 1790, 399, 1655, 0, 0, 0, 0, 0, 0, 0, 1605,
+    1468, 79, 0, 2179, 1842, 0, 0, 0, 0, 274, 144, 1491,
+    1466, 623, 472, 0, 1274, 0, 0, 0, 2016, 860, 0, 1290,
+    2026, 1381, 579, 266, 0, 0, 0, 1837, 0, 0, 740, 0,
+    1778, 0, 1504, 1538, 0, 404, 95, 689, 0, 1486, 0, 0,
+    0, 1698, 0, 289, 2047, 1282, 1368, 0, 1072, 1661, 0, 0,
+    1452, 1210, 2142, 0, 0, 145, 598, 615, 500, 0, 0, 440,
+    0, 1590, 2146, 859, 2014, 0, 1835, 1343, 1967, 0, 269, 0,
+    497, 0, 0, 2038, 943, 1536, 0, 0, 228, 1859, 0, 0,
+    0, 2110, 0, 2085, 1297, 151, 0, 1365, 0, 1181, 764, 36,
+    0, 301, 0, 0, 486, 0, 0, 0, 2010, 1986, 1664, 1889,
+    0, 456, 0, 897, 551, 1796, 2098, 1575, 1029, 1769, 1313, 1059,
+    0, 0, 0, 0, 882, 0, 542, 0, 527, 0, 1171, 1326,
+    0, 1966, 2064, 336, 0, 0, 2055, 1683, 1437, 1329, 0, 1147,
+    0, 2191, 0, 0, 996, 1158, 925, 0, 1994, 0, 1812, 0,
+    1496, 150, 2093, 0, 0, 0, 1675, 1130, 0, 0, 1561, 781,
+    0, 987, 715, 1832, 898, 0, 2180, 1436, 698, 168, 18, 0,
+    0, 0, 209, 0, 0, 1328, 0, 0, 337, 62, 1155, 0,
+    0, 0, 0, 1433, 0, 1695, 0, 0, 468, 2095, 0, 692,
+    0, 272, 0, 1482, 0, 0, 0, 1264, 0, 651, 318, 220,
+    0, 458, 1473, 0, 1752, 0, 0, 0, 50, 0, 1176, 0,
+    0, 136, 0, 673, 1749, 2159, 0, 54, 0, 722, 0, 0,
+    0, 0, 0, 0, 342, 0, 129, 2020, 1295, 0, 237, 1999,
+    0, 1049, 1061, 0, 0, 245, 0, 300, 2211, 1123, 0, 2086,
+    0, 505, 845, 0, 0, 0, 0, 1246, 0, 514, 1362, 0,
+    1660, 0, 0, 725, 848, 0, 0, 0, 0, 0, 1597, 1080,
+    0, 0, 0, 1731, 0, 0, 2217, 688, 0, 155, 1834, 0,
+    1408, 608, 0, 0, 2079, 900, 0, 969, 0, 737, 1515, 0,
+    1636, 1175, 0, 0, 883, 0, 1237, 0, 0, 1792, 0, 406,
+    67, 1106, 504, 0, 946, 0, 609, 0, 0, 0, 437, 0,
+    0, 2081, 0, 0, 545, 0, 254, 0, 2147, 1071, 1203, 529,
+    413, 991, 0, 738, 941, 0, 994, 832, 0, 0, 1223, 0,
+    0, 1640, 0, 0, 0, 1225, 2039, 1426, 1740, 0, 0, 0,
+    0, 0, 1014, 1085, 0, 1973, 0, 130, 1901, 0, 654, 566,
+    0, 257, 0, 0, 0, 78, 0, 1244, 0, 1344, 0, 671,
+    170, 376, 0, 2151, 0, 0, 672, 0, 839, 908, 0, 727,
+    47, 1459, 0, 172, 1463, 2021, 0, 0, 0, 693, 1228, 241,
+    0, 1554, 0, 821, 1600, 975, 0, 1810, 964, 0, 776, 1566,
+    1580, 0, 0, 1083, 0, 1786, 2214, 1970, 0, 683, 0, 0,
+    0, 0, 830, 0, 1082, 766, 0, 0, 942, 0, 1801, 0,
+    0, 384, 80, 1447, 0, 434, 0, 0, 1861, 0, 2032, 1278,
+    510, 410, 1366, 464, 0, 750, 1074, 1266, 2170, 1571, 229, 1429,
+    0, 39, 0, 1779, 154, 0, 0, 363, 0, 58, 371, 0,
+    2130, 1406, 502, 0, 2143, 403, 2162, 0, 0, 1871, 0, 1451,
+    1461, 0, 192, 2077, 489, 407, 0, 1548, 2071, 0, 213, 113,
+    0, 0, 1533, 0, 0, 0, 1732, 0, 1583, 0, 932, 0,
+    618, 0, 1327, 1330, 595, 469, 2009, 1629, 786, 0, 1721, 1928,
+    0, 0, 0, 177, 0, 0, 1855, 1268, 0, 587, 0, 0,
+    568, 2218, 484, 0, 1798, 442, 0, 0, 0, 1036, 937, 949,
+    0, 2187, 2154, 2153, 1287, 0, 2231, 2174, 2046, 0, 0, 0,
+    0, 0, 1908, 1659, 0, 0, 769, 0, 0, 367, 0, 0,
+    0, 1, 596, 2051, 1947, 1418, 0, 1603, 1373, 0, 364, 0,
+    0, 0, 1355, 861, 874, 1746, 0, 1305, 268, 0, 346, 1644,
+    922, 235, 0, 0, 2124, 0, 1164, 920, 0, 1249, 1702, 735,
+    386, 538, 0, 479, 2199, 1241, 0, 1785, 1687, 416, 1705, 1868,
+    0, 1035, 0, 983, 0, 1220, 0, 2076, 0, 0, 906, 121,
+    0, 2206, 0, 0, 0, 1840, 2215, 0, 642, 0, 1320, 1397,
+    0, 0, 1260, 0, 794, 0, 1449, 0, 0, 0, 2003, 0,
+    0, 0, 1232, 535, 409, 754, 632, 617, 0, 0, 1739, 0,
+    1163, 1736, 0, 0, 619, 2019, 0, 0, 448, 429, 0, 710,
+    117, 1478, 0, 401, 1685, 0, 0, 0, 0, 1479, 0, 0,
+    0, 1102, 0, 0, 998, 2, 0, 854, 0, 2060, 0, 808,
+    214, 0, 0, 0, 0, 1229, 0, 1025, 0, 1924, 800, 0,
+    0, 0, 0, 321, 0, 0, 0, 1341, 0, 2208, 34, 0,
+    0, 0, 0, 655, 1711, 64, 0, 0, 790, 0, 0, 0,
+    1720, 1450, 1310, 329, 0, 0, 482, 0, 1342, 1378, 2084, 0,
+    0, 1707, 1222, 571, 0, 0, 1540, 341, 1764, 160, 0, 530,
+    0, 0, 1534, 0, 0, 0, 1745, 0, 2011, 758, 0, 0,
+    0, 114, 967, 762, 1775, 1099, 0, 73, 0, 702, 1925, 1768,
+    0, 0, 1828, 1026, 714, 103, 0, 1601, 0, 0, 0, 984,
+    0, 0, 27, 733, 0, 1581, 1508, 0, 0, 1374, 0, 0,
+    255, 963, 1807, 101, 0, 1269, 1885, 1275, 265, 374, 1019, 0,
+    868, 746, 0, 1716, 0, 1766, 1481, 621, 0, 0, 0, 2158,
+    0, 0, 1007, 1128, 1962, 774, 0, 541, 294, 0, 0, 914,
+    2075, 375, 261, 1006, 822, 0, 1954, 359, 1338, 0, 0, 0,
+    1121, 0, 2068, 0, 0, 711, 1048, 0, 0, 0, 1324, 0,
+    0, 1770, 1658, 0, 211, 0, 2119, 1879, 1904, 2118, 695, 1516,
+    0, 0, 1701, 1881, 495, 1096, 2169, 1383, 0, 547, 467, 1380,
+    1242, 0, 0, 305, 2087, 0, 1833, 1933, 0, 0, 2102, 1004,
+    0, 605, 2189, 0, 1713, 105, 0, 0, 102, 1978, 339, 2219,
+    1728, 0, 2092, 0, 188, 976, 0, 0, 0, 0, 0, 1704,
+    0, 405, 919, 0, 1382, 0, 0, 1509, 264, 1115, 0, 1405,
+    0, 1673, 1952, 0, 0, 2202, 162, 779, 0, 0, 980, 2136,
+    1592, 993, 0, 1422, 1816, 0, 0, 0, 0, 0, 1988, 107,
+    0, 0, 0, 40, 2114, 1615, 2069, 870, 0, 1492, 0, 0,
+    0, 1159, 0, 396, 643, 0, 576, 139, 0, 0, 1420, 0,
+    1714, 290, 1867, 0, 0, 0, 1638, 0, 0, 0, 0, 0,
+    2176, 0, 639, 0, 1709, 690, 226, 0, 0, 930, 0, 370,
+    0, 1472, 0, 0, 1865, 402, 0, 981, 392, 0, 915, 0,
+    1360, 0, 0, 0, 1895, 0, 0, 789, 0, 1153, 823, 0,
+    0, 1017, 0, 2108, 0, 528, 0, 824, 496, 1613, 1215, 1991,
+    0, 1359, 0, 0, 2168, 0, 1375, 0, 933, 443, 1678, 1510,
+    0, 825, 307, 0, 453, 0, 0, 782, 0, 1236, 1265, 0,
+    0, 1524, 554, 132, 0, 0, 0, 0, 0, 0, 94, 260,
+    0, 390, 2122, 1649, 2184, 0, 1111, 1392, 0, 0, 1401, 0,
+    81, 0, 276, 768, 1350, 1182, 0, 1606, 0, 0, 295, 0,
+    383, 852, 1202, 0, 1064, 1055, 0, 394, 1627, 0, 0, 636,
+    2103, 0, 1906, 251, 0, 0, 109, 862, 128, 0, 198, 253,
+    9, 1189, 0, 2045, 0, 0, 0, 0, 990, 0, 624, 365,
+    1593, 0, 0, 0, 531, 68, 2058, 1108, 1857, 1686, 0, 0,
+    1140, 0, 243, 1139, 24, 1818, 0, 1041, 1135, 0, 677, 0,
+    537, 248, 0, 1304, 826, 952, 167, 0, 2062, 0, 2126, 0,
+    0, 70, 0, 1963, 2201, 0, 723, 684, 1948, 1143, 1513, 0,
+    0, 481, 153, 988, 979, 0, 1887, 0, 0, 560, 0, 0,
+    0, 709, 1883, 0, 470, 72, 1138, 0, 1725, 0, 867, 0,
+    1612, 0, 0, 0, 973, 1363, 0, 0, 483, 0, 597, 0,
+    955, 1322, 0, 0, 0, 0, 0, 1946, 1098, 0, 1311, 0,
+    1090, 2226, 1596, 0, 543, 1148, 0, 0, 573, 194, 1941, 0,
+    1625, 0, 2204, 634, 0, 0, 0, 0, 696, 1075, 0, 939,
+    224, 1594, 0, 0, 0, 0, 0, 1191, 0, 2164, 0, 0,
+    1227, 0, 644, 777, 340, 1157, 0, 0, 0, 1761, 1944, 0,
+    835, 637, 0, 0, 433, 1488, 0, 2229, 1570, 0, 1824, 0,
+    0, 106, 0, 0, 1884, 665, 0, 0, 828, 0, 0, 366,
+    866, 674, 0, 0, 1961, 0, 1118, 0, 940, 423, 0, 1092,
+    2041, 0, 0, 1703, 0, 0, 2056, 0, 958, 0, 736, 0,
+    25, 610, 0, 1985, 1578, 2224, 0, 1656, 0, 187, 242, 0,
+    1712, 313, 0, 278, 0, 140, 1289, 556, 1679, 0, 0, 507,
+    330, 0, 0, 0, 1200, 0, 1475, 2033, 0, 87, 0, 552,
+    0, 0, 1081, 0, 1197, 0, 887, 0, 763, 2213, 770, 0,
+    896, 1391, 1407, 2030, 815, 0, 19, 0, 303, 0, 0, 0,
+    0, 2112, 0, 1415, 0, 0, 0, 1248, 1537, 0, 304, 0,
+    0, 0, 0, 1911, 0, 594, 1134, 0, 382, 0, 0, 0,
+    0, 0, 0, 418, 1321, 1024, 0, 1822, 1020, 0, 0, 1066,
+    1455, 1878, 1990, 0, 120, 0, 1569, 2099, 41, 0, 296, 1398,
+    0, 0, 0, 0, 1876, 1301, 905, 712, 378, 1470, 360, 1302,
+    631, 877, 334, 435, 0, 233, 645, 0, 1097, 1091, 667, 707,
+    0, 0, 0, 0, 1722, 1920, 934, 0, 0, 0, 1396, 485,
+    1530, 1217, 0, 0, 2043, 325, 5, 561, 0, 0, 0, 0,
+    0, 0, 1511, 0, 2139, 61, 1756, 2067, 0, 0, 0, 0,
+    0, 0, 2163, 0, 0, 436, 1873, 0, 911, 1972, 1800, 0,
+    1694, 207, 0, 564, 0, 178, 638, 2027, 2035, 1205, 0, 0,
+    0, 806, 0, 1647, 1309, 1584, 0, 718, 0, 328, 633, 0,
+    299, 1062, 1623, 0, 0, 581, 0, 0, 1872, 0, 2185, 2197,
+    57, 2040, 1308, 0, 0, 246, 884, 0, 0, 1103, 1370, 0,
+    1621, 1905, 2004, 104, 0, 0, 0, 0, 0, 0, 1520, 1532,
+    0, 0, 0, 0, 0, 0, 29, 1691, 0, 311, 0, 461,
+    0, 1567, 0, 424, 1847, 508, 0, 2113, 1558, 0, 1767, 459,
+    1688, 262, 0, 71, 1499, 1371, 0, 0, 0, 1858, 0, 1771,
+    0, 1073, 0, 225, 0, 670, 812, 163, 208, 834, 0, 0,
+    0, 1037, 2172, 138, 157, 1209, 0, 957, 0, 1981, 327, 0,
+    0, 0, 0, 0, 93, 439, 1198, 660, 0, 0, 0, 0,
+    1065, 1316, 0, 899, 739, 1161, 0, 0, 1116, 2017, 0, 201,
+    0, 0, 2105, 1547, 1815, 0, 0, 1323, 616, 603, 2036, 0,
+    0, 0, 0, 1652, 0, 912, 0, 1107, 0, 126, 0, 0,
+    0, 1346, 1996, 0, 1089, 1112, 175, 0, 0, 635, 0, 0,
+    1457, 0, 2140, 292, 1084, 1743, 1609, 0, 12, 622, 1780, 0,
+    1539, 2072, 863, 1521, 0, 0, 521, 1943, 761, 1258, 1751, 0,
+    1674, 0, 0, 1506, 0, 0, 814, 1783, 892, 0, 864, 1347,
+    323, 0, 297, 1874, 0, 1364, 0, 1734, 1068, 0, 45, 2096,
+    917, 1546, 0, 0, 1750, 1519, 0, 0, 324, 0, 0, 0,
+    574, 1206, 379, 488, 1517, 282, 1700, 0, 0, 0, 865, 1052,
+    0, 279, 0, 0, 700, 0, 0, 506, 0, 0, 0, 1325,
+    0, 923, 0, 0, 0, 202, 0, 1109, 0, 1204, 0, 0,
+    0, 959, 0, 0, 2029, 0, 22, 322, 1272, 0, 0, 1416,
+    0, 607, 659, 149, 701, 0, 2209, 0, 0, 205, 493, 0,
+    2182, 1141, 388, 0, 351, 0, 1599, 2052, 880, 343, 0, 0,
+    0, 0, 749, 1126, 0, 0, 0, 316, 0, 21, 0, 902,
+    1706, 0, 186, 0, 0, 0, 2173, 847, 846, 0, 152, 0,
+    1410, 1932, 234, 0, 0, 878, 0, 685, 0, 1404, 2133, 2183,
+    1602, 0, 1619, 0, 0, 1717, 0, 0, 2028, 1512, 215, 1494,
+    0, 0, 1923, 0, 165, 1500, 0, 1190, 0, 0, 0, 1582,
+    110, 780, 0, 1620, 1617, 0, 1180, 648, 724, 0, 0, 1199,
+    283, 0, 1273, 1507, 1028, 1811, 2194, 0, 1021, 0, 1101, 0,
+    356, 0, 0, 1033, 0, 0, 0, 1281, 0, 0, 732, 0,
+    37, 1862, 0, 0, 1356, 548, 795, 0, 240, 1897, 357, 0,
+    626, 0, 0, 0, 0, 1332, 606, 997, 0, 0, 935, 1253,
+    1693, 533, 0, 0, 0, 0, 415, 856, 422, 1806, 1283, 0,
+    0, 649, 1668, 0, 796, 0, 277, 0, 0, 1689, 0, 0,
+    1185, 1009, 1838, 0, 0, 894, 0, 748, 0, 0, 0, 2145,
+    0, 0, 131, 668, 1497, 15, 0, 0, 0, 480, 1259, 1474,
+    0, 0, 1960, 1501, 0, 1776, 0, 0, 1979, 0, 829, 1950,
+    0, 86, 0, 0, 0, 1315, 1117, 0, 0, 2024, 1827, 0,
+    0, 0, 729, 0, 2050, 0, 0, 0, 0, 801, 1050, 0,
+    2120, 0, 1949, 0, 2013, 512, 2082, 1485, 540, 876, 1105, 0,
+    0, 1044, 1983, 119, 1110, 989, 1759, 0, 200, 0, 0, 0,
+    756, 0, 0, 1299, 968, 1218, 2198, 0, 0, 1340, 0, 0,
+    0, 0, 1953, 499, 0, 0, 0, 844, 1430, 889, 1917, 0,
+    2181, 0, 0, 0, 349, 1446, 0, 0, 1293, 1893, 0, 35,
+    855, 1856, 195, 785, 345, 0, 1976, 1927, 476, 217, 697, 0,
+    0, 1467, 1646, 1120, 84, 950, 0, 1682, 0, 1730, 74, 1435,
+    0, 181, 0, 0, 91, 0, 678, 0, 0, 0, 10, 0,
+    2127, 0, 0, 0, 0, 0, 173, 1208, 2080, 1616, 751, 0,
+    0, 0, 174, 719, 0, 32, 0, 0, 0, 0, 1465, 1841,
+    82, 0, 0, 926, 1891, 218, 492, 1866, 1945, 885, 1888, 0,
+    1648, 0, 0, 1411, 837, 0, 653, 0, 1070, 1550, 1505, 391,
+    927, 0, 910, 0, 230, 1926, 0, 0, 0, 1390, 1093, 463,
+    0, 0, 1860, 1880, 0, 1555, 0, 161, 992, 0, 1737, 858,
+    0, 0, 1989, 599, 516, 477, 0, 1797, 0, 0, 2006, 446,
+    0, 0, 1562, 171, 0, 1399, 1057, 652, 0, 895, 0, 0,
+    1122, 280, 1367, 0, 0, 0, 1758, 787, 0, 1425, 0, 0,
+    1453, 757, 0, 978, 0, 1773, 319, 227, 0, 1568, 0, 590,
+    0, 0, 0, 0,
+};
@@ -0,0 +1,318 @@
+#include "flat_dom.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const DomNode* node;
+    uint32_t index;
+} WalkEntry;
+
+// Pre-order walk shared by the counting and the filling pass.
+typedef struct {
+    WalkEntry* stack;
+    int depth;
+    int capacity;
+} Walk;
+
+static void walk_push(Walk* walk, const DomNode* node, uint32_t index) {
+    if (walk->depth == walk->capacity) {
+        walk->capacity = walk->capacity ? walk->capacity * 2 : 64;
+        WalkEntry* grown = (WalkEntry*)realloc(walk->stack, walk->capacity * sizeof(WalkEntry));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        walk->stack = grown;
+    }
+    walk->stack[walk->depth].node = node;
+    walk->stack[walk->depth].index = index;
+    walk->depth++;
+}
+
+// Offsets of names already written, so each atom's name is stored once.
+typedef struct {
+    uint32_t* offsets;   // indexed by atom, 0 = not written yet
+    int capacity;
+} NameCache;
+
+static uint32_t* name_slot(NameCache* cache, Atom atom) {
+    if (atom <= ATOM_NONE) {
+        return NULL;
+    }
+    if (atom >= cache->capacity) {
+        int capacity = cache->capacity ? cache->capacity : ATOM_STATIC_COUNT * 2;
+        while (capacity <= atom) {
+            capacity *= 2;
+        }
+        uint32_t* grown = (uint32_t*)realloc(cache->offsets, capacity * sizeof(uint32_t));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        memset(grown + cache->capacity, 0, (capacity - cache->capacity) * sizeof(uint32_t));
+        cache->offsets = grown;
+        cache->capacity = capacity;
+    }
+    return &cache->offsets[atom];
+}
+
+typedef struct {
+    FlatDocument* flat;     // NULL during the counting pass
+    NameCache names;
+    uint32_t nodes;
+    uint32_t attrs;
+    uint32_t bytes;
+} Flattener;
+
+static uint32_t add_string(Flattener* f, const char* s) {
+    uint32_t offset = f->bytes;
+    size_t length = strlen(s) + 1;
+    if (f->flat) {
+        memcpy(f->flat->strings + offset, s, length);
+    }
+    f->bytes += (uint32_t)length;
+    return offset;
+}
+
+// Name strings are shared per atom; offset + 1 is cached so 0 means unset.
+static uint32_t add_name(Flattener* f, Atom atom, const char* name) {
+    uint32_t* slot = name_slot(&f->names, atom);
+    if (slot && *slot) {
+        return *slot - 1;
+    }
+    uint32_t offset = add_string(f, name);
+    if (slot) {
+        *slot = offset + 1;
+    }
+    return offset;
+}
+
+// Dynamic atom ids only mean something in the AtomTable that made them;
+// the flat form (and so a snapshot) keeps just their names.
+static Atom portable_atom(Atom atom) {
+    return atom < ATOM_STATIC_COUNT ? atom : ATOM_NONE;
+}
+
+static uint32_t emit(Flattener* f, const DomNode* node, uint32_t parent) {
+    uint32_t index = f->nodes++;
+    FlatDocument* flat = f->flat;
+    if (flat) {
+        flat->types[index] = (uint8_t)node->type;
+        flat->atoms[index] = portable_atom(node->tag_atom);
+        flat->parents[index] = parent;
+        flat->attr_begins[index] = f->attrs;
+    }
+    uint32_t string_at = node->type == ELEMENT_NODE ? add_name(f, node->tag_atom, node->tag_name)
+                                                    : add_string(f, node->text_content);
+    if (flat) {
+        flat->strings_at[index] = string_at;
+    }
+    for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+        uint32_t name = add_name(f, attr->name_atom, attr->name);
+        uint32_t value = add_string(f, attr->value);
+        if (flat) {
+            flat->attr_atoms[f->attrs] = portable_atom(attr->name_atom);
+            flat->attr_names[f->attrs] = name;
+            flat->attr_values[f->attrs] = value;
+        }
+        f->attrs++;
+    }
+    return index;
+}
+
+static void flatten(Flattener* f, const DomNode* root) {
+    Walk walk = { NULL, 0, 0 };
+    const DomNode* node = root;
+    while (node != NULL) {
+        uint32_t parent = walk.depth > 0 ? walk.stack[walk.depth - 1].index : FLAT_NONE;
+        uint32_t index = emit(f, node, parent);
+        if (node->type == ELEMENT_NODE && node->first_child != NULL) {
+            walk_push(&walk, node, index);
+            node = node->first_child;
+            continue;
+        }
+        if (f->flat) {
+            f->flat->subtree_ends[index] = f->nodes;
+        }
+        while (walk.depth > 0 && node->next_sibling == NULL) {
+            WalkEntry* top = &walk.stack[--walk.depth];
+            node = top->node;
+            if (f->flat) {
+                f->flat->subtree_ends[top->index] = f->nodes;
+            }
+        }
+        node = walk.depth > 0 ? node->next_sibling : NULL;
+    }
+    free(walk.stack);
+}
+
+static size_t align_up(size_t offset) {
+    return (offset + 7) & ~(size_t)7;
+}
+
+// The 4-byte arrays first, then types and strings.
+size_t flat_layout(uint32_t node_count, uint32_t attr_count, uint32_t string_bytes,
+                   size_t offsets[FLAT_SECTIONS]) {
+    size_t nodes = node_count;
+    size_t attrs = attr_count;
+    size_t sizes[FLAT_SECTIONS] = {
+        nodes * sizeof(int32_t), nodes * sizeof(uint32_t), nodes * sizeof(uint32_t),
+        nodes * sizeof(uint32_t), (nodes + 1) * sizeof(uint32_t),
+        attrs * sizeof(int32_t), attrs * sizeof(uint32_t), attrs * sizeof(uint32_t),
+        nodes, string_bytes
+    };
+    size_t size = 0;
+    for (int i = 0; i < FLAT_SECTIONS; i++) {
+        offsets[i] = size;
+        size = align_up(size + sizes[i]);
+    }
+    return size;
+}
+
+void flat_bind(FlatDocument* flat, char* block, const size_t offsets[FLAT_SECTIONS]) {
+    flat->atoms = (int32_t*)(block + offsets[0]);
+    flat->parents = (uint32_t*)(block + offsets[1]);
+    flat->subtree_ends = (uint32_t*)(block + offsets[2]);
+    flat->strings_at = (uint32_t*)(block + offsets[3]);
+    flat->attr_begins = (uint32_t*)(block + offsets[4]);
+    flat->attr_atoms = (int32_t*)(block + offsets[5]);
+    flat->attr_names = (uint32_t*)(block + offsets[6]);
+    flat->attr_values = (uint32_t*)(block + offsets[7]);
+    flat->types = (uint8_t*)(block + offsets[8]);
+    flat->strings = block + offsets[9];
+}
+
+FlatDocument* flat_from_dom(const DomNode* root) {
+    if (root == NULL) {
+        return NULL;
+    }
+
+    Flattener f = { NULL, { NULL, 0 }, 0, 0, 0 };
+    flatten(&f, root);
+    uint32_t nodes = f.nodes;
+    uint32_t attrs = f.attrs;
+    uint32_t bytes = f.bytes;
+
+    size_t offsets[FLAT_SECTIONS];
+    size_t size = flat_layout(nodes, attrs, bytes, offsets);
+    char* block = (char*)safe_malloc(size ? size : 1);
+    // Snapshots write the block out whole: the alignment padding between
+    // the arrays must not carry stale heap bytes.
+    memset(block, 0, size);
+
+    FlatDocument* flat = (FlatDocument*)safe_malloc(sizeof(FlatDocument));
+    flat->node_count = nodes;
+    flat->attr_count = attrs;
+    flat->string_bytes = bytes;
+    flat_bind(flat, block, offsets);
+    flat->block = block;
+
+    f.flat = flat;
+    f.nodes = 0;
+    f.attrs = 0;
+    f.bytes = 0;
+    memset(f.names.offsets, 0, f.names.capacity * sizeof(uint32_t));
+    flatten(&f, root);
+    flat->attr_begins[nodes] = attrs;
+    free(f.names.offsets);
+    return flat;
+}
+
+void flat_free(FlatDocument* flat) {
+    if (flat) {
+        free(flat->block);
+        free(flat);
+    }
+}
+
+uint32_t flat_first_child(const FlatDocument* flat, uint32_t node) {
+    return flat->subtree_ends[node] > node + 1 ? node + 1 : FLAT_NONE;
+}
+
+uint32_t flat_next_sibling(const FlatDocument* flat, uint32_t node) {
+    uint32_t parent = flat->parents[node];
+    if (parent == FLAT_NONE) {
+        return FLAT_NONE;
+    }
+    uint32_t next = flat->subtree_ends[node];
+    return next < flat->subtree_ends[parent] ? next : FLAT_NONE;
+}
+
+const char* flat_node_string(const FlatDocument* flat, uint32_t node) {
+    return flat->strings + flat->strings_at[node];
+}
+
+const char* flat_attr_name(const FlatDocument* flat, uint32_t attr) {
+    return flat->strings + flat->attr_names[attr];
+}
+
+const char* flat_attr_value(const FlatDocument* flat, uint32_t attr) {
+    return flat->strings + flat->attr_values[attr];
+}
+
+const char* flat_get_attribute(const FlatDocument* flat, uint32_t node, const char* name) {
+    for (uint32_t a = flat->attr_begins[node]; a < flat->attr_begins[node + 1]; a++) {
+        if (strcmp(flat_attr_name(flat, a), name) == 0) {
+            return flat_attr_value(flat, a);
+        }
+    }
+    return NULL;
+}
+
+typedef struct {
+    uint32_t index;
+    DomNode* node;
+} BuildEntry;
+
+DomNode* flat_to_dom(const FlatDocument* flat) {
+    if (flat == NULL || flat->node_count == 0) {
+        return NULL;
+    }
+
+    DomDocument* doc = dom_document_create(flat_node_string(flat, 0));
+    BuildEntry* stack = (BuildEntry*)safe_malloc(64 * sizeof(BuildEntry));
+    int capacity = 64;
+    int depth = 0;
+
+    for (uint32_t i = 0; i < flat->node_count; i++) {
+        DomNode* node;
+        const char* s = flat_node_string(flat, i);
+        if (i == 0) {
+            node = &doc->root;
+        } else if (flat->types[i] == ELEMENT_NODE) {
+            node = document_create_element(doc, s, strlen(s));
+        } else {
+            node = document_create_text(doc, s, strlen(s));
+        }
+        for (uint32_t a = flat->attr_begins[i]; a < flat->attr_begins[i + 1]; a++) {
+            const char* name = flat_attr_name(flat, a);
+            const char* value = flat_attr_value(flat, a);
+            document_add_attribute(doc, node, name, strlen(name), value, strlen(value));
+        }
+
+        while (depth > 0 && flat->subtree_ends[stack[depth - 1].index] <= i) {
+            depth--;
+        }
+        if (depth > 0) {
+            add_child(stack[depth - 1].node, node);
+        }
+        if (flat->subtree_ends[i] > i + 1) {
+            if (depth == capacity) {
+                capacity *= 2;
+                BuildEntry* grown = (BuildEntry*)realloc(stack, capacity * sizeof(BuildEntry));
+                if (grown == NULL) {
+                    fprintf(stderr, "Fatal: Memory allocation failed.\n");
+                    exit(EXIT_FAILURE);
+                }
+                stack = grown;
+            }
+            stack[depth].index = i;
+            stack[depth].node = node;
+            depth++;
+        }
+    }
+    free(stack);
+    return &doc->root;
+}
@@ -0,0 +1,77 @@
+#ifndef FLAT_DOM_H
+#define FLAT_DOM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dom.h"
+
+// Compact structure-of-arrays form of a DOM tree. Nodes are stored in
+// document (pre-)order and addressed by 32-bit indices; node 0 is the
+// root. Because of that order, an element's first child is always the
+// next index and its subtree is the range [i, subtree_end[i]), so a full
+// walk is a linear scan over a handful of arrays.
+//
+// All arrays live in one allocation; strings are NUL-terminated and
+// addressed by byte offsets into `strings`. Tag and attribute names are
+// stored once per distinct atom.
+
+#define FLAT_NONE 0xFFFFFFFFu
+
+typedef struct {
+    uint32_t node_count;
+    uint32_t attr_count;
+    uint32_t string_bytes;
+
+    // Per node.
+    uint8_t* types;          // NodeType
+    int32_t* atoms;          // static tag atom; ATOM_NONE for text and
+                             // for names outside the static table
+    uint32_t* parents;       // FLAT_NONE for the root
+    uint32_t* subtree_ends;  // one past the last descendant
+    uint32_t* strings_at;    // tag name or text content
+    uint32_t* attr_begins;   // node_count + 1 entries; node i owns
+                             // attributes [attr_begins[i], attr_begins[i+1])
+    // Per attribute.
+    int32_t* attr_atoms;     // static atoms only, as for `atoms`
+    uint32_t* attr_names;
+    uint32_t* attr_values;
+
+    char* strings;
+
+    void* block;             // backing allocation (NULL if not owned)
+} FlatDocument;
+
+// The arrays above, in the order they are laid out in the block.
+#define FLAT_SECTIONS 10
+
+// Computes the 8-byte aligned offset of each array for the given counts
+// and returns the total block size. Shared with the snapshot format.
+size_t flat_layout(uint32_t node_count, uint32_t attr_count, uint32_t string_bytes,
+                   size_t offsets[FLAT_SECTIONS]);
+
+// Points `flat`'s arrays into `block` (counts must already be set).
+void flat_bind(FlatDocument* flat, char* block, const size_t offsets[FLAT_SECTIONS]);
+
+// Flattens `root` and its descendants (not its siblings).
+FlatDocument* flat_from_dom(const DomNode* root);
+
+// Rebuilds a pointer tree as an arena-backed DomDocument.
+DomNode* flat_to_dom(const FlatDocument* flat);
+
+void flat_free(FlatDocument* flat);
+
+uint32_t flat_first_child(const FlatDocument* flat, uint32_t node);
+
+uint32_t flat_next_sibling(const FlatDocument* flat, uint32_t node);
+
+// Tag name of an element or text of a text node.
+const char* flat_node_string(const FlatDocument* flat, uint32_t node);
+
+const char* flat_attr_name(const FlatDocument* flat, uint32_t attr);
+
+const char* flat_attr_value(const FlatDocument* flat, uint32_t attr);
+
+// Value of the first attribute of `node` called `name`, or NULL.
+const char* flat_get_attribute(const FlatDocument* flat, uint32_t node, const char* name);
+
+#endif
@@ -1,92 +1,290 @@
 #include "lexer.h"
 #include "utils.h"
-#include <ctype.h>
+#include "scan.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 Lexer* lexer_init(const char* source) {
+    return lexer_init_n(source, strlen(source));
+}
+
+Lexer* lexer_init_n(const char* source, size_t length) {
+    if (length > INPUT_MAX_BYTES) {
+        fprintf(stderr, "Fatal: Input of %zu bytes is too large to lex.\n", length);
+        exit(EXIT_FAILURE);
+    }
     Lexer* lexer = (Lexer*)safe_malloc(sizeof(Lexer));
     lexer->source = source;
+    lexer->length = (int)length;
     lexer->start = 0;
     lexer->current = 0;
-    lexer->line = 1;
-    lexer->col = 1;
     lexer->insideTag = 0;
+    lexer->mode = LEXEME_COPY;
+    lexer->buffer = NULL;
+    lexer->capacity = 0;
+    lexer->streaming = 0;
+    lexer->finished = 1;
+    lexer->hit_end = 0;
+    lexer->skipped = 0;
+    lexer->scanned = 0;
+    lexer->line_starts = NULL;
+    lexer->line_count = 0;
+    lexer->line_capacity = 0;
+    lexer->indexed = 0;
+    lexer->base_offset = 0;
+    lexer->base_line = 1;
+    lexer->base_line_start = 0;
+    return lexer;
+}
+
+Lexer* lexer_init_stream(void) {
+    Lexer* lexer = lexer_init_n("", 0);
+    lexer->streaming = 1;
+    lexer->finished = 0;
     return lexer;
 }
+
+int lexer_feed(Lexer* lexer, const char* chunk, size_t length) {
+    // Everything before `current` has been handed out as tokens already;
+    // drop it so the buffer only ever holds the unfinished tail.
+    int keep = lexer->length - lexer->current;
+    // Offsets into the buffer are int.
+    if (length > INPUT_MAX_BYTES - (size_t)keep) {
+        return -1;
+    }
+    if (lexer->current > 0) {
+        // Carry the line count across the dropped bytes; the line index
+        // refers to buffer offsets and starts over.
+        int newlines = (int)scan_count_byte(lexer->buffer, lexer->current, '\n');
+        if (newlines > 0) {
+            int last = lexer->current - 1;
+            while (lexer->buffer[last] != '\n') {
+                last--;
+            }
+            lexer->base_line += newlines;
+            lexer->base_line_start = lexer->base_offset + last + 1;
+        }
+        lexer->base_offset += lexer->current;
+        lexer->scanned = lexer->scanned > lexer->current ? lexer->scanned - lexer->current : 0;
+        lexer->line_count = 0;
+        lexer->indexed = 0;
+    }
+    if (lexer->current > 0 && keep > 0) {
+        memmove(lexer->buffer, lexer->buffer + lexer->current, keep);
+    }
+    lexer->length = keep;
+    lexer->current = 0;
+    lexer->start = 0;
+
+    size_t needed = (size_t)keep + length;
+    if (needed > (size_t)lexer->capacity) {
+        size_t capacity = lexer->capacity ? (size_t)lexer->capacity : 4096;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        if (capacity > INPUT_MAX_BYTES) {
+            capacity = INPUT_MAX_BYTES;
+        }
+        char* grown = (char*)realloc(lexer->buffer, capacity);
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        lexer->buffer = grown;
+        lexer->capacity = (int)capacity;
+    }
+    if (length > 0) {
+        memcpy(lexer->buffer + keep, chunk, length);
+    }
+    lexer->length = (int)needed;
+    if (lexer->buffer != NULL) {
+        lexer->source = lexer->buffer;
+    }
+    return 0;
+}
+
+void lexer_finish(Lexer* lexer) {
+    lexer->finished = 1;
+}
+
 void lexer_free(Lexer* lexer) {
     if (lexer) {
+        free(lexer->buffer);
+        free(lexer->line_starts);
         free(lexer);
     }
 }
 
+void lexer_set_lexeme_mode(Lexer* lexer, LexemeMode mode) {
+    lexer->mode = mode;
+}
+
 static Token make_token(Lexer* lexer, TokenType type) {
     Token token;
     token.type = type;
     int length = lexer->current - lexer->start;
-    char* lexeme = (char*)safe_malloc(length + 1);
-    strncpy(lexeme, lexer->source + lexer->start, length);
-    lexeme[length] = '\0';
-    token.lexeme = lexeme;
-    token.line = lexer->line;
-    token.col = lexer->col - length;
-    
+    token.span.offset = lexer->start;
+    token.span.length = length;
+    token.message = NULL;
+    token.lexeme = NULL;
+    if (lexer->mode == LEXEME_COPY) {
+        token.lexeme = safe_strndup(lexer->source + lexer->start, length);
+    }
     return token;
 }
 
 static Token error_token(Lexer* lexer, const char* message) {
     Token token;
     token.type = TOKEN_ERROR;
-    token.lexeme = safe_strdup(message);
-    token.line = lexer->line;
-    token.col = lexer->col;
+    token.span.offset = lexer->current;
+    token.span.length = 0;
+    token.message = message;
+    token.lexeme = NULL;
+    if (lexer->mode == LEXEME_COPY) {
+        token.lexeme = safe_strdup(message);
+    }
     return token;
 }
 
+const char* token_text(const Lexer* lexer, const Token* token) {
+    if (token->type == TOKEN_ERROR) {
+        return token->message;
+    }
+    return lexer->source + token->span.offset;
+}
+
+int token_length(const Token* token) {
+    if (token->type == TOKEN_ERROR) {
+        return (int)strlen(token->message);
+    }
+    return token->span.length;
+}
+
+int token_equals(const Lexer* lexer, const Token* token, const char* s) {
+    int length = token_length(token);
+    return strncmp(token_text(lexer, token), s, length) == 0 && s[length] == '\0';
+}
+
+// Extends the line index so it covers source[0..target).
+static void index_lines(Lexer* lexer, int target) {
+    while (lexer->indexed < target) {
+        int newline = lexer->indexed + (int)scan_find_byte(lexer->source + lexer->indexed,
+                                                           target - lexer->indexed, '\n');
+        if (newline >= target) {
+            lexer->indexed = target;
+            return;
+        }
+        if (lexer->line_count == lexer->line_capacity) {
+            lexer->line_capacity = lexer->line_capacity ? lexer->line_capacity * 2 : 64;
+            int* grown = (int*)realloc(lexer->line_starts, lexer->line_capacity * sizeof(int));
+            if (grown == NULL) {
+                fprintf(stderr, "Fatal: Memory allocation failed.\n");
+                exit(EXIT_FAILURE);
+            }
+            lexer->line_starts = grown;
+        }
+        lexer->line_starts[lexer->line_count++] = newline + 1;
+        lexer->indexed = newline + 1;
+    }
+}
+
+void lexer_position(Lexer* lexer, int offset, int* line, int* col) {
+    if (offset > lexer->length) {
+        offset = lexer->length;
+    }
+    index_lines(lexer, offset);
+
+    // Number of line starts at or before `offset`.
+    int lo = 0;
+    int hi = lexer->line_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (lexer->line_starts[mid] <= offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    long line_start = lo > 0 ? lexer->base_offset + lexer->line_starts[lo - 1] : lexer->base_line_start;
+    *line = lexer->base_line + lo;
+    *col = (int)(lexer->base_offset + offset - line_start) + 1;
+}
+
 void free_token_lexeme(Token* token) {
     if (token && token->lexeme) {
         free(token->lexeme);
         token->lexeme = NULL;
     }
 }
+// The helpers below note whenever a decision depended on bytes past the
+// end of the buffer, so a streaming lexer knows the token may be partial.
 static int is_at_end(Lexer* lexer) {
-    return lexer->source[lexer->current] == '\0';
+    if (lexer->current >= lexer->length) {
+        lexer->hit_end = 1;
+        return 1;
+    }
+    return 0;
 }
 
 static char advance(Lexer* lexer) {
-    char c = lexer->source[lexer->current];
-    lexer->current++;
-    if (c == '\n') {
-        lexer->line++;
-        lexer->col = 1;
-    } else {
-        lexer->col++;
+    return lexer->source[lexer->current++];
+}
+
+// Moves to `target` in one step, after the scan kernels have skipped a
+// whole run of bytes.
+static void advance_to(Lexer* lexer, int target) {
+    lexer->current = target;
+}
+
+// Called when a search ran out of input: a rolled back token resumes it
+// from here. The last two bytes are searched again, as a comment's "-->"
+// may begin there.
+static void searched_to_end(Lexer* lexer) {
+    lexer->hit_end = 1;
+    lexer->scanned = lexer->length > 2 ? lexer->length - 2 : 0;
+}
+
+// Offset of the next `c` at or after the current position (length if none).
+// Bytes a rolled back search already went through are not searched again.
+static int find_next(Lexer* lexer, char c) {
+    int from = lexer->current > lexer->scanned ? lexer->current : lexer->scanned;
+    int found = from + (int)scan_find_byte(lexer->source + from, lexer->length - from, c);
+    if (found >= lexer->length) {
+        searched_to_end(lexer);
     }
-    return c;
+    return found;
+}
+
+// Byte at current + ahead, or '\0' past the end. The source is never read
+// beyond `length`, so it need not be NUL-terminated (e.g. an mmap view).
+static char peek_at(Lexer* lexer, int ahead) {
+    int index = lexer->current + ahead;
+    if (index >= lexer->length) {
+        lexer->hit_end = 1;
+        return '\0';
+    }
+    return lexer->source[index];
 }
 
 static char peek(Lexer* lexer) {
-    return lexer->source[lexer->current];
+    return peek_at(lexer, 0);
 }
 
 static char peek_next(Lexer* lexer) {
-    if (is_at_end(lexer)) return '\0';
-    return lexer->source[lexer->current + 1];
+    return peek_at(lexer, 1);
 }
 
 static void skip_whitespace(Lexer* lexer) {
     while (1) {
+        advance_to(lexer, lexer->current +
+                   (int)scan_skip_whitespace(lexer->source + lexer->current,
+                                             lexer->length - lexer->current));
+        lexer->skipped = lexer->current;
         char c = peek(lexer);
         switch (c) {
-            case ' ':
-            case '\r':
-            case '\t':
-            case '\n':
-                advance(lexer);
-                break;
             case '<':
                 if (peek_next(lexer) == '!') {
-                    if (lexer->source[lexer->current + 2] == '-' && lexer->source[lexer->current + 3] == '-') {
+                    if (peek_at(lexer, 2) == '-' && peek_at(lexer, 3) == '-') {
                         advance(lexer); // <
                         advance(lexer); // !
                         advance(lexer); // -
@@ -94,14 +292,19 @@ static void skip_whitespace(Lexer* lexer) {
                         while (!is_at_end(lexer) && 
                             !(peek(lexer) == '-' && 
                                 peek_next(lexer) == '-' && 
-                                lexer->source[lexer->current + 2] == '>')) {
+                                peek_at(lexer, 2) == '>')) {
                             advance(lexer);
+                            advance_to(lexer, find_next(lexer, '-'));
                         }
-                        if (!is_at_end(lexer)) {
-                            advance(lexer);
-                            advance(lexer);
-                            advance(lexer);
+                        if (is_at_end(lexer)) {
+                            // Unterminated: a streaming lexer resumes
+                            // it from `skipped`.
+                            searched_to_end(lexer);
+                            return;
                         }
+                        advance(lexer);
+                        advance(lexer);
+                        advance(lexer);
                         break;
                     }
                 }
@@ -111,140 +314,192 @@ static void skip_whitespace(Lexer* lexer) {
     }
 }
 
-static Token scan_inside_tag(Lexer* lexer) {
-    lexer->start = lexer->current;
-    char c = advance(lexer);
+// Byte classes for the token DFA. Only ASCII letters and digits count as
+// such, whatever the locale; bytes >= 0x80 are CC_OTHER.
+enum {
+    CC_OTHER,
+    CC_LT,          // <
+    CC_GT,          // >
+    CC_EQUALS,      // =
+    CC_QUOTE,       // " or '
+    CC_SLASH,       // /
+    CC_LETTER,      // A-Z a-z; this and the next two are name bytes
+    CC_DIGIT,       // 0-9
+    CC_DASH,        // -
+    CC_COUNT
+};
 
-    switch (c) {
-        case '>': return make_token(lexer, TOKEN_GT);
-        case '=': return make_token(lexer, TOKEN_ATTR_EQUALS);
-        case '/':
-            if (peek(lexer) == '>') {
-                advance(lexer);
-                return make_token(lexer, TOKEN_SELF_CLOSE);
-            }
-            break;
-            
-        case '"':
-        case '\'':
-            while (peek(lexer) != c && !is_at_end(lexer)) {
-                advance(lexer);
-            }
-            if (is_at_end(lexer)) {
-                return error_token(lexer, "Unterminated string literal.");
-            }
-            advance(lexer);
-            return make_token(lexer, TOKEN_ATTR_VALUE);
+static const unsigned char char_class[256] = {
+    ['<'] = CC_LT, ['>'] = CC_GT, ['='] = CC_EQUALS, ['"'] = CC_QUOTE, ['\''] = CC_QUOTE,
+    ['/'] = CC_SLASH, ['-'] = CC_DASH,
+    ['0'] = CC_DIGIT, ['1'] = CC_DIGIT, ['2'] = CC_DIGIT, ['3'] = CC_DIGIT, ['4'] = CC_DIGIT,
+    ['5'] = CC_DIGIT, ['6'] = CC_DIGIT, ['7'] = CC_DIGIT, ['8'] = CC_DIGIT, ['9'] = CC_DIGIT,
+    ['A'] = CC_LETTER, ['B'] = CC_LETTER, ['C'] = CC_LETTER, ['D'] = CC_LETTER, ['E'] = CC_LETTER,
+    ['F'] = CC_LETTER, ['G'] = CC_LETTER, ['H'] = CC_LETTER, ['I'] = CC_LETTER, ['J'] = CC_LETTER,
+    ['K'] = CC_LETTER, ['L'] = CC_LETTER, ['M'] = CC_LETTER, ['N'] = CC_LETTER, ['O'] = CC_LETTER,
+    ['P'] = CC_LETTER, ['Q'] = CC_LETTER, ['R'] = CC_LETTER, ['S'] = CC_LETTER, ['T'] = CC_LETTER,
+    ['U'] = CC_LETTER, ['V'] = CC_LETTER, ['W'] = CC_LETTER, ['X'] = CC_LETTER, ['Y'] = CC_LETTER,
+    ['Z'] = CC_LETTER,
+    ['a'] = CC_LETTER, ['b'] = CC_LETTER, ['c'] = CC_LETTER, ['d'] = CC_LETTER, ['e'] = CC_LETTER,
+    ['f'] = CC_LETTER, ['g'] = CC_LETTER, ['h'] = CC_LETTER, ['i'] = CC_LETTER, ['j'] = CC_LETTER,
+    ['k'] = CC_LETTER, ['l'] = CC_LETTER, ['m'] = CC_LETTER, ['n'] = CC_LETTER, ['o'] = CC_LETTER,
+    ['p'] = CC_LETTER, ['q'] = CC_LETTER, ['r'] = CC_LETTER, ['s'] = CC_LETTER, ['t'] = CC_LETTER,
+    ['u'] = CC_LETTER, ['v'] = CC_LETTER, ['w'] = CC_LETTER, ['x'] = CC_LETTER, ['y'] = CC_LETTER,
+    ['z'] = CC_LETTER,
+};
 
-        default:
-            if (isalpha(c)) {
-                while (isalnum(peek(lexer)) || peek(lexer) == '-') {
-                    advance(lexer);
-                }
-                return make_token(lexer, TOKEN_ATTR_NAME);
-            }
-    }
-    
-    return error_token(lexer, "Unexpected character inside tag.");
+// Bytes that continue a tag or attribute name: letters, digits and '-',
+// the last three classes, so one comparison tells.
+#define IS_NAME_CLASS(cc) ((cc) >= CC_LETTER)
+
+// DFA states at the start of a token. LS_CONTENT and LS_TAG are where
+// every token begins (Lexer::insideTag picks one); the others are one
+// byte into a tag token.
+enum {
+    LS_CONTENT,     // outside tags
+    LS_TAG,         // inside a tag, between attributes
+    LS_LT,          // after '<'
+    LS_SLASH,       // inside a tag, after '/'
+    LS_COUNT
+};
+
+// What a state does with the class of the next byte. The LA_TO_* actions
+// consume the byte and move to another state; all others finish a token.
+enum {
+    LA_TEXT,            // text up to the next '<'
+    LA_TO_LT,
+    LA_TO_SLASH,
+    LA_OPEN_TAG,        // "<name"
+    LA_CLOSE_TAG,       // "</name"
+    LA_GT,
+    LA_EQUALS,
+    LA_VALUE,           // quoted attribute value
+    LA_ATTR_NAME,
+    LA_SELF_CLOSE,      // "/>"
+    LA_BAD_TAG_START,
+    LA_BAD_IN_TAG,
+    LA_BAD_SLASH
+};
+
+static const unsigned char transitions[LS_COUNT][CC_COUNT] = {
+    //              OTHER             LT             GT              EQUALS            QUOTE             SLASH             LETTER            DIGIT             DASH
+    [LS_CONTENT] = { LA_TEXT,          LA_TO_LT,      LA_TEXT,        LA_TEXT,          LA_TEXT,          LA_TEXT,          LA_TEXT,          LA_TEXT,          LA_TEXT },
+    [LS_TAG]     = { LA_BAD_IN_TAG,    LA_BAD_IN_TAG, LA_GT,          LA_EQUALS,        LA_VALUE,         LA_TO_SLASH,      LA_ATTR_NAME,     LA_BAD_IN_TAG,    LA_BAD_IN_TAG },
+    [LS_LT]      = { LA_BAD_TAG_START, LA_BAD_TAG_START, LA_BAD_TAG_START, LA_BAD_TAG_START, LA_BAD_TAG_START, LA_CLOSE_TAG, LA_OPEN_TAG,      LA_BAD_TAG_START, LA_BAD_TAG_START },
+    [LS_SLASH]   = { LA_BAD_SLASH,     LA_BAD_SLASH,  LA_SELF_CLOSE,  LA_BAD_SLASH,     LA_BAD_SLASH,     LA_BAD_SLASH,     LA_BAD_SLASH,     LA_BAD_SLASH,     LA_BAD_SLASH },
+};
+
+static int class_at(Lexer* lexer) {
+    return char_class[(unsigned char)peek(lexer)];
 }
-static Token scan_outside_tag(Lexer* lexer) {
-    lexer->start = lexer->current;
-    if (peek(lexer) == '<') {
-        advance(lexer); 
-        if (peek(lexer) == '/') {
-            advance(lexer);
-            lexer->start = lexer->current; 
-            while (isalpha(peek(lexer))) {
-                advance(lexer);
-            }
-            return make_token(lexer, TOKEN_CLOSE_TAG);
-        }
-        
-        if (isalpha(peek(lexer))) {
-            // Open tag: <tag
-            lexer->start = lexer->current;
-            while (isalpha(peek(lexer))) {
-                advance(lexer);
-            }
-            return make_token(lexer, TOKEN_OPEN_TAG);
-        }
-        
-        return error_token(lexer, "Invalid tag syntax.");
-    }
-    while (peek(lexer) != '<' && !is_at_end(lexer)) {
-        advance(lexer);
+
+// Advances over a run of name bytes, skipping those a rolled back scan
+// already went through.
+static void scan_name(Lexer* lexer) {
+    const unsigned char* source = (const unsigned char*)lexer->source;
+    int i = lexer->current > lexer->scanned ? lexer->current : lexer->scanned;
+    while (i < lexer->length && IS_NAME_CLASS(char_class[source[i]])) {
+        i++;
     }
-    
-    if (lexer->current > lexer->start) {
-        return make_token(lexer, TOKEN_TEXT);
+    if (i >= lexer->length) {
+        lexer->hit_end = 1;
+        lexer->scanned = lexer->length;
     }
-    return make_token(lexer, TOKEN_EOF);
+    lexer->current = i;
 }
-Token get_next_token(Lexer* lexer) {
+
+static Token lex_token(Lexer* lexer) {
     skip_whitespace(lexer);
     lexer->start = lexer->current;
 
     if (is_at_end(lexer)) {
         return make_token(lexer, TOKEN_EOF);
     }
-    if (lexer->insideTag) {
-        char c = peek(lexer);
-
-        if (c == '>') {
-            advance(lexer);
-            lexer->insideTag = 0;
-            return make_token(lexer, TOKEN_GT);
-        } 
-        else if (c == '=') {
-            advance(lexer);
-            return make_token(lexer, TOKEN_ATTR_EQUALS);
-        } 
-        else if (c == '"' || c == '\'') {
-            advance(lexer);
-            lexer->start = lexer->current;
-            while (peek(lexer) != c && !is_at_end(lexer)) {
+    int state = lexer->insideTag ? LS_TAG : LS_CONTENT;
+    while (1) {
+        switch (transitions[state][class_at(lexer)]) {
+            case LA_TO_LT:
                 advance(lexer);
-            }
-            if (is_at_end(lexer)) return error_token(lexer, "Unterminated string.");
-            Token tok = make_token(lexer, TOKEN_ATTR_VALUE);
-            advance(lexer);
-            return tok;
-        } 
-        else if (isalpha(c)) {
-            while (isalnum(peek(lexer)) || peek(lexer) == '-') {
+                state = LS_LT;
+                break;
+            case LA_TO_SLASH:
+                advance(lexer);
+                state = LS_SLASH;
+                break;
+            case LA_TEXT:
+                advance_to(lexer, find_next(lexer, '<'));
+                return make_token(lexer, TOKEN_TEXT);
+            case LA_OPEN_TAG:
+                lexer->start = lexer->current;
+                scan_name(lexer);
+                lexer->insideTag = 1;
+                return make_token(lexer, TOKEN_OPEN_TAG);
+            case LA_CLOSE_TAG:
+                advance(lexer);
+                lexer->start = lexer->current;
+                scan_name(lexer);
+                lexer->insideTag = 1;
+                return make_token(lexer, TOKEN_CLOSE_TAG);
+            case LA_GT:
+                advance(lexer);
+                lexer->insideTag = 0;
+                return make_token(lexer, TOKEN_GT);
+            case LA_EQUALS:
                 advance(lexer);
+                return make_token(lexer, TOKEN_ATTR_EQUALS);
+            case LA_VALUE: {
+                char quote = advance(lexer);
+                lexer->start = lexer->current;
+                advance_to(lexer, find_next(lexer, quote));
+                if (is_at_end(lexer)) {
+                    return error_token(lexer, "Unterminated string.");
+                }
+                Token token = make_token(lexer, TOKEN_ATTR_VALUE);
+                advance(lexer);
+                return token;
             }
-            return make_token(lexer, TOKEN_ATTR_NAME);
-        } 
-        else if (c == '/' && peek_next(lexer) == '>') {
-            advance(lexer);
-            advance(lexer); 
-            lexer->insideTag = 0;
-            return make_token(lexer, TOKEN_SELF_CLOSE);
+            case LA_ATTR_NAME:
+                scan_name(lexer);
+                return make_token(lexer, TOKEN_ATTR_NAME);
+            case LA_SELF_CLOSE:
+                advance(lexer);
+                lexer->insideTag = 0;
+                return make_token(lexer, TOKEN_SELF_CLOSE);
+            case LA_BAD_TAG_START:
+                return error_token(lexer, "Invalid tag start.");
+            case LA_BAD_SLASH:
+                // Reported at the '/', like any other stray byte.
+                lexer->current = lexer->start;
+                return error_token(lexer, "Unexpected char inside tag.");
+            default:
+                return error_token(lexer, "Unexpected char inside tag.");
         }
+    }
+}
 
-        return error_token(lexer, "Unexpected char inside tag.");
-    }
-    char c = peek(lexer);
-    if (c == '<') {
-        advance(lexer);
-        if (peek(lexer) == '/') {
-            advance(lexer);
-            lexer->start = lexer->current;
-            while (isalnum(peek(lexer)) || peek(lexer) == '-') advance(lexer);
-            lexer->insideTag = 1;
-            return make_token(lexer, TOKEN_CLOSE_TAG);
-        } else if (isalpha(peek(lexer))) {
-            lexer->start = lexer->current;
-            while (isalnum(peek(lexer)) || peek(lexer) == '-') advance(lexer);
-            lexer->insideTag = 1;
-            return make_token(lexer, TOKEN_OPEN_TAG);
-        } else {
-            return error_token(lexer, "Invalid tag start.");
-        }
+Token get_next_token(Lexer* lexer) {
+    if (lexer->finished) {
+        Token token = lex_token(lexer);
+        lexer->scanned = 0;
+        return token;
     }
-    while (peek(lexer) != '<' && !is_at_end(lexer)) {
-        advance(lexer);
+
+    // More input may follow: a token that ran into the end of the buffer
+    // is rolled back once the next chunk has been fed. The whitespace and
+    // comments before it stay skipped, and `scanned` lets the token pick
+    // up its search where it stopped, so a long token is not rescanned
+    // from its start on every chunk.
+    int insideTag = lexer->insideTag;
+    lexer->hit_end = 0;
+
+    Token token = lex_token(lexer);
+    if (!lexer->hit_end) {
+        lexer->scanned = 0;
+        return token;
     }
-    return make_token(lexer, TOKEN_TEXT);
+    free_token_lexeme(&token);
+    lexer->current = lexer->skipped;
+    lexer->start = lexer->current;
+    lexer->insideTag = insideTag;
+    return make_token(lexer, TOKEN_NEED_MORE);
 }
\ No newline at end of file
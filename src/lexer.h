@@ -1,6 +1,8 @@
 #ifndef LEXER_H
 #define LEXER_H
 
+#include <stddef.h>
+
 typedef enum {
     TOKEN_OPEN_TAG,     // <tag
     TOKEN_CLOSE_TAG,    // </tag
@@ -11,34 +13,99 @@ typedef enum {
     TOKEN_ATTR_EQUALS,  // =
     TOKEN_ATTR_VALUE,   // "value" or 'value'
     TOKEN_ERROR,        // An unrecognized character or syntax
-    TOKEN_EOF           // End of file
+    TOKEN_EOF,          // End of file
+    TOKEN_NEED_MORE     // Streaming only: feed more input and ask again
 } TokenType;
 
+// How get_next_token hands out lexemes.
+//   LEXEME_COPY: every token owns a malloc'd, NUL-terminated copy (default).
+//   LEXEME_SPAN: tokens only carry a span into Lexer::source; no allocation.
+typedef enum {
+    LEXEME_COPY,
+    LEXEME_SPAN
+} LexemeMode;
+
+typedef struct {
+    int offset;        // byte offset into Lexer::source
+    int length;
+} Span;
+
 typedef struct {
     TokenType type;
-    char* lexeme;      
-    int line;        
-    int col; 
+    char* lexeme;      // NULL in LEXEME_SPAN mode
+    Span span;
+    const char* message; // static description for TOKEN_ERROR, NULL otherwise
 } Token;
 
 typedef struct {
     const char* source;
+    int length;
     int start; 
     int current;
-    int line;
-    int col;
     int insideTag;
+    LexemeMode mode;
+    char* buffer;      // owned input buffer of a streaming lexer
+    int capacity;
+    int streaming;
+    int finished;      // no more input will be fed
+    int hit_end;       // last token looked past the end of the buffer
+    int skipped;       // whitespace and comments before here are done with
+    int scanned;       // streaming: the unfinished token or comment that
+                       // starts at `skipped` has no end before here, so
+                       // resuming it need not search those bytes again
+
+    // Only byte offsets are tracked while lexing. Line and column are
+    // worked out on demand by lexer_position() from an index of line
+    // starts that is built lazily, up to the furthest offset asked for.
+    int* line_starts;  // offsets just past each '\n' in source[0..indexed)
+    int line_count;
+    int line_capacity;
+    int indexed;
+    long base_offset;      // streaming: bytes already dropped from the buffer
+    int base_line;         // line number of source[0]
+    long base_line_start;  // absolute offset at which that line starts
 } Lexer;
 
 
 
 Lexer* lexer_init(const char* source);
 
+// Lexes exactly `length` bytes; `source` need not be NUL-terminated.
+// `length` must not exceed INPUT_MAX_BYTES (utils.h): longer inputs are
+// a fatal error, as map_file() refuses them.
+Lexer* lexer_init_n(const char* source, size_t length);
+
+// Streaming lexer: input arrives through lexer_feed() in chunks of any
+// size. Until lexer_finish() is called, a token that might continue in
+// the next chunk is not returned; get_next_token() yields
+// TOKEN_NEED_MORE instead. Feeding invalidates earlier token spans.
+Lexer* lexer_init_stream(void);
+
+// Returns 0, or -1 if the unlexed input would grow past INPUT_MAX_BYTES
+// (utils.h); the chunk is then not taken.
+int lexer_feed(Lexer* lexer, const char* chunk, size_t length);
+
+void lexer_finish(Lexer* lexer);
+
 void lexer_free(Lexer* lexer);
 
+void lexer_set_lexeme_mode(Lexer* lexer, LexemeMode mode);
+
 
 Token get_next_token(Lexer* lexer);
 
 void free_token_lexeme(Token* token);
 
+// Start of the token's text (the error message for TOKEN_ERROR).
+// Not NUL-terminated in LEXEME_SPAN mode; pair it with token_length.
+const char* token_text(const Lexer* lexer, const Token* token);
+
+int token_length(const Token* token);
+
+int token_equals(const Lexer* lexer, const Token* token, const char* s);
+
+// 1-based line and column of `offset` (e.g. a token's span.offset) in
+// the current buffer.
+void lexer_position(Lexer* lexer, int offset, int* line, int* col);
+
 #endif
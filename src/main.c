@@ -1,27 +1,243 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
 #include <unistd.h>
 #include "utils.h"
 #include "lexer.h"
 #include "parser.h"
 #include "dom.h"
+#include "serialize.h"
+#include "batch.h"
+#include "threadpool.h"
+#include "parallel_parse.h"
+
+// Set by --no-delay: skip every pause and progress animation below.
+static int no_delay = 0;
+
+// Set by -j: threads for parsing the one input file (see parallel_parse.h).
+static int parse_workers = 1;
+
+// Set by --whitespace, --lex-ahead and the --max-* limits.
+static ParserOptions parse_options = { 0 };
+
+// Set by --stats (1) or --stats=json (2): report ParseStats on stderr.
+static int stats_mode = 0;
+
+static void pause_ms(int ms) {
+    if (no_delay) {
+        return;
+    }
+    struct timespec ts = { ms / 1000, (ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
 
 static void delay_print(const char *message, int ms_delay) {
+    if (no_delay) {
+        return;
+    }
     printf("%s", message);
     fflush(stdout);
-    usleep(ms_delay * 1000); 
+    pause_ms(ms_delay);
+}
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Usage: %s [--no-delay] [--format html|pretty|json|tree] [-j threads]\n"
+                    "       [--whitespace keep|trim|collapse] [--lex-ahead] [--stats[=json]] [limits] <filename.html | ->\n", program);
+    fprintf(stderr, "       %s --batch <directory | file-list> [-j threads] [--cache MB] [limits]\n", program);
+    fprintf(stderr, "Limits: --max-depth N  --max-nodes N  --max-attributes N  --max-dom-mb MB  --max-input-mb MB\n");
+}
+
+// Reads `text` as a whole decimal number from 1 to `max`. Returns 0 for
+// anything else: signs, fractions, trailing bytes, overflow.
+static int parse_count(const char* text, unsigned long long max, unsigned long long* value) {
+    if (*text < '0' || *text > '9') {
+        return 0;
+    }
+    char* end;
+    errno = 0;
+    unsigned long long n = strtoull(text, &end, 10);
+    if (errno != 0 || *end != '\0' || n == 0 || n > max) {
+        return 0;
+    }
+    *value = n;
+    return 1;
+}
+
+// Reads one --max-* option at argv[*i] into parse_options. Returns 0 if
+// argv[*i] is not one, or its value is missing or not a positive integer
+// in range.
+static int parse_limit(int argc, char* argv[], int* i) {
+    if (strncmp(argv[*i], "--max-", 6) != 0 || *i + 1 >= argc) {
+        return 0;
+    }
+    const char* name = argv[*i] + 6;
+    const char* text = argv[*i + 1];
+    const unsigned long long mb = 1024 * 1024;
+    unsigned long long value;
+    if (strcmp(name, "depth") == 0 && parse_count(text, INT_MAX, &value)) {
+        parse_options.max_depth = (int)value;
+    } else if (strcmp(name, "nodes") == 0 && parse_count(text, SIZE_MAX, &value)) {
+        parse_options.max_nodes = (size_t)value;
+    } else if (strcmp(name, "attributes") == 0 && parse_count(text, INT_MAX, &value)) {
+        parse_options.max_attributes = (int)value;
+    } else if (strcmp(name, "dom-mb") == 0 && parse_count(text, SIZE_MAX / mb, &value)) {
+        parse_options.max_dom_bytes = (size_t)(value * mb);
+    } else if (strcmp(name, "input-mb") == 0 && parse_count(text, SIZE_MAX / mb, &value)) {
+        parse_options.max_input_bytes = (size_t)(value * mb);
+    } else {
+        return 0;
+    }
+    (*i)++;
+    return 1;
+}
+
+// --batch <source> [-j N] [--cache MB] [limits]: parse many files
+// concurrently, no animations.
+static int run_batch_mode(int argc, char* argv[]) {
+    const char* source = NULL;
+    int workers = thread_pool_default_workers();
+    double cache_mb = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            source = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            cache_mb = atof(argv[++i]);
+        } else if (parse_limit(argc, argv, &i)) {
+            continue;
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (source == NULL || workers < 1 || cache_mb < 0) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    return batch_run(source, workers, (size_t)(cache_mb * 1024 * 1024), &parse_options) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void report_stats(const ParseStats* stats) {
+    if (stats_mode != 0) {
+        parse_stats_print(stats, stderr, stats_mode == 2);
+    }
+}
+
+// --format <name>: print only the serialized document, for pipelines.
+static int run_pipeline_mode(const char* filename, SerializeFormat format) {
+    double start = stats_now_ms();
+    FileBuffer source;
+    if (map_file(filename, &source, parse_options.max_input_bytes) != 0) {
+        fprintf(stderr, " Error: Could not read file '%s'.\n", filename);
+        return EXIT_FAILURE;
+    }
+    double read_ms = stats_now_ms() - start;
+    Lexer* lexer = lexer_init_n(source.data, source.length);
+    Parser* parser = parser_init(lexer, &parse_options);
+    DomNode* dom_root = parse_parallel(parser, parse_workers);
+    ParseStats stats = parser->stats;
+    stats.phase_ms[STATS_PHASE_READ] = read_ms;
+    int status = EXIT_SUCCESS;
+    if (parser->has_error) {
+        fprintf(stderr, "%s\n", parser->error_message);
+        status = EXIT_FAILURE;
+    } else {
+        start = stats_now_ms();
+        if (dom_serialize(dom_root, format, STDOUT_FILENO) != 0) {
+            fprintf(stderr, " Error: Could not write output.\n");
+            status = EXIT_FAILURE;
+        }
+        stats.phase_ms[STATS_PHASE_SERIALIZE] = stats_now_ms() - start;
+    }
+    start = stats_now_ms();
+    free_dom_tree(dom_root);
+    stats.phase_ms[STATS_PHASE_FREE] = stats_now_ms() - start;
+    parser_free(parser);
+    lexer_free(lexer);
+    unmap_file(&source);
+    report_stats(&stats);
+    return status;
+}
+
+static int parse_format(const char* name, SerializeFormat* format) {
+    static const struct { const char* name; SerializeFormat format; } formats[] = {
+        { "html", SERIALIZE_HTML },
+        { "pretty", SERIALIZE_PRETTY },
+        { "json", SERIALIZE_JSON },
+        { "tree", SERIALIZE_TREE },
+    };
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        if (strcmp(name, formats[i].name) == 0) {
+            *format = formats[i].format;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int parse_whitespace(const char* name, WhitespaceMode* mode) {
+    static const struct { const char* name; WhitespaceMode mode; } modes[] = {
+        { "keep", WHITESPACE_KEEP },
+        { "trim", WHITESPACE_TRIM },
+        { "collapse", WHITESPACE_COLLAPSE },
+    };
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        if (strcmp(name, modes[i].name) == 0) {
+            *mode = modes[i].mode;
+            return 1;
+        }
+    }
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        fprintf(stderr, "Usage: %s <filename.html>\n", argv[0]);
+    if (argc >= 2 && strcmp(argv[1], "--batch") == 0) {
+        return run_batch_mode(argc, argv);
+    }
+
+    const char* filename = NULL;
+    int pipeline = 0;
+    SerializeFormat format = SERIALIZE_TREE;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--no-delay") == 0) {
+            no_delay = 1;
+        } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc && parse_format(argv[i + 1], &format)) {
+            pipeline = 1;
+            i++;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc && atoi(argv[i + 1]) >= 1) {
+            parse_workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--lex-ahead") == 0) {
+            parse_options.pipeline = 1;
+        } else if (strcmp(argv[i], "--stats") == 0 || strcmp(argv[i], "--stats=json") == 0) {
+            stats_mode = argv[i][7] == '=' ? 2 : 1;
+        } else if (strcmp(argv[i], "--whitespace") == 0 && i + 1 < argc &&
+                   parse_whitespace(argv[i + 1], &parse_options.whitespace)) {
+            i++;
+        } else if (parse_limit(argc, argv, &i)) {
+            continue;
+        } else if (filename == NULL && (argv[i][0] != '-' || strcmp(argv[i], "-") == 0)) {
+            filename = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (filename == NULL) {
+        print_usage(argv[0]);
         return EXIT_FAILURE;
     }
-    const char* filename = argv[1];
+    if (pipeline) {
+        return run_pipeline_mode(filename, format);
+    }
 
     printf(" Starting HTML Parser...\n\n");
-    sleep(1);
+    pause_ms(1000);
     printf(" Reading file: %s\n", filename);
     delay_print("   Loading", 300);
     for (int i = 0; i < 3; i++) {
@@ -29,19 +245,21 @@ int main(int argc, char* argv[]) {
     }
     printf("\n");
 
-    char* source_code = read_file_to_buffer(filename);
-    if (source_code == NULL) {
+    double start = stats_now_ms();
+    FileBuffer source;
+    if (map_file(filename, &source, parse_options.max_input_bytes) != 0) {
         fprintf(stderr, " Error: Could not read file '%s'.\n", filename);
         return EXIT_FAILURE;
     }
-    printf(" File read successfully (%ld bytes)\n\n", strlen(source_code));
-    sleep(1);
+    double read_ms = stats_now_ms() - start;
+    printf(" File read successfully (%zu bytes)\n\n", source.length);
+    pause_ms(1000);
     printf(" Initializing Lexer and Parser...\n");
-    Lexer* lexer = lexer_init(source_code);
-    Parser* parser = parser_init(lexer);
-    usleep(800 * 1000);
+    Lexer* lexer = lexer_init_n(source.data, source.length);
+    Parser* parser = parser_init(lexer, &parse_options);
+    pause_ms(800);
     printf(" Components initialized successfully.\n\n");
-    sleep(1);
+    pause_ms(1000);
     printf(" Parsing document...\n");
     for (int i = 0; i < 3; i++) {
         delay_print("   Processing", 350);
@@ -50,24 +268,29 @@ int main(int argc, char* argv[]) {
     }
     printf("\n");
 
-    DomNode* dom_root = parse(parser);
+    DomNode* dom_root = parse_parallel(parser, parse_workers);
+    ParseStats stats = parser->stats;
+    stats.phase_ms[STATS_PHASE_READ] = read_ms;
     if (parser->has_error) {
         fprintf(stderr, "\n PARSE FAILED \n");
         fprintf(stderr, "%s\n", parser->error_message);
-        free(source_code);
+        unmap_file(&source);
         lexer_free(lexer);
         parser_free(parser);
         free_dom_tree(dom_root);
+        report_stats(&stats);
         return EXIT_FAILURE;
     }
 
     printf(" Parsing successful!\n\n");
-    sleep(1);
+    pause_ms(1000);
     printf(" Generated DOM Tree:\n\n");
-    usleep(700 * 1000);
+    pause_ms(700);
+    start = stats_now_ms();
     print_dom_tree(dom_root, 0);
+    stats.phase_ms[STATS_PHASE_SERIALIZE] = stats_now_ms() - start;
     printf("\n--------------------------\n\n");
-    sleep(1);
+    pause_ms(1000);
 
     printf(" Cleaning up memory...\n");
     for (int i = 0; i < 3; i++) {
@@ -77,11 +300,15 @@ int main(int argc, char* argv[]) {
     }
     printf("\n Done.\n");
 
-    free(source_code);
+    unmap_file(&source);
     lexer_free(lexer);
     parser_free(parser);
+    start = stats_now_ms();
     free_dom_tree(dom_root);
+    stats.phase_ms[STATS_PHASE_FREE] = stats_now_ms() - start;
 
     printf("\n Program finished successfully! \n");
+    fflush(stdout);
+    report_stats(&stats);
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,436 @@
+#include "parallel_parse.h"
+#include "threadpool.h"
+#include "dom_index.h"
+#include "scan.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A close tag in a later segment for an element opened in an earlier one.
+typedef struct {
+    const char* name;       // points into the input
+    int length;
+    int child_index;        // segment root children created before it
+} InheritedClose;
+
+// One slice of the input and the partial tree built from it. Each parse
+// task only touches its own segment.
+typedef struct {
+    const char* input;
+    int input_length;
+    const ParserOptions* options;  // for the segment's parser
+    int begin;
+    int end;                // where the next segment begins
+    int last;
+    DomBuilder* builder;    // of the segment's parser, while it runs
+    DomDocument* document;  // top-level nodes hang off its root
+    InheritedClose* closes;
+    int close_count;
+    int close_capacity;
+    DomNode** open;         // elements still open at `end`, outermost first
+    int open_count;
+    Token boundary;         // first token at or past `end`, not processed
+    int boundary_current;   // lexer state right after that token
+    int boundary_inside;
+    int ok;
+    const AtomTable* atoms; // of the final document, for remapping
+    Atom* remap;            // this segment's dynamic atoms -> final atoms
+    ParseStats stats;       // of the segment's parser
+    int peak;               // deepest nesting, counted from the depth at
+                            // `begin` (inherited closes count as -1)
+} Segment;
+
+static void segment_start_element(void* user_data, const char* name, size_t length) {
+    Segment* segment = (Segment*)user_data;
+    dom_builder_events.on_start_element(segment->builder, name, length);
+    int depth = segment->builder->depth - 1 - segment->close_count;
+    if (depth > segment->peak) {
+        segment->peak = depth;
+    }
+}
+
+static void segment_attribute(void* user_data, const char* name, size_t name_length,
+                              const char* value, size_t value_length) {
+    Segment* segment = (Segment*)user_data;
+    dom_builder_events.on_attribute(segment->builder, name, name_length, value, value_length);
+}
+
+static void segment_text(void* user_data, const char* text, size_t length) {
+    Segment* segment = (Segment*)user_data;
+    dom_builder_events.on_text(segment->builder, text, length);
+}
+
+// With only the segment root open, the parser is closing an inherited
+// element; remember where it happened so the join can replay it.
+static void segment_end_element(void* user_data, const char* name, size_t length) {
+    Segment* segment = (Segment*)user_data;
+    if (segment->builder->depth > 1) {
+        dom_builder_events.on_end_element(segment->builder, name, length);
+        return;
+    }
+    // The builder does not see this close, so its '>' is not for the
+    // element it closed last; join_segment() sets the source range.
+    segment->builder->closing = NULL;
+    if (segment->close_count == segment->close_capacity) {
+        int capacity = segment->close_capacity ? segment->close_capacity * 2 : 16;
+        InheritedClose* grown = (InheritedClose*)realloc(segment->closes, capacity * sizeof(InheritedClose));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        segment->closes = grown;
+        segment->close_capacity = capacity;
+    }
+    InheritedClose* close = &segment->closes[segment->close_count++];
+    close->name = name;
+    close->length = (int)length;
+    close->child_index = segment->builder->document ? segment->builder->document->root.child_count : 0;
+}
+
+static const ParserEvents segment_events = {
+    segment_start_element,
+    segment_attribute,
+    segment_text,
+    segment_end_element,
+    NULL
+};
+
+static void parse_segment(void* arg) {
+    Segment* segment = (Segment*)arg;
+    Lexer* lexer = lexer_init_n(segment->input + segment->begin, segment->input_length - segment->begin);
+    Parser* parser = parser_init(lexer, segment->options);
+    parser->speculative = segment->begin > 0;
+    segment->builder = &parser->builder;
+    parser->builder.source_base = (size_t)segment->begin;
+    parser_set_events(parser, &segment_events, segment);
+
+    // The last segment runs on to EOF; the others stop at the next cut.
+    int end = segment->last ? segment->input_length - segment->begin + 1 : segment->end - segment->begin;
+    int reached = parser_parse_until(parser, end, &segment->boundary);
+    segment->boundary_current = lexer->current;
+    segment->boundary_inside = lexer->insideTag;
+    segment->ok = !parser->has_error && (segment->last ? parser->state == PARSER_DONE : reached);
+
+    if (segment->ok) {
+        DomBuilder* builder = &parser->builder;
+        segment->open_count = builder->depth > 1 ? builder->depth - 1 : 0;
+        segment->open = (DomNode**)safe_malloc((segment->open_count + 1) * sizeof(DomNode*));
+        for (int i = 0; i < segment->open_count; i++) {
+            segment->open[i] = builder->open_elements[i + 1].node;
+        }
+        segment->document = (DomDocument*)dom_builder_take_root(builder);
+    }
+    segment->stats = parser->stats;
+    segment->builder = NULL;
+    parser_free(parser);
+    lexer_free(lexer);
+}
+
+static Atom remap_atom(const Segment* segment, Atom atom) {
+    return atom >= ATOM_STATIC_COUNT ? segment->remap[atom - ATOM_STATIC_COUNT] : atom;
+}
+
+// Moves the segment's names over to the final document's atom table. Runs
+// before the join, so the walk only meets the segment's own nodes.
+static void remap_segment(void* arg) {
+    Segment* segment = (Segment*)arg;
+    DomNode* root = &segment->document->root;
+    DomNode* node = root->first_child;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE) {
+            if (node->tag_atom >= ATOM_STATIC_COUNT) {
+                node->tag_atom = remap_atom(segment, node->tag_atom);
+                node->tag_name = (char*)atom_table_name(segment->atoms, node->tag_atom);
+            }
+            for (Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                if (attr->name_atom >= ATOM_STATIC_COUNT) {
+                    attr->name_atom = remap_atom(segment, attr->name_atom);
+                    attr->name = (char*)atom_table_name(segment->atoms, attr->name_atom);
+                }
+            }
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
+        }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
+    }
+}
+
+// Where to cut near `from`: a '<' that starts a tag. One that follows a
+// newline or a '>' is much less likely to sit in a comment or a quoted
+// value, so the first such '<' within half a segment wins; otherwise the
+// first tag start does. Returns `length` if there is none.
+static int find_cut(const char* input, int length, int from) {
+    int limit = from + PARALLEL_MIN_SEGMENT / 2;
+    int fallback = length;
+    while (from < length - 1) {
+        int lt = from + (int)scan_find_byte(input + from, length - from, '<');
+        if (lt >= length - 1 || (lt >= limit && fallback < length)) {
+            break;
+        }
+        unsigned char c = (unsigned char)input[lt + 1];
+        // ASCII letters only, as in the lexer's char_class; isalpha() would
+        // follow the locale.
+        if (c == '/' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+            if (lt > 0 && (input[lt - 1] == '\n' || input[lt - 1] == '>')) {
+                return lt;
+            }
+            if (fallback == length) {
+                fallback = lt;
+            }
+        }
+        from = lt + 1;
+    }
+    return fallback;
+}
+
+// The lexer's whole state between tokens is its position and insideTag.
+// `before` is in step with the sequential lexer; if its first token past
+// the cut equals the first token `after` lexed from scratch, and both
+// lexers end up in the same state, every later token agrees as well. A
+// cut inside a comment or a quoted value fails this check.
+static int cut_holds(const Segment* before, const Segment* after) {
+    Lexer* lexer = lexer_init_n(after->input + after->begin, after->input_length - after->begin);
+    lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
+    Token first = get_next_token(lexer);
+    int holds = first.type == before->boundary.type &&
+                first.type != TOKEN_ERROR && first.type != TOKEN_EOF &&
+                after->begin + first.span.offset == before->begin + before->boundary.span.offset &&
+                first.span.length == before->boundary.span.length &&
+                after->begin + lexer->current == before->begin + before->boundary_current &&
+                lexer->insideTag == before->boundary_inside;
+    lexer_free(lexer);
+    return holds;
+}
+
+// Same rule as the parser's own close tag check.
+static int closes_element(const InheritedClose* close, const DomNode* element) {
+    Atom atom = atom_lookup(close->name, close->length);
+    Atom open = element->tag_atom < ATOM_STATIC_COUNT ? element->tag_atom : ATOM_NONE;
+    if (atom != ATOM_NONE || open != ATOM_NONE) {
+        return atom == open;
+    }
+    return strncmp(element->tag_name, close->name, close->length) == 0 &&
+           element->tag_name[close->length] == '\0';
+}
+
+typedef struct {
+    DomNode** nodes;
+    int depth;
+    int capacity;
+} OpenStack;
+
+static void open_stack_push(OpenStack* stack, DomNode* node) {
+    if (stack->depth == stack->capacity) {
+        int capacity = stack->capacity ? stack->capacity * 2 : 64;
+        DomNode** grown = (DomNode**)realloc(stack->nodes, capacity * sizeof(DomNode*));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        stack->nodes = grown;
+        stack->capacity = capacity;
+    }
+    stack->nodes[stack->depth++] = node;
+}
+
+// Hangs the segment's top-level nodes under the elements open at its
+// start, replaying its inherited close tags in between. Returns 0 where
+// the sequential parse would have stopped: a close tag that does not
+// match, or one with nothing open.
+static int join_segment(OpenStack* stack, Segment* segment) {
+    const char* input_end = segment->input + segment->input_length;
+    DomNode* root = &segment->document->root;
+    DomNode* child = root->first_child;
+    int next_close = 0;
+    for (int index = 0; ; index++) {
+        while (next_close < segment->close_count && segment->closes[next_close].child_index == index) {
+            const InheritedClose* close = &segment->closes[next_close];
+            if (stack->depth <= 1 || !closes_element(close, stack->nodes[stack->depth - 1])) {
+                return 0;
+            }
+            // The parser took the next token to be the tag's '>'.
+            const char* name_end = close->name + close->length;
+            const char* gt = memchr(name_end, '>', input_end - name_end);
+            stack->nodes[stack->depth - 1]->source_end = gt ? (size_t)(gt + 1 - segment->input) : 0;
+            stack->depth--;
+            next_close++;
+        }
+        if (child == NULL) {
+            break;
+        }
+        DomNode* next = child->next_sibling;
+        add_child(stack->nodes[stack->depth - 1], child);
+        child = next;
+    }
+    for (int i = 0; i < segment->open_count; i++) {
+        open_stack_push(stack, segment->open[i]);
+    }
+    return 1;
+}
+
+// Builds the final tree in segment 0's document. Returns its root, or
+// NULL if the segments do not join up. Sets *max_depth to the deepest
+// nesting in the whole document.
+static DomNode* join_segments(Segment* segments, int count, int workers, int* max_depth) {
+    for (int i = 0; i < count; i++) {
+        if (!segments[i].ok || (i > 0 && !cut_holds(&segments[i - 1], &segments[i]))) {
+            return NULL;
+        }
+    }
+    DomDocument* document = segments[0].document;
+
+    ThreadPool* pool = NULL;
+    for (int i = 1; i < count; i++) {
+        Segment* segment = &segments[i];
+        const AtomTable* atoms = &segment->document->atoms;
+        if (atoms->count == 0) {
+            continue;
+        }
+        segment->remap = (Atom*)safe_malloc(atoms->count * sizeof(Atom));
+        for (int k = 0; k < atoms->count; k++) {
+            segment->remap[k] = atom_intern(&document->atoms, atoms->names[k], atoms->lengths[k]);
+        }
+        segment->atoms = &document->atoms;
+        if (pool == NULL) {
+            pool = thread_pool_create(workers);
+        }
+        thread_pool_submit(pool, remap_segment, segment);
+    }
+    if (pool != NULL) {
+        thread_pool_destroy(pool);
+    }
+
+    OpenStack stack = { NULL, 0, 0 };
+    open_stack_push(&stack, &document->root);
+    for (int i = 0; i < segments[0].open_count; i++) {
+        open_stack_push(&stack, segments[0].open[i]);
+    }
+    segments[0].document = NULL;
+    *max_depth = segments[0].peak;
+    int joined = 1;
+    for (int i = 1; i < count && joined; i++) {
+        if (stack.depth - 1 + segments[i].peak > *max_depth) {
+            *max_depth = stack.depth - 1 + segments[i].peak;
+        }
+        // From here on the segment's memory belongs to the final document.
+        arena_adopt(document->arena, segments[i].document->arena);
+        joined = join_segment(&stack, &segments[i]);
+        segments[i].document = NULL;
+    }
+    joined = joined && stack.depth == 1;
+    free(stack.nodes);
+    if (!joined) {
+        free_dom_tree(&document->root);
+        return NULL;
+    }
+    return &document->root;
+}
+
+DomNode* parse_parallel(Parser* parser, int workers) {
+    Lexer* lexer = parser->lexer;
+    if (workers < 2 || lexer->streaming || lexer->current != 0 ||
+        parser->events != &dom_builder_events || parser->state != PARSER_CONTENT ||
+        lexer->length < 2 * PARALLEL_MIN_SEGMENT ||
+        (parser->options.max_input_bytes && (size_t)lexer->length > parser->options.max_input_bytes)) {
+        return parse(parser);
+    }
+
+    // Segments apply the limits to their own part; whitespace and the
+    // index are done once the tree is whole.
+    ParserOptions segment_options = parser->options;
+    segment_options.whitespace = WHITESPACE_KEEP;
+    segment_options.build_index = 0;
+    segment_options.pipeline = 0;
+
+    double start = stats_now_ms();
+    AllocStats allocs = alloc_stats();
+    int length = lexer->length;
+    int count = length / PARALLEL_MIN_SEGMENT < workers ? length / PARALLEL_MIN_SEGMENT : workers;
+    Segment* segments = (Segment*)safe_malloc(count * sizeof(Segment));
+    memset(segments, 0, count * sizeof(Segment));
+    int used = 0;
+    int begin = 0;
+    while (begin < length && used < count) {
+        int target = (int)((long long)length * (used + 1) / count);
+        int end = used + 1 == count ? length : find_cut(lexer->source, length, target > begin ? target : begin + 1);
+        Segment* segment = &segments[used++];
+        segment->input = lexer->source;
+        segment->input_length = length;
+        segment->options = &segment_options;
+        segment->begin = begin;
+        segment->end = end;
+        segment->last = end == length;
+        begin = end;
+    }
+
+    DomNode* root = NULL;
+    if (used > 1) {
+        ThreadPool* pool = thread_pool_create(used < workers ? used : workers);
+        for (int i = 0; i < used; i++) {
+            thread_pool_submit(pool, parse_segment, &segments[i]);
+        }
+        thread_pool_destroy(pool);
+        root = join_segments(segments, used, workers, &parser->stats.max_depth);
+    }
+    if (root != NULL) {
+        // The segments between them processed every token exactly once.
+        ParseStats* stats = &parser->stats;
+        for (int i = 0; i < used; i++) {
+            for (int t = 0; t < TOKEN_TYPE_COUNT; t++) {
+                stats->tokens[t] += segments[i].stats.tokens[t];
+            }
+            stats->elements += segments[i].stats.elements;
+            stats->text_nodes += segments[i].stats.text_nodes;
+            stats->attributes += segments[i].stats.attributes;
+            stats->allocations += segments[i].stats.allocations;
+            stats->allocated_bytes += segments[i].stats.allocated_bytes;
+        }
+        stats->bytes_lexed = (size_t)(segments[used - 1].begin + segments[used - 1].boundary_current);
+
+        // A limit the whole document goes over although no segment did
+        // on its own: let parse() find the exact place and report it.
+        const ParserOptions* options = &parser->options;
+        if ((options->max_depth && stats->max_depth > options->max_depth) ||
+            (options->max_nodes && stats->elements + stats->text_nodes > options->max_nodes) ||
+            (options->max_dom_bytes && dom_document_bytes(root) > options->max_dom_bytes)) {
+            free_dom_tree(root);
+            root = NULL;
+        }
+    }
+
+    for (int i = 0; i < used; i++) {
+        if (segments[i].document != NULL) {
+            free_dom_tree(&segments[i].document->root);
+        }
+        free(segments[i].closes);
+        free(segments[i].open);
+        free(segments[i].remap);
+    }
+    free(segments);
+
+    if (root == NULL) {
+        // A cut fell inside a token or the input has an error: parse it
+        // the ordinary way, which also produces the usual error message.
+        // The time spent on the attempt still counts.
+        double elapsed = stats_now_ms() - start;
+        memset(&parser->stats, 0, sizeof(parser->stats));
+        parser->stats.phase_ms[STATS_PHASE_PARSE] = elapsed;
+        return parse(parser);
+    }
+    dom_normalize_whitespace(root, parser->options.whitespace);
+    if (parser->options.build_index) {
+        dom_build_index(root);
+    }
+    AllocStats now = alloc_stats();
+    parser->stats.allocations += now.count - allocs.count;
+    parser->stats.allocated_bytes += now.bytes - allocs.bytes;
+    parser->stats.phase_ms[STATS_PHASE_PARSE] += stats_now_ms() - start;
+    parser->state = PARSER_DONE;
+    return root;
+}
@@ -0,0 +1,22 @@
+#ifndef PARALLEL_PARSE_H
+#define PARALLEL_PARSE_H
+
+#include "parser.h"
+
+// Inputs shorter than two segments of this size are parsed sequentially.
+#define PARALLEL_MIN_SEGMENT (64 * 1024)
+
+// Parses the input of `parser` on up to `workers` threads and returns the
+// tree parse() would have built. The buffer is cut in front of tags,
+// every segment is lexed and parsed speculatively on its own, and the
+// partial trees are joined once each cut is confirmed to fall between two
+// tokens of the sequential token stream. If a cut turns out to be wrong
+// (inside a comment or a quoted value, say), or any segment fails, the
+// whole input is parsed again with parse(), so errors are reported exactly
+// as before.
+//
+// `parser` must be fresh, use the default DOM consumer and read from a
+// lexer made by lexer_init() or lexer_init_n(); otherwise this is parse().
+DomNode* parse_parallel(Parser* parser, int workers);
+
+#endif
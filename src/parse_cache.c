@@ -0,0 +1,328 @@
+#include "parse_cache.h"
+#include "lexer.h"
+#include "parser.h"
+#include "utils.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define XXH_PRIME1 11400714785074694791ULL
+#define XXH_PRIME2 14029467366897019727ULL
+#define XXH_PRIME3 1609587929392839161ULL
+#define XXH_PRIME4 9650029242287828579ULL
+#define XXH_PRIME5 2870177450012600261ULL
+
+static uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME2;
+    acc = rotl64(acc, 31);
+    return acc * XXH_PRIME1;
+}
+
+static uint64_t xxh_merge(uint64_t acc, uint64_t value) {
+    acc ^= xxh_round(0, value);
+    return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+uint64_t hash_bytes(const void* data, size_t length, uint64_t seed) {
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* end = p + length;
+    uint64_t h;
+
+    if (length >= 32) {
+        uint64_t v1 = seed + XXH_PRIME1 + XXH_PRIME2;
+        uint64_t v2 = seed + XXH_PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME1;
+        do {
+            v1 = xxh_round(v1, read64(p));
+            v2 = xxh_round(v2, read64(p + 8));
+            v3 = xxh_round(v3, read64(p + 16));
+            v4 = xxh_round(v4, read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = xxh_merge(h, v1);
+        h = xxh_merge(h, v2);
+        h = xxh_merge(h, v3);
+        h = xxh_merge(h, v4);
+    } else {
+        h = seed + XXH_PRIME5;
+    }
+    h += (uint64_t)length;
+
+    for (; end - p >= 8; p += 8) {
+        h ^= xxh_round(0, read64(p));
+        h = rotl64(h, 27) * XXH_PRIME1 + XXH_PRIME4;
+    }
+    if (end - p >= 4) {
+        h ^= (uint64_t)read32(p) * XXH_PRIME1;
+        h = rotl64(h, 23) * XXH_PRIME2 + XXH_PRIME3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * XXH_PRIME5;
+        h = rotl64(h, 11) * XXH_PRIME1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME2;
+    h ^= h >> 29;
+    h *= XXH_PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+struct CachedDocument {
+    int refcount;               // atomic
+    DomNode* root;
+    char* error;
+    char* input;                // private copy, to confirm hash matches
+    size_t length;
+    uint64_t hash;
+    size_t bytes;               // charged against the budget
+    CachedDocument* chain;      // bucket list
+    CachedDocument* newer;      // LRU list, most recent at the head
+    CachedDocument* older;
+};
+
+struct ParseCache {
+    pthread_mutex_t lock;
+    CachedDocument** buckets;
+    size_t bucket_mask;
+    CachedDocument* newest;
+    CachedDocument* oldest;
+    ParseCacheStats stats;
+    ParserOptions options;
+};
+
+ParseCache* parse_cache_create(size_t budget, const ParserOptions* options) {
+    ParseCache* cache = (ParseCache*)safe_malloc(sizeof(ParseCache));
+    pthread_mutex_init(&cache->lock, NULL);
+    cache->bucket_mask = 63;
+    cache->buckets = (CachedDocument**)calloc(cache->bucket_mask + 1, sizeof(CachedDocument*));
+    if (cache->buckets == NULL) {
+        fprintf(stderr, "Fatal: Memory allocation failed.\n");
+        exit(EXIT_FAILURE);
+    }
+    cache->newest = NULL;
+    cache->oldest = NULL;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    cache->stats.budget = budget;
+    if (options != NULL) {
+        cache->options = *options;
+    } else {
+        memset(&cache->options, 0, sizeof(cache->options));
+    }
+    return cache;
+}
+
+void cached_document_retain(CachedDocument* document) {
+    __atomic_add_fetch(&document->refcount, 1, __ATOMIC_RELAXED);
+}
+
+void cached_document_release(CachedDocument* document) {
+    if (document == NULL || __atomic_sub_fetch(&document->refcount, 1, __ATOMIC_ACQ_REL) > 0) {
+        return;
+    }
+    free_dom_tree(document->root);
+    free(document->error);
+    free(document->input);
+    free(document);
+}
+
+const DomNode* cached_document_root(const CachedDocument* document) {
+    return document->root;
+}
+
+const char* cached_document_error(const CachedDocument* document) {
+    return document->error;
+}
+
+static CachedDocument* parse_document(const ParserOptions* options, const char* input, size_t length,
+                                      uint64_t hash) {
+    CachedDocument* document = (CachedDocument*)safe_malloc(sizeof(CachedDocument));
+    Lexer* lexer = lexer_init_n(input, length);
+    Parser* parser = parser_init(lexer, options);
+    document->root = parse(parser);
+    document->error = parser->has_error ? safe_strdup(parser->error_message) : NULL;
+    // Readers on other threads must never trigger the lazy decoding in
+    // dom_text(), so do it all before the document is shared.
+    dom_decode_tree(document->root);
+    parser_free(parser);
+    lexer_free(lexer);
+
+    document->refcount = 1;
+    document->input = (char*)safe_malloc(length ? length : 1);
+    memcpy(document->input, input, length);
+    document->length = length;
+    document->hash = hash;
+    document->bytes = sizeof(CachedDocument) + length + dom_document_bytes(document->root) +
+                      (document->error ? strlen(document->error) + 1 : 0);
+    document->chain = NULL;
+    document->newer = NULL;
+    document->older = NULL;
+    return document;
+}
+
+// --- Everything below runs with cache->lock held ---
+
+static CachedDocument** bucket_of(ParseCache* cache, uint64_t hash) {
+    return &cache->buckets[hash & cache->bucket_mask];
+}
+
+static CachedDocument* find(ParseCache* cache, const char* input, size_t length, uint64_t hash) {
+    for (CachedDocument* d = *bucket_of(cache, hash); d != NULL; d = d->chain) {
+        if (d->hash == hash && d->length == length && memcmp(d->input, input, length) == 0) {
+            return d;
+        }
+    }
+    return NULL;
+}
+
+static void lru_unlink(ParseCache* cache, CachedDocument* d) {
+    if (d->newer) d->newer->older = d->older; else cache->newest = d->older;
+    if (d->older) d->older->newer = d->newer; else cache->oldest = d->newer;
+    d->newer = NULL;
+    d->older = NULL;
+}
+
+static void lru_push(ParseCache* cache, CachedDocument* d) {
+    d->newer = NULL;
+    d->older = cache->newest;
+    if (cache->newest) cache->newest->newer = d; else cache->oldest = d;
+    cache->newest = d;
+}
+
+static void grow_buckets(ParseCache* cache) {
+    size_t count = (cache->bucket_mask + 1) * 2;
+    CachedDocument** buckets = (CachedDocument**)calloc(count, sizeof(CachedDocument*));
+    if (buckets == NULL) {
+        return;     // keep the longer chains rather than fail
+    }
+    for (size_t i = 0; i <= cache->bucket_mask; i++) {
+        CachedDocument* d = cache->buckets[i];
+        while (d != NULL) {
+            CachedDocument* next = d->chain;
+            d->chain = buckets[d->hash & (count - 1)];
+            buckets[d->hash & (count - 1)] = d;
+            d = next;
+        }
+    }
+    free(cache->buckets);
+    cache->buckets = buckets;
+    cache->bucket_mask = count - 1;
+}
+
+// Takes an entry out of the cache; returns the reference the cache held.
+static CachedDocument* remove_entry(ParseCache* cache, CachedDocument* d) {
+    CachedDocument** link = bucket_of(cache, d->hash);
+    while (*link != d) {
+        link = &(*link)->chain;
+    }
+    *link = d->chain;
+    d->chain = NULL;
+    lru_unlink(cache, d);
+    cache->stats.entries--;
+    cache->stats.bytes_used -= d->bytes;
+    return d;
+}
+
+static void insert(ParseCache* cache, CachedDocument* d) {
+    if (cache->stats.entries + 1 > cache->bucket_mask + 1) {
+        grow_buckets(cache);
+    }
+    CachedDocument** bucket = bucket_of(cache, d->hash);
+    d->chain = *bucket;
+    *bucket = d;
+    lru_push(cache, d);
+    cache->stats.entries++;
+    cache->stats.bytes_used += d->bytes;
+    cached_document_retain(d);      // the cache's own reference
+}
+
+// --- End of locked helpers ---
+
+CachedDocument* parse_cache_get(ParseCache* cache, const char* input, size_t length) {
+    uint64_t hash = hash_bytes(input, length, 0);
+
+    pthread_mutex_lock(&cache->lock);
+    CachedDocument* hit = find(cache, input, length, hash);
+    if (hit != NULL) {
+        lru_unlink(cache, hit);
+        lru_push(cache, hit);
+        cached_document_retain(hit);
+        cache->stats.hits++;
+        pthread_mutex_unlock(&cache->lock);
+        return hit;
+    }
+    cache->stats.misses++;
+    pthread_mutex_unlock(&cache->lock);
+
+    // Parse without the lock so other lookups are not held up.
+    CachedDocument* document = parse_document(&cache->options, input, length, hash);
+    if (document->bytes > cache->stats.budget) {
+        return document;
+    }
+
+    CachedDocument* evicted = NULL;
+    pthread_mutex_lock(&cache->lock);
+    CachedDocument* raced = find(cache, input, length, hash);
+    if (raced != NULL) {
+        // Another thread parsed the same input meanwhile; share its copy.
+        cached_document_retain(raced);
+        pthread_mutex_unlock(&cache->lock);
+        cached_document_release(document);
+        return raced;
+    }
+    while (cache->stats.bytes_used + document->bytes > cache->stats.budget && cache->oldest != NULL) {
+        CachedDocument* victim = remove_entry(cache, cache->oldest);
+        victim->chain = evicted;    // released after unlocking
+        evicted = victim;
+        cache->stats.evictions++;
+    }
+    insert(cache, document);
+    pthread_mutex_unlock(&cache->lock);
+
+    while (evicted != NULL) {
+        CachedDocument* next = evicted->chain;
+        cached_document_release(evicted);
+        evicted = next;
+    }
+    return document;
+}
+
+ParseCacheStats parse_cache_stats(ParseCache* cache) {
+    pthread_mutex_lock(&cache->lock);
+    ParseCacheStats stats = cache->stats;
+    pthread_mutex_unlock(&cache->lock);
+    return stats;
+}
+
+void parse_cache_destroy(ParseCache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+    while (cache->oldest != NULL) {
+        cached_document_release(remove_entry(cache, cache->oldest));
+    }
+    free(cache->buckets);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
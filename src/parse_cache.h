@@ -0,0 +1,61 @@
+#ifndef PARSE_CACHE_H
+#define PARSE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dom.h"
+#include "parser.h"
+
+// In-process cache of parsed documents keyed by a 64-bit hash of the
+// input bytes. Hits hand out a shared reference to an immutable DOM
+// instead of lexing and parsing again. Entries are evicted least recently
+// used first once their total size exceeds the budget; an evicted
+// document stays alive until its last reference is released.
+//
+// All functions are safe to call from several threads at once.
+
+typedef struct ParseCache ParseCache;
+
+// A parse result: the tree, or the error the input produced.
+typedef struct CachedDocument CachedDocument;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t bytes_used;          // inputs + documents currently cached
+    size_t budget;
+} ParseCacheStats;
+
+// `budget` is in bytes and covers the stored inputs and their DOMs.
+// Every document is parsed with `options` (copied; NULL for defaults).
+ParseCache* parse_cache_create(size_t budget, const ParserOptions* options);
+
+// Drops the cache's references; documents still held elsewhere survive.
+void parse_cache_destroy(ParseCache* cache);
+
+// Returns a new reference to the document for `input`, parsing it only on
+// a miss. Hash matches are confirmed byte for byte against the stored
+// input. Results larger than the whole budget are returned uncached.
+CachedDocument* parse_cache_get(ParseCache* cache, const char* input, size_t length);
+
+ParseCacheStats parse_cache_stats(ParseCache* cache);
+
+// The shared tree. Callers must not modify it. Its text and attribute
+// values are already decoded, so dom_text() and dom_attribute_value()
+// are safe to call on it concurrently. NULL only if parsing
+// failed before the root was created.
+const DomNode* cached_document_root(const CachedDocument* document);
+
+// The parser's error message, or NULL if the input parsed cleanly.
+const char* cached_document_error(const CachedDocument* document);
+
+void cached_document_retain(CachedDocument* document);
+
+void cached_document_release(CachedDocument* document);
+
+// 64-bit xxHash (XXH64) of `data`.
+uint64_t hash_bytes(const void* data, size_t length, uint64_t seed);
+
+#endif
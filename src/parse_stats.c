@@ -0,0 +1,59 @@
+#define _POSIX_C_SOURCE 200809L
+#include "parse_stats.h"
+#include <time.h>
+
+static const char* const token_names[TOKEN_TYPE_COUNT] = {
+    "open_tag", "close_tag", "self_close", "gt", "text",
+    "attr_name", "attr_equals", "attr_value", "error", "eof", "need_more"
+};
+
+static const char* const phase_names[STATS_PHASE_COUNT] = {
+    "read", "parse", "serialize", "free"
+};
+
+double stats_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+void parse_stats_print(const ParseStats* stats, FILE* out, int json) {
+    const struct { const char* name; size_t value; } counts[] = {
+        { "bytes_lexed", stats->bytes_lexed },
+        { "elements", stats->elements },
+        { "text_nodes", stats->text_nodes },
+        { "attributes", stats->attributes },
+        { "allocations", stats->allocations },
+        { "allocated_bytes", stats->allocated_bytes },
+        { "max_depth", (size_t)stats->max_depth },
+    };
+    size_t count_total = sizeof(counts) / sizeof(counts[0]);
+
+    if (json) {
+        fprintf(out, "{\"tokens\":{");
+        for (int i = 0; i < TOKEN_NEED_MORE; i++) {
+            fprintf(out, "%s\"%s\":%zu", i ? "," : "", token_names[i], stats->tokens[i]);
+        }
+        fprintf(out, "}");
+        for (size_t i = 0; i < count_total; i++) {
+            fprintf(out, ",\"%s\":%zu", counts[i].name, counts[i].value);
+        }
+        fprintf(out, ",\"phase_ms\":{");
+        for (int i = 0; i < STATS_PHASE_COUNT; i++) {
+            fprintf(out, "%s\"%s\":%.3f", i ? "," : "", phase_names[i], stats->phase_ms[i]);
+        }
+        fprintf(out, "}}\n");
+        return;
+    }
+
+    fprintf(out, "Parse statistics:\n");
+    for (int i = 0; i < TOKEN_NEED_MORE; i++) {
+        fprintf(out, "  tokens.%-13s %zu\n", token_names[i], stats->tokens[i]);
+    }
+    for (size_t i = 0; i < count_total; i++) {
+        fprintf(out, "  %-20s %zu\n", counts[i].name, counts[i].value);
+    }
+    for (int i = 0; i < STATS_PHASE_COUNT; i++) {
+        fprintf(out, "  time.%-15s %.3f ms\n", phase_names[i], stats->phase_ms[i]);
+    }
+}
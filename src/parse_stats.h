@@ -0,0 +1,40 @@
+#ifndef PARSE_STATS_H
+#define PARSE_STATS_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "lexer.h"
+
+#define TOKEN_TYPE_COUNT (TOKEN_NEED_MORE + 1)
+
+// Wall-clock phases of handling one document. The parser times
+// STATS_PHASE_PARSE; the caller times the rest (see main.c).
+typedef enum {
+    STATS_PHASE_READ,
+    STATS_PHASE_PARSE,       // lexing and parsing, which run interleaved
+    STATS_PHASE_SERIALIZE,
+    STATS_PHASE_FREE,
+    STATS_PHASE_COUNT
+} StatsPhase;
+
+// What one parse did, kept in Parser::stats. The counters are always on:
+// a few increments per token and two clock reads per call into the parser.
+typedef struct {
+    size_t tokens[TOKEN_TYPE_COUNT];  // tokens processed, by TokenType
+    size_t bytes_lexed;
+    size_t elements;           // start tags handed to the consumer
+    size_t text_nodes;
+    size_t attributes;
+    size_t allocations;        // safe_malloc() calls while parsing, on
+    size_t allocated_bytes;    // every thread that took part
+    int max_depth;             // deepest nesting of open elements
+    double phase_ms[STATS_PHASE_COUNT];
+} ParseStats;
+
+// Monotonic clock in milliseconds, for timing phases.
+double stats_now_ms(void);
+
+// Writes `stats` as "name: value" lines, or as a single JSON object.
+void parse_stats_print(const ParseStats* stats, FILE* out, int json);
+
+#endif
@@ -1,44 +1,74 @@
 #include "parser.h"
 #include "utils.h" 
+#include "token_pipeline.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
 
-static void advance(Parser* parser);
+static void process_token(Parser* parser, Token token);
 
 
-static int expect(Parser* parser, TokenType type, const char* error_msg);
+static void pump(Parser* parser);
 
 
-static int check(Parser* parser, TokenType type);
+static int pump_pipelined(Parser* parser);
 
-static DomNode* parse_element(Parser* parser);
 
+static void parse_content(Parser* parser);
 
-static void parse_attributes(Parser* parser, DomNode* node);
 
+static int parse_attributes(Parser* parser);
 
-static DomNode* parse_children(Parser* parser);
 
+static void push_open_element(Parser* parser, const char* name, int length, Atom atom);
 
-static DomNode* parse_node(Parser* parser);
 
-static int is_self_closing_tag(const char* tag_name);
+static void pop_open_element(Parser* parser);
 
 
 static void parser_error(Parser* parser, const char* message);
 
 
-Parser* parser_init(Lexer* lexer) {
+static void input_limit_error(Parser* parser, size_t limit);
+
+
+static void record_progress(Parser* parser, double start, AllocStats allocs);
+
+
+Parser* parser_init(Lexer* lexer, const ParserOptions* options) {
     Parser* parser = (Parser*)safe_malloc(sizeof(Parser));
     parser->lexer = lexer;
     parser->has_error = 0;
     parser->error_message = NULL;
     parser->previous_token.lexeme = NULL;
     parser->current_token.lexeme = NULL;
-    advance(parser);
+    if (options != NULL) {
+        parser->options = *options;
+    } else {
+        memset(&parser->options, 0, sizeof(parser->options));
+    }
+    dom_builder_init(&parser->builder);
+    parser->builder.build_index = parser->options.build_index;
+    parser->builder.whitespace = parser->options.whitespace;
+    memset(&parser->stats, 0, sizeof(parser->stats));
+    parser->speculative = 0;
+    parser->events = &dom_builder_events;
+    parser->user_data = &parser->builder;
+    parser->state = PARSER_CONTENT;
+    parser->names = NULL;
+    parser->names_length = 0;
+    parser->names_capacity = 0;
+    parser->open_names = NULL;
+    parser->depth = 0;
+    parser->depth_capacity = 0;
+    parser->pending_is_void = 0;
+    parser->attr_name = NULL;
+    parser->attr_name_length = 0;
+    parser->attr_name_capacity = 0;
+    parser->attribute_count = 0;
+    lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
     
     return parser;
 }
@@ -48,176 +78,454 @@ void parser_free(Parser* parser) {
         free_token_lexeme(&parser->current_token);
         free_token_lexeme(&parser->previous_token);
         free(parser->error_message);
+        dom_builder_free(&parser->builder);
+        free(parser->names);
+        free(parser->open_names);
+        free(parser->attr_name);
         free(parser);
     }
 }
 
+void parser_set_events(Parser* parser, const ParserEvents* events, void* user_data) {
+    parser->events = events;
+    parser->user_data = user_data;
+}
+
 DomNode* parse(Parser* parser) {
-    DomNode* root = create_element_node("<!Doctype html>");
-    root->first_child = parse_children(parser);
+    return parser_finish(parser);
+}
 
+int parser_feed(Parser* parser, const char* chunk, size_t length) {
+    if (parser->state != PARSER_DONE) {
+        // Checked before the chunk is buffered: an unterminated comment,
+        // value or text run would otherwise grow the buffer past the
+        // limit before any token reached it.
+        size_t limit = parser->options.max_input_bytes;
+        Lexer* lexer = parser->lexer;
+        if (limit && (size_t)(lexer->base_offset + lexer->length) + length > limit) {
+            input_limit_error(parser, limit);
+            return 0;
+        }
+        if (lexer_feed(lexer, chunk, length) != 0) {
+            input_limit_error(parser, INPUT_MAX_BYTES);
+            return 0;
+        }
+        pump(parser);
+    }
+    return !parser->has_error;
+}
+
+DomNode* parser_finish(Parser* parser) {
+    lexer_finish(parser->lexer);
+    if (!pump_pipelined(parser)) {
+        pump(parser);
+    }
+
+    if (parser->events != &dom_builder_events) {
+        return NULL;
+    }
     if (parser->has_error) {
-        free_dom_tree(root);
+        dom_builder_free(&parser->builder);
         return NULL;
     }
 
-    return root;
+    return dom_builder_take_root(&parser->builder);
+}
+
+int parser_parse_until(Parser* parser, int end, Token* boundary) {
+    double start = stats_now_ms();
+    AllocStats allocs = alloc_stats();
+    int reached = 0;
+    while (parser->state != PARSER_DONE) {
+        Token token = get_next_token(parser->lexer);
+        if (token.span.offset >= end && token.type != TOKEN_ERROR) {
+            *boundary = token;
+            reached = 1;
+            break;
+        }
+        process_token(parser, token);
+    }
+    record_progress(parser, start, allocs);
+    return reached;
 }
 
 
 static void parser_error(Parser* parser, const char* message) {
+    parser->state = PARSER_DONE;
     if (parser->has_error) return;
     
     parser->has_error = 1;
+    int line;
+    int col;
+    lexer_position(parser->lexer, parser->current_token.span.offset, &line, &col);
     char buffer[512];
-    snprintf(buffer, sizeof(buffer), "[Line %d, Col %d] Error: %s. (Got token %d: '%s')",
-            parser->current_token.line,
-            parser->current_token.col,
+    snprintf(buffer, sizeof(buffer), "[Line %d, Col %d] Error: %s. (Got token %d: '%.*s')",
+            line,
+            col,
             message,
             parser->current_token.type,
-            parser->current_token.lexeme);
+            token_length(&parser->current_token),
+            token_text(parser->lexer, &parser->current_token));
             
     parser->error_message = safe_strdup(buffer);
+    if (parser->events->on_error) {
+        parser->events->on_error(parser->user_data, parser->error_message);
+    }
 }
 
-static void advance(Parser* parser) {
-    if (parser->has_error) return;
-    free_token_lexeme(&parser->previous_token);
+// Pulls tokens until the document is complete or the lexer needs input.
+static void pump(Parser* parser) {
+    double start = stats_now_ms();
+    AllocStats allocs = alloc_stats();
+    while (parser->state != PARSER_DONE) {
+        Token token = get_next_token(parser->lexer);
+        if (token.type == TOKEN_NEED_MORE) {
+            free_token_lexeme(&token);
+            break;
+        }
+        process_token(parser, token);
+    }
+    record_progress(parser, start, allocs);
+}
 
-    parser->previous_token = parser->current_token;
-    parser->current_token = get_next_token(parser->lexer);
-    if (parser->current_token.type == TOKEN_ERROR) {
-        parser_error(parser, parser->current_token.lexeme);
+// pump() with the lexer on its own thread (ParserOptions.pipeline). Only
+// for a whole, not yet started input of some size; returns 0 without
+// doing anything otherwise, or if no thread could be started.
+static int pump_pipelined(Parser* parser) {
+    Lexer* lexer = parser->lexer;
+    if (!parser->options.pipeline || lexer->streaming || lexer->current != 0 ||
+        parser->state != PARSER_CONTENT || lexer->length < TOKEN_PIPELINE_MIN_INPUT) {
+        return 0;
+    }
+    double start = stats_now_ms();
+    AllocStats allocs = alloc_stats();
+    TokenPipeline* pipeline = token_pipeline_start(lexer);
+    if (pipeline == NULL) {
+        return 0;
+    }
+
+    PipelineToken batch[TOKEN_PIPELINE_BATCH];
+    PipelineToken last = {{TOKEN_EOF, NULL, {0, 0}, NULL}, 0, 0};
+    while (parser->state != PARSER_DONE) {
+        int count = token_pipeline_take(pipeline, batch, TOKEN_PIPELINE_BATCH);
+        int i = 0;
+        while (i < count && parser->state != PARSER_DONE) {
+            process_token(parser, batch[i].token);
+            last = batch[i++];
+        }
+        // Tokens after the end of the document were lexed ahead for nothing.
+        for (; i < count; i++) {
+            free_token_lexeme(&batch[i].token);
+        }
     }
+    token_pipeline_stop(pipeline);
+
+    // Leave the lexer where pump() would have: just past the last token
+    // the parser read.
+    lexer->current = last.end;
+    lexer->insideTag = last.inside_tag;
+    record_progress(parser, start, allocs);
+    return 1;
 }
 
-static int check(Parser* parser, TokenType type) {
-    return parser->current_token.type == type;
+// Reports a ParserOptions limit that the current token goes over.
+static void limit_error(Parser* parser, const char* what, size_t limit) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s exceeds the limit of %zu", what, limit);
+    parser_error(parser, msg);
 }
 
-static int expect(Parser* parser, TokenType type, const char* error_msg) {
-    if (check(parser, type)) {
-        advance(parser);
-        return 1;
-    }
-    parser_error(parser, error_msg);
-    return 0;
+// For a chunk that is refused before it is lexed: the error is reported
+// at the end of the input taken so far.
+static void input_limit_error(Parser* parser, size_t limit) {
+    Token token;
+    token.type = TOKEN_NEED_MORE;
+    token.lexeme = NULL;
+    token.message = NULL;
+    token.span.offset = parser->lexer->length;
+    token.span.length = 0;
+    free_token_lexeme(&parser->previous_token);
+    parser->previous_token = parser->current_token;
+    parser->current_token = token;
+    limit_error(parser, "Input size in bytes", limit);
 }
 
-static DomNode* parse_node(Parser* parser) {
-    if (check(parser, TOKEN_OPEN_TAG)) {
-        return parse_element(parser);
+// Limits on what the current token adds to the document. Returns 0 after
+// reporting an error.
+static int within_limits(Parser* parser) {
+    const ParserOptions* options = &parser->options;
+    if (options->max_nodes && parser->stats.elements + parser->stats.text_nodes > options->max_nodes) {
+        limit_error(parser, "Node count", options->max_nodes);
+        return 0;
     }
-    if (check(parser, TOKEN_TEXT)) {
-        DomNode* node = create_text_node(parser->current_token.lexeme);
-        advance(parser); 
-        return node;
+    if (options->max_dom_bytes && parser->events == &dom_builder_events &&
+        parser->builder.document != NULL &&
+        dom_document_bytes(&parser->builder.document->root) > options->max_dom_bytes) {
+        limit_error(parser, "DOM size in bytes", options->max_dom_bytes);
+        return 0;
     }
-    return NULL;
+    return 1;
+}
+
+// Books the time and allocations of one run of the token loop.
+static void record_progress(Parser* parser, double start, AllocStats allocs) {
+    AllocStats now = alloc_stats();
+    parser->stats.allocations += now.count - allocs.count;
+    parser->stats.allocated_bytes += now.bytes - allocs.bytes;
+    parser->stats.bytes_lexed = (size_t)(parser->lexer->base_offset + parser->lexer->current);
+    parser->stats.phase_ms[STATS_PHASE_PARSE] += stats_now_ms() - start;
 }
 
-static DomNode* parse_children(Parser* parser) {
-    DomNode* first_child = NULL;
-    DomNode* current_child = NULL;
-    while (!check(parser, TOKEN_CLOSE_TAG) && !check(parser, TOKEN_EOF)) {
-        if (parser->has_error) return first_child;
+static void process_token(Parser* parser, Token token) {
+    parser->stats.tokens[token.type]++;
+    free_token_lexeme(&parser->previous_token);
+    parser->previous_token = parser->current_token;
+    parser->current_token = token;
+    parser->builder.token_start = (size_t)(parser->lexer->base_offset + token.span.offset);
+    parser->builder.token_end = parser->builder.token_start + token.span.length;
+
+    if (token.type == TOKEN_ERROR) {
+        parser_error(parser, token.message);
+        return;
+    }
+    if (parser->options.max_input_bytes &&
+        (size_t)(parser->lexer->base_offset + token.span.offset + token.span.length) > parser->options.max_input_bytes) {
+        limit_error(parser, "Input size in bytes", parser->options.max_input_bytes);
+        return;
+    }
 
-        DomNode* child_node = parse_node(parser);
-        if (child_node == NULL) {
-            if (!check(parser, TOKEN_EOF)) {
-                 parser_error(parser, "Unexpected token while parsing children.");
+    switch (parser->state) {
+        case PARSER_CONTENT:
+            parse_content(parser);
+            break;
+        case PARSER_ATTRIBUTES:
+        case PARSER_ATTR_EQUALS:
+        case PARSER_ATTR_VALUE:
+            // A boolean attribute ends at the next token, which is then
+            // read again as part of the start tag.
+            while (parse_attributes(parser)) {
             }
             break;
-        }
+        case PARSER_CLOSE_GT:
+            if (token.type != TOKEN_GT) {
+                parser_error(parser, "Expected '>' after closing tag name.");
+                return;
+            }
+            dom_builder_end_tag_done(&parser->builder);
+            parser->state = PARSER_CONTENT;
+            break;
+        case PARSER_DONE:
+            break;
+    }
+}
 
-        if (first_child == NULL) {
-            first_child = child_node;
-            current_child = child_node;
-        } else {
-            current_child->next_sibling = child_node;
-            child_node->parent = current_child->parent;
-            current_child = child_node;
+static void push_open_element(Parser* parser, const char* name, int length, Atom atom) {
+    if (parser->depth == parser->depth_capacity) {
+        int capacity = parser->depth_capacity ? parser->depth_capacity * 2 : 32;
+        OpenName* grown = (OpenName*)realloc(parser->open_names, capacity * sizeof(OpenName));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
         }
+        parser->open_names = grown;
+        parser->depth_capacity = capacity;
     }
-    
-    return first_child;
-}
-
-static void parse_attributes(Parser* parser, DomNode* node) {
-    while (check(parser, TOKEN_ATTR_NAME)) {
-        if (parser->has_error) return;
-        char* name = safe_strdup(parser->current_token.lexeme);
-        advance(parser); 
-        
-        char* value = safe_strdup("true");
-
-        if (check(parser, TOKEN_ATTR_EQUALS)) {
-            advance(parser); // Consume '='
-            if (expect(parser, TOKEN_ATTR_VALUE, "Expected attribute value.")) {
-                free(value);
-                value = safe_strdup(parser->previous_token.lexeme);
-            }
+    if (parser->names_length + length + 1 > parser->names_capacity) {
+        int capacity = parser->names_capacity ? parser->names_capacity : 256;
+        while (capacity < parser->names_length + length + 1) {
+            capacity *= 2;
         }
-        
-        add_attribute(node, name, value);
-        free(name);
-        free(value);
+        char* grown = (char*)realloc(parser->names, capacity);
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        parser->names = grown;
+        parser->names_capacity = capacity;
+    }
+    parser->open_names[parser->depth].offset = parser->names_length;
+    parser->open_names[parser->depth].atom = atom;
+    parser->depth++;
+    if (parser->depth > parser->stats.max_depth) {
+        parser->stats.max_depth = parser->depth;
     }
+    memcpy(parser->names + parser->names_length, name, length);
+    parser->names_length += length;
+    parser->names[parser->names_length++] = '\0';
 }
 
-static int is_self_closing_tag(const char* tag_name) {
-    const char* self_closing[] = {
-        "area", "base", "br", "col", "embed", "hr", "img", 
-        "input", "link", "meta", "param", "source", "track", "wbr",
-        NULL 
-    };
-    
-    for (int i = 0; self_closing[i]; i++) {
-        if (strcmp(tag_name, self_closing[i]) == 0) {
-            return 1;
-        }
+// Closes the innermost open element and tells the consumer about it.
+static void pop_open_element(Parser* parser) {
+    int offset = parser->open_names[--parser->depth].offset;
+    int length = parser->names_length - offset - 1;
+    if (parser->events->on_end_element) {
+        parser->events->on_end_element(parser->user_data, parser->names + offset, length);
     }
-    return 0;
+    parser->names_length = offset;
 }
 
-static DomNode* parse_element(Parser* parser) {
-    DomNode* node = create_element_node(parser->current_token.lexeme);
-    advance(parser);
-    parse_attributes(parser, node);
-    if (parser->has_error) return node;
-    if (check(parser, TOKEN_SELF_CLOSE)) {
-        advance(parser); 
-        return node;
+// Static atoms are unique per name, so if either name is a known one the
+// ids decide; only two unknown names need a string compare.
+static int close_tag_matches(Parser* parser, Token* token, OpenName* open) {
+    const char* name = token_text(parser->lexer, token);
+    Atom atom = atom_lookup(name, token_length(token));
+    if (atom != ATOM_NONE || open->atom != ATOM_NONE) {
+        return atom == open->atom;
     }
+    return token_equals(parser->lexer, token, parser->names + open->offset);
+}
 
-    if (check(parser, TOKEN_GT)) {
-        advance(parser); 
-        if (is_self_closing_tag(node->tag_name)) {
-            return node;
+static void parse_content(Parser* parser) {
+    Token* token = &parser->current_token;
+    OpenName* open = parser->depth > 0 ? &parser->open_names[parser->depth - 1] : NULL;
+    const char* open_name = open ? parser->names + open->offset : NULL;
+
+    switch (token->type) {
+        case TOKEN_OPEN_TAG: {
+            const char* tag_name = token_text(parser->lexer, token);
+            int tag_length = token_length(token);
+            if (parser->options.max_depth && parser->depth >= parser->options.max_depth) {
+                limit_error(parser, "Nesting depth", (size_t)parser->options.max_depth);
+                return;
+            }
+            Atom atom = atom_lookup(tag_name, tag_length);
+            push_open_element(parser, tag_name, tag_length, atom);
+            parser->pending_is_void = atom_is_void(atom);
+            parser->attribute_count = 0;
+            parser->stats.elements++;
+            if (parser->events->on_start_element) {
+                parser->events->on_start_element(parser->user_data, tag_name, tag_length);
+            }
+            if (within_limits(parser)) {
+                parser->state = PARSER_ATTRIBUTES;
+            }
+            return;
         }
-        node->first_child = parse_children(parser);
-        if (parser->has_error) return node;
-        if (check(parser, TOKEN_CLOSE_TAG)) {
-            if (strcmp(parser->current_token.lexeme, node->tag_name) != 0) {
+        case TOKEN_TEXT:
+            parser->stats.text_nodes++;
+            if (parser->events->on_text) {
+                parser->events->on_text(parser->user_data, token_text(parser->lexer, token),
+                                        token_length(token));
+            }
+            within_limits(parser);
+            return;
+        case TOKEN_CLOSE_TAG:
+            if (parser->depth == 0) {
+                if (parser->speculative) {
+                    // Closes an element opened before this segment; the
+                    // caller checks the name when it joins the segments.
+                    if (parser->events->on_end_element) {
+                        parser->events->on_end_element(parser->user_data, token_text(parser->lexer, token),
+                                                       token_length(token));
+                    }
+                    parser->state = PARSER_CLOSE_GT;
+                    return;
+                }
+                // A close tag with nothing open ends the document.
+                parser->state = PARSER_DONE;
+                return;
+            }
+            if (!close_tag_matches(parser, token, open)) {
                 char msg[256];
-                snprintf(msg, sizeof(msg), "Mismatched tag. Expected </%s> but got </%s>",
-                        node->tag_name, parser->current_token.lexeme);
+                snprintf(msg, sizeof(msg), "Mismatched tag. Expected </%s> but got </%.*s>",
+                        open_name,
+                        token_length(token),
+                        token_text(parser->lexer, token));
                 parser_error(parser, msg);
-                return node; 
+                return; 
             }
+            pop_open_element(parser);
+            parser->state = PARSER_CLOSE_GT;
+            return;
+        case TOKEN_EOF:
+            if (parser->depth > 0) {
+                char msg[256];
+                snprintf(msg, sizeof(msg), "Missing closing tag for <%s>", open_name);
+                parser_error(parser, msg);
+                return;
+            }
+            parser->state = PARSER_DONE;
+            return;
+        default:
+            parser_error(parser, "Unexpected token while parsing children.");
+            return;
+    }
+}
+
+// Returns 0 if the attribute took the document over a limit.
+static int emit_attribute(Parser* parser, const char* value, int value_length) {
+    parser->stats.attributes++;
+    if (parser->events->on_attribute) {
+        parser->events->on_attribute(parser->user_data, parser->attr_name, parser->attr_name_length,
+                                     value, value_length);
+    }
+    return within_limits(parser);
+}
+
+// Handles one token of a start tag. Returns 1 if the same token has to
+// be looked at again in the state it left behind.
+static int parse_attributes(Parser* parser) {
+    Token* token = &parser->current_token;
+
+    switch (parser->state) {
+        case PARSER_ATTR_EQUALS:
+            if (token->type == TOKEN_ATTR_EQUALS) {
+                parser->state = PARSER_ATTR_VALUE;
+                return 0;
+            }
+            if (!emit_attribute(parser, "true", 4)) {
+                return 0;
+            }
+            parser->state = PARSER_ATTRIBUTES;
+            return 1;
 
-            advance(parser); // Consume close tag
-            if (!expect(parser, TOKEN_GT, "Expected '>' after closing tag name.")) {
-                return node;
+        case PARSER_ATTR_VALUE:
+            if (token->type != TOKEN_ATTR_VALUE) {
+                parser_error(parser, "Expected attribute value.");
+                return 0;
             }
-        } else {
-            char msg[256];
-            snprintf(msg, sizeof(msg), "Missing closing tag for <%s>", node->tag_name);
-            parser_error(parser, msg);
-            return node;
+            if (emit_attribute(parser, token_text(parser->lexer, token), token_length(token))) {
+                parser->state = PARSER_ATTRIBUTES;
+            }
+            return 0;
+
+        default:
+            break;
+    }
+
+    if (token->type == TOKEN_ATTR_NAME) {
+        if (parser->options.max_attributes && parser->attribute_count >= parser->options.max_attributes) {
+            limit_error(parser, "Attribute count", (size_t)parser->options.max_attributes);
+            return 0;
         }
-        return node;
+        parser->attribute_count++;
+        // The name may have to outlive the lexer buffer (streaming input),
+        // so keep a copy until its value has been seen.
+        int length = token_length(token);
+        if (length + 1 > parser->attr_name_capacity) {
+            int capacity = parser->attr_name_capacity ? parser->attr_name_capacity : 32;
+            while (capacity < length + 1) {
+                capacity *= 2;
+            }
+            free(parser->attr_name);
+            parser->attr_name = (char*)safe_malloc(capacity);
+            parser->attr_name_capacity = capacity;
+        }
+        memcpy(parser->attr_name, token_text(parser->lexer, token), length);
+        parser->attr_name[length] = '\0';
+        parser->attr_name_length = length;
+        parser->state = PARSER_ATTR_EQUALS;
+        return 0;
+    }
+    if (token->type == TOKEN_SELF_CLOSE || (token->type == TOKEN_GT && parser->pending_is_void)) {
+        pop_open_element(parser);
+        parser->state = PARSER_CONTENT;
+        return 0;
+    }
+    if (token->type == TOKEN_GT) {
+        parser->state = PARSER_CONTENT;
+        return 0;
     }
     parser_error(parser, "Expected '>' or '/>' after tag attributes.");
-    return node;
-}
\ No newline at end of file
+    return 0;
+}
@@ -3,17 +3,102 @@
 
 #include "lexer.h"
 #include "dom.h"
+#include "sax.h"
+#include "dom_builder.h"
+#include "parse_stats.h"
+
+typedef struct {
+    int offset;    // start of the name in Parser::names
+    Atom atom;     // ATOM_NONE for names outside the static table
+} OpenName;
+
+// Where the parser is in the grammar between two tokens.
+typedef enum {
+    PARSER_CONTENT,       // NodeList: text, child elements or a close tag
+    PARSER_ATTRIBUTES,    // inside a start tag, before an attribute or '>'
+    PARSER_ATTR_EQUALS,   // after an attribute name; '=' is optional
+    PARSER_ATTR_VALUE,    // after '='; a value must follow
+    PARSER_CLOSE_GT,      // after a close tag name, '>' must follow
+    PARSER_DONE
+} ParserState;
+
+// Optional behaviour, given to parser_init(). A zeroed struct (or NULL)
+// is the default: no index, whitespace kept and no limits.
+typedef struct {
+    int build_index;           // build id/class/tag indexes (dom_index.h)
+    WhitespaceMode whitespace; // trim/collapse text outside <pre> and
+                               // <textarea> (dom.h); DOM builder only
+    int pipeline;              // lex on a second thread, ahead of the
+                               // parser (token_pipeline.h); whole inputs
+                               // of TOKEN_PIPELINE_MIN_INPUT bytes or more
+
+    // Limits for untrusted input, 0 for none. Going over one ends the
+    // parse with an error naming the limit, like a syntax error, so the
+    // memory a single document can take stays bounded.
+    int max_depth;             // elements open at the same time
+    size_t max_nodes;          // elements plus text nodes
+    int max_attributes;        // attributes on one element
+    size_t max_dom_bytes;      // arena bytes of the tree; DOM builder only
+    size_t max_input_bytes;    // input bytes lexed; parser_feed() refuses
+                               // a chunk that would go past it
+} ParserOptions;
+
 typedef struct {
     Lexer* lexer;
     Token current_token; 
     Token previous_token;
     char* error_message;
     int has_error;
+
+    const ParserEvents* events;
+    void* user_data;
+    DomBuilder builder;        // default consumer, used by parse()
+    ParserOptions options;
+    ParseStats stats;          // counts and timings of this parse
+    // Set by parse_parallel() on the parsers of later segments, which
+    // start inside elements opened before them: a close tag with nothing
+    // open goes to on_end_element instead of ending the document.
+    int speculative;
+
+    ParserState state;
+    // Names of the open elements, NUL-separated, innermost last. They are
+    // copies because a streaming lexer may drop the source bytes.
+    char* names;
+    int names_length;
+    int names_capacity;
+    OpenName* open_names;
+    int depth;
+    int depth_capacity;
+    int pending_is_void;       // element whose start tag is being read
+    char* attr_name;           // copy of the pending attribute name
+    int attr_name_length;
+    int attr_name_capacity;
+    int attribute_count;       // attributes of the element being read
 } Parser;
 
-Parser* parser_init(Lexer* lexer);
+// `options` is copied; NULL means the defaults.
+Parser* parser_init(Lexer* lexer, const ParserOptions* options);
 void parser_free(Parser* parser);
 
+// Send parse events to `events` instead of building a DOM. Must be called
+// before any input is parsed; parse() and parser_finish() then return
+// NULL, and has_error tells whether the input was well formed.
+void parser_set_events(Parser* parser, const ParserEvents* events, void* user_data);
+
 DomNode* parse(Parser* parser);
 
+// Push interface for a lexer created with lexer_init_stream(): hand over
+// input as it arrives, then call parser_finish() for the document (NULL
+// on error, as with parse()). parser_feed() returns 0 once an error has
+// been reported; feeding more after that is a no-op.
+int parser_feed(Parser* parser, const char* chunk, size_t length);
+
+DomNode* parser_finish(Parser* parser);
+
+// Segment parsing for parse_parallel(): processes the tokens that start
+// before byte `end` of the lexer's (non-streaming) source. Returns 1 once
+// it reaches the first token at or past `end`, which is stored unprocessed
+// in *boundary, or 0 if the document ended or failed first.
+int parser_parse_until(Parser* parser, int end, Token* boundary);
+
 #endif 
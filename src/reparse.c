@@ -0,0 +1,234 @@
+#include "reparse.h"
+#include "dom_builder.h"
+#include "dom_index.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Innermost element whose range strictly contains [start, end), so that
+// its '<' and its final '>' survive the edit; NULL if none does.
+static DomNode* enclosing_element(DomNode* root, size_t start, size_t end) {
+    DomNode* found = NULL;
+    DomNode* node = root->first_child;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE && node->source_start < start && end < node->source_end) {
+            found = node;
+            node = node->first_child;
+        } else if (node->source_start >= end) {
+            break;                  // children are in source order
+        } else {
+            node = node->next_sibling;
+        }
+    }
+    return found;
+}
+
+// Moves every range at or past `old_end` by the size change of the edit.
+// Subtrees that end before it are left alone.
+static void shift_ranges(DomNode* root, size_t old_end, size_t removed, size_t inserted) {
+    DomNode* node = root->first_child;
+    while (node != NULL) {
+        int after = node->source_end >= old_end;
+        if (after) {
+            node->source_end = node->source_end - removed + inserted;
+            if (node->source_start >= old_end) {
+                node->source_start = node->source_start - removed + inserted;
+            }
+            if (node->first_child != NULL) {
+                node = node->first_child;
+                continue;
+            }
+        }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
+    }
+}
+
+// Parses the new text of `element` into `holder`, in the element's own
+// document. Returns 1 if the parse, continued into the rest of the input,
+// would have been the same: no error, every byte used, nothing closed
+// that was opened outside, and an element both first (at the old '<')
+// and last (ending at the old final '>'), so no token can run across
+// either end.
+static int parse_fragment(DomDocument* document, DomNode* element, DomNode* holder,
+                          const char* source, size_t end, const ParserOptions* options) {
+    size_t start = element->source_start;
+    int length = (int)(end - start);
+    ParserOptions fragment_options = { 0 };
+    if (options != NULL) {
+        fragment_options = *options;
+    }
+    fragment_options.build_index = 0;
+
+    Lexer* lexer = lexer_init_n(source + start, (size_t)length);
+    Parser* parser = parser_init(lexer, &fragment_options);
+    dom_builder_resume(&parser->builder, document, holder);
+    parser->builder.source_base = start;
+    Token boundary;
+    parser_parse_until(parser, length + 1, &boundary);
+
+    const Token* last = &parser->previous_token;
+    int ok = !parser->has_error && parser->state == PARSER_DONE && lexer->current == length &&
+             (last->type == TOKEN_GT || last->type == TOKEN_SELF_CLOSE) &&
+             last->span.offset + last->span.length == length &&
+             holder->first_child != NULL && holder->first_child->type == ELEMENT_NODE &&
+             holder->first_child->source_start == start;
+    dom_builder_take_root(&parser->builder);
+    parser_free(parser);
+    lexer_free(lexer);
+    return ok;
+}
+
+// Puts the children of `holder` where `element` was.
+static void splice(DomNode* element, DomNode* holder) {
+    DomNode* parent = element->parent;
+    DomNode* previous = NULL;
+    for (DomNode* child = parent->first_child; child != element; child = child->next_sibling) {
+        previous = child;
+    }
+    DomNode* last = NULL;
+    int count = 0;
+    for (DomNode* child = holder->first_child; child != NULL; child = child->next_sibling) {
+        child->parent = parent;
+        last = child;
+        count++;
+    }
+    if (previous != NULL) {
+        previous->next_sibling = holder->first_child;
+    } else {
+        parent->first_child = holder->first_child;
+    }
+    last->next_sibling = element->next_sibling;
+    if (parent->last_child == element) {
+        parent->last_child = last;
+    }
+    parent->child_count += count - 1;
+    element->parent = NULL;
+    element->next_sibling = NULL;
+}
+
+// Arena bytes `subtree` takes up, roughly: nodes, attributes and strings
+// (tag and attribute names are interned and stay in use).
+static size_t subtree_bytes(const DomNode* subtree) {
+    size_t bytes = 0;
+    const DomNode* node = subtree;
+    while (node != NULL) {
+        bytes += sizeof(DomNode);
+        if (node->text_content != NULL) {
+            bytes += strlen(node->text_content) + 1;
+        }
+        if (node->decoded_text != NULL && node->decoded_text != node->text_content) {
+            bytes += strlen(node->decoded_text) + 1;
+        }
+        for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+            bytes += sizeof(Attribute) + strlen(attr->value) + 1;
+            if (attr->decoded != NULL && attr->decoded != attr->value) {
+                bytes += strlen(attr->decoded) + 1;
+            }
+        }
+        if (node->first_child != NULL) {
+            node = node->first_child;
+            continue;
+        }
+        while (node != subtree && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == subtree ? NULL : node->next_sibling;
+    }
+    return bytes;
+}
+
+static int no_limits(const ParserOptions* options) {
+    return options == NULL ||
+           (options->max_depth == 0 && options->max_nodes == 0 && options->max_attributes == 0 &&
+            options->max_dom_bytes == 0 && options->max_input_bytes == 0);
+}
+
+// The subtree path of reparse_edit(). Returns 0, with `root` unchanged
+// apart from its arena, where a full parse is needed.
+static int reparse_subtree(DomNode* root, const char* source, size_t offset,
+                           size_t removed, size_t inserted, const ParserOptions* options) {
+    if (!(root->flags & DOM_FLAG_DOCUMENT) || !no_limits(options)) {
+        return 0;
+    }
+    DomNode* element = enclosing_element(root, offset, offset + removed);
+    if (element == NULL) {
+        return 0;
+    }
+    DomDocument* document = (DomDocument*)root;
+    // Replaced nodes stay in the arena. Once they are most of it, parse
+    // everything again: the new document starts with a fresh arena.
+    if (document->dead_bytes > dom_document_bytes(root) / 2) {
+        return 0;
+    }
+    size_t old_end = element->source_end;
+    size_t new_end = old_end - removed + inserted;
+
+    // The index is updated afterwards; keep the builder from adding to it.
+    DomIndex* index = document->index;
+    document->index = NULL;
+    DomNode holder;
+    memset(&holder, 0, sizeof(holder));
+    holder.type = ELEMENT_NODE;
+    holder.parent = element->parent;    // for <pre>/<textarea> ancestors
+    int ok = parse_fragment(document, element, &holder, source, new_end, options);
+    document->index = index;
+    if (!ok) {
+        return 0;
+    }
+
+    // The index goes by source ranges: drop the old elements while their
+    // ranges are unchanged, file the new ones once all ranges are current.
+    if (document->index != NULL) {
+        dom_index_remove_subtree(document->index, element);
+    }
+    document->dead_bytes += subtree_bytes(element);
+    shift_ranges(root, old_end, removed, inserted);
+    DomNode* first = holder.first_child;
+    DomNode* after = element->next_sibling;
+    splice(element, &holder);
+    if (document->index != NULL) {
+        for (DomNode* node = first; node != after; node = node->next_sibling) {
+            dom_index_add_subtree(document->index, node);
+        }
+    } else if (options != NULL && options->build_index) {
+        dom_build_index(root);
+    }
+    return 1;
+}
+
+ReparseResult reparse_edit(DomNode* root, const char* source, size_t length,
+                           const SourceEdit* edit, const ParserOptions* options) {
+    size_t offset = edit->offset < length ? edit->offset : length;
+    size_t removed = edit->removed < length - offset ? edit->removed : length - offset;
+
+    ReparseResult result;
+    result.length = length - removed + edit->inserted_length;
+    result.source = (char*)safe_malloc(result.length + 1);
+    memcpy(result.source, source, offset);
+    memcpy(result.source + offset, edit->inserted, edit->inserted_length);
+    memcpy(result.source + offset + edit->inserted_length, source + offset + removed,
+           length - offset - removed);
+    result.source[result.length] = '\0';
+    result.error_message = NULL;
+
+    if (root != NULL && reparse_subtree(root, result.source, offset, removed, edit->inserted_length, options)) {
+        result.root = root;
+        result.mode = REPARSE_SUBTREE;
+        return result;
+    }
+
+    free_dom_tree(root);
+    Lexer* lexer = lexer_init_n(result.source, result.length);
+    Parser* parser = parser_init(lexer, options);
+    result.root = parse(parser);
+    result.mode = REPARSE_FULL;
+    if (parser->has_error) {
+        result.error_message = safe_strdup(parser->error_message);
+    }
+    parser_free(parser);
+    lexer_free(lexer);
+    return result;
+}
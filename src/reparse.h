@@ -0,0 +1,48 @@
+#ifndef REPARSE_H
+#define REPARSE_H
+
+#include <stddef.h>
+#include "dom.h"
+#include "parser.h"
+
+// Incremental reparsing for inputs that change a little at a time, as in
+// an editor. Only the innermost element whose source range (DomNode
+// source_start/source_end) encloses the edit is parsed again, and its new
+// nodes take its place in the existing tree. When that cannot give the
+// tree a full parse would (the edit reaches outside every element, or the
+// element's new text does not stand on its own as balanced markup that
+// starts and ends with a tag), the whole input is parsed again instead.
+
+// `removed` bytes at `offset` replaced by inserted[0..inserted_length).
+typedef struct {
+    size_t offset;
+    size_t removed;
+    const char* inserted;
+    size_t inserted_length;
+} SourceEdit;
+
+typedef enum {
+    REPARSE_SUBTREE,    // one element was parsed again and spliced in
+    REPARSE_FULL        // the whole input was parsed again
+} ReparseMode;
+
+typedef struct {
+    DomNode* root;          // the updated tree; NULL if the input has an error
+    char* source;           // the edited input, NUL-terminated; the caller frees it
+    size_t length;
+    ReparseMode mode;
+    char* error_message;    // the parse error when root is NULL; the caller frees it
+} ReparseResult;
+
+// Applies `edit` to source[0..length) and returns the tree for the result.
+// `root` must be the tree parse() (or parse_parallel()) built from exactly
+// that input, with the same `options` (NULL for the defaults). It is used
+// up: either edited in place and returned, or freed. An index is updated
+// for the replaced elements only. Those elements stay in the document's
+// arena, counted in DomDocument.dead_bytes; once they make up more than
+// half of it, the edit is done as a full parse, which starts a fresh
+// arena. Parses with a limit set in `options` are always full.
+ReparseResult reparse_edit(DomNode* root, const char* source, size_t length,
+                           const SourceEdit* edit, const ParserOptions* options);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef SAX_H
+#define SAX_H
+
+#include <stddef.h>
+
+// Callbacks fired by the parser as it recognises the grammar in
+// doc/grammer.txt. Names, values and text point into parser or lexer
+// memory: they are not NUL-terminated and are only valid during the call.
+// Any callback may be NULL.
+//
+// For every element: on_start_element, then one on_attribute per
+// attribute, then its content, then on_end_element (immediately after the
+// start tag for void elements and "/>"). on_error fires at most once,
+// with the same message the parser stores in error_message.
+typedef struct {
+    void (*on_start_element)(void* user_data, const char* name, size_t length);
+    void (*on_attribute)(void* user_data, const char* name, size_t name_length,
+                         const char* value, size_t value_length);
+    void (*on_text)(void* user_data, const char* text, size_t length);
+    void (*on_end_element)(void* user_data, const char* name, size_t length);
+    void (*on_error)(void* user_data, const char* message);
+} ParserEvents;
+
+#endif
@@ -0,0 +1,200 @@
+#include "scan.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define SCAN_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+static size_t find_byte_scalar(const char* p, size_t n, char c) {
+    const char* hit = (const char*)memchr(p, c, n);
+    return hit ? (size_t)(hit - p) : n;
+}
+
+static int is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static size_t skip_whitespace_scalar(const char* p, size_t n) {
+    size_t i = 0;
+    while (i < n && is_space(p[i])) {
+        i++;
+    }
+    return i;
+}
+
+static size_t count_byte_scalar(const char* p, size_t n, char c) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        count += p[i] == c;
+    }
+    return count;
+}
+
+#ifdef SCAN_HAVE_X86
+
+static size_t find_byte_sse2(const char* p, size_t n, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(p + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + find_byte_scalar(p + i, n - i, c);
+}
+
+static size_t skip_whitespace_sse2(const char* p, size_t n) {
+    const __m128i sp = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, sp), _mm_cmpeq_epi8(chunk, tab)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf)));
+        int mask = ~_mm_movemask_epi8(ws) & 0xFFFF;
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + skip_whitespace_scalar(p + i, n - i);
+}
+
+static size_t count_byte_sse2(const char* p, size_t n, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(p + i));
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+    }
+    return count + count_byte_scalar(p + i, n - i, c);
+}
+
+__attribute__((target("avx2")))
+static size_t find_byte_avx2(const char* p, size_t n, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(p + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + find_byte_sse2(p + i, n - i, c);
+}
+
+__attribute__((target("avx2")))
+static size_t skip_whitespace_avx2(const char* p, size_t n) {
+    const __m256i sp = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(p + i));
+        __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, sp), _mm256_cmpeq_epi8(chunk, tab)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr), _mm256_cmpeq_epi8(chunk, lf)));
+        unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(ws);
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return i + skip_whitespace_sse2(p + i, n - i);
+}
+
+__attribute__((target("avx2,popcnt")))
+static size_t count_byte_avx2(const char* p, size_t n, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(p + i));
+        count += __builtin_popcount((unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+    }
+    return count + count_byte_sse2(p + i, n - i, c);
+}
+
+#endif // SCAN_HAVE_X86
+
+static ScanLevel current_level = SCAN_SCALAR;
+static size_t (*find_byte_impl)(const char*, size_t, char) = find_byte_scalar;
+static size_t (*skip_whitespace_impl)(const char*, size_t) = skip_whitespace_scalar;
+static size_t (*count_byte_impl)(const char*, size_t, char) = count_byte_scalar;
+
+static ScanLevel detect_level(void) {
+#ifdef SCAN_HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SCAN_AVX2;
+    }
+    return SCAN_SSE2;
+#else
+    return SCAN_SCALAR;
+#endif
+}
+
+static void install(ScanLevel level) {
+    current_level = level;
+    switch (level) {
+#ifdef SCAN_HAVE_X86
+        case SCAN_AVX2:
+            find_byte_impl = find_byte_avx2;
+            skip_whitespace_impl = skip_whitespace_avx2;
+            count_byte_impl = count_byte_avx2;
+            break;
+        case SCAN_SSE2:
+            find_byte_impl = find_byte_sse2;
+            skip_whitespace_impl = skip_whitespace_sse2;
+            count_byte_impl = count_byte_sse2;
+            break;
+#endif
+        default:
+            current_level = SCAN_SCALAR;
+            find_byte_impl = find_byte_scalar;
+            skip_whitespace_impl = skip_whitespace_scalar;
+            count_byte_impl = count_byte_scalar;
+            break;
+    }
+}
+
+// Runs before main(), so the dispatch pointers are never written while
+// lexers on other threads are reading them.
+__attribute__((constructor))
+static void scan_init(void) {
+    install(detect_level());
+}
+
+size_t scan_find_byte(const char* p, size_t n, char c) {
+    return find_byte_impl(p, n, c);
+}
+
+size_t scan_skip_whitespace(const char* p, size_t n) {
+    return skip_whitespace_impl(p, n);
+}
+
+size_t scan_count_byte(const char* p, size_t n, char c) {
+    return count_byte_impl(p, n, c);
+}
+
+ScanLevel scan_level(void) {
+    return current_level;
+}
+
+const char* scan_level_name(ScanLevel level) {
+    switch (level) {
+        case SCAN_AVX2: return "avx2";
+        case SCAN_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+void scan_set_level(ScanLevel level) {
+    ScanLevel supported = detect_level();
+    install(level < supported ? level : supported);
+}
@@ -0,0 +1,36 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+
+// Byte-scanning kernels used by the lexer's hot loops. The widest
+// implementation the CPU supports (AVX2, SSE2 or plain C) is picked once
+// at startup; all variants return identical results.
+
+typedef enum {
+    SCAN_SCALAR,
+    SCAN_SSE2,
+    SCAN_AVX2
+} ScanLevel;
+
+// Index of the first byte equal to c in p[0..n), or n if there is none.
+size_t scan_find_byte(const char* p, size_t n, char c);
+
+// Index of the first byte in p[0..n) that is not ' ', '\t', '\r' or '\n',
+// or n if the whole range is whitespace.
+size_t scan_skip_whitespace(const char* p, size_t n);
+
+// Number of bytes equal to c in p[0..n).
+size_t scan_count_byte(const char* p, size_t n, char c);
+
+ScanLevel scan_level(void);
+
+const char* scan_level_name(ScanLevel level);
+
+// Caps the kernels at `level` (never above what the CPU supports).
+// Meant for tests and benchmarks; call before any lexing starts. This is
+// the only writer of the dispatch state, so it must not race with lexers
+// running on other threads.
+void scan_set_level(ScanLevel level);
+
+#endif
@@ -0,0 +1,379 @@
+#include "selector.h"
+#include "dom_index.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char* name;
+    char* value;            // NULL for a presence test
+} AttributeTest;
+
+typedef enum {
+    COMBINATOR_NONE,        // leftmost compound
+    COMBINATOR_DESCENDANT,
+    COMBINATOR_CHILD
+} Combinator;
+
+// One compound selector, e.g. div.note[lang=en].
+typedef struct {
+    Combinator combinator;  // relation to the compound on its left
+    char* tag;              // NULL for any element
+    Atom tag_atom;          // static atom of `tag`, or ATOM_NONE
+    char* id;
+    char** classes;
+    int class_count;
+    AttributeTest* attributes;
+    int attribute_count;
+} Compound;
+
+struct Selector {
+    Compound* compounds;    // left to right
+    int count;
+};
+
+// --- Compiling ---
+
+static int is_name_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '-' || c == '_' || (unsigned char)c >= 0x80;
+}
+
+static int is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static const char* skip_spaces(const char* p) {
+    while (is_space(*p)) p++;
+    return p;
+}
+
+// Reads a name at *p; returns a copy, or NULL if there is none.
+static char* read_name(const char** p) {
+    const char* start = *p;
+    while (is_name_char(**p)) (*p)++;
+    return *p > start ? safe_strndup(start, *p - start) : NULL;
+}
+
+static void* grow_array(void* array, int count, size_t item_size) {
+    // Arrays grow one item at a time; selectors are short.
+    void* grown = realloc(array, (count + 1) * item_size);
+    if (grown == NULL) {
+        fprintf(stderr, "Fatal: Memory allocation failed.\n");
+        exit(EXIT_FAILURE);
+    }
+    return grown;
+}
+
+static void free_compound(Compound* c) {
+    free(c->tag);
+    free(c->id);
+    for (int i = 0; i < c->class_count; i++) free(c->classes[i]);
+    free(c->classes);
+    for (int i = 0; i < c->attribute_count; i++) {
+        free(c->attributes[i].name);
+        free(c->attributes[i].value);
+    }
+    free(c->attributes);
+}
+
+// [name] or [name=value]; *p is just past the '['.
+static int parse_attribute_test(const char** p, Compound* c) {
+    *p = skip_spaces(*p);
+    char* name = read_name(p);
+    if (name == NULL) return 0;
+    *p = skip_spaces(*p);
+
+    char* value = NULL;
+    if (**p == '=') {
+        *p = skip_spaces(*p + 1);
+        char quote = **p;
+        if (quote == '"' || quote == '\'') {
+            const char* end = strchr(*p + 1, quote);
+            if (end == NULL) {
+                free(name);
+                return 0;
+            }
+            value = safe_strndup(*p + 1, end - (*p + 1));
+            *p = end + 1;
+        } else {
+            value = read_name(p);
+            if (value == NULL) {
+                free(name);
+                return 0;
+            }
+        }
+        *p = skip_spaces(*p);
+    }
+    if (**p != ']') {
+        free(name);
+        free(value);
+        return 0;
+    }
+    (*p)++;
+    c->attributes = (AttributeTest*)grow_array(c->attributes, c->attribute_count, sizeof(AttributeTest));
+    c->attributes[c->attribute_count].name = name;
+    c->attributes[c->attribute_count].value = value;
+    c->attribute_count++;
+    return 1;
+}
+
+static int parse_compound(const char** p, Compound* c) {
+    int parts = 0;
+    if (**p == '*') {
+        (*p)++;
+        parts++;
+    } else if (is_name_char(**p)) {
+        c->tag = read_name(p);
+        c->tag_atom = atom_lookup(c->tag, strlen(c->tag));
+        parts++;
+    }
+    for (;;) {
+        char* name;
+        switch (**p) {
+            case '#':
+                (*p)++;
+                if ((name = read_name(p)) == NULL) return 0;
+                free(c->id);    // #a#b can never match; keep the last
+                c->id = name;
+                break;
+            case '.':
+                (*p)++;
+                if ((name = read_name(p)) == NULL) return 0;
+                c->classes = (char**)grow_array(c->classes, c->class_count, sizeof(char*));
+                c->classes[c->class_count++] = name;
+                break;
+            case '[':
+                (*p)++;
+                if (!parse_attribute_test(p, c)) return 0;
+                break;
+            default:
+                return parts > 0;
+        }
+        parts++;
+    }
+}
+
+Selector* selector_compile(const char* text) {
+    Selector* selector = (Selector*)safe_malloc(sizeof(Selector));
+    selector->compounds = NULL;
+    selector->count = 0;
+
+    const char* p = skip_spaces(text);
+    Combinator combinator = COMBINATOR_NONE;
+    for (;;) {
+        selector->compounds = (Compound*)grow_array(selector->compounds, selector->count, sizeof(Compound));
+        Compound* c = &selector->compounds[selector->count++];
+        memset(c, 0, sizeof(*c));
+        c->combinator = combinator;
+        if (!parse_compound(&p, c)) {
+            selector_free(selector);
+            return NULL;
+        }
+
+        const char* after = p;
+        p = skip_spaces(p);
+        if (*p == '\0') {
+            return selector;
+        }
+        if (*p == '>') {
+            combinator = COMBINATOR_CHILD;
+            p = skip_spaces(p + 1);
+        } else if (p > after) {
+            combinator = COMBINATOR_DESCENDANT;
+        } else {
+            selector_free(selector);
+            return NULL;
+        }
+    }
+}
+
+void selector_free(Selector* selector) {
+    if (selector == NULL) {
+        return;
+    }
+    for (int i = 0; i < selector->count; i++) {
+        free_compound(&selector->compounds[i]);
+    }
+    free(selector->compounds);
+    free(selector);
+}
+
+// --- Matching ---
+
+static int has_class(const char* list, const char* name) {
+    size_t length = strlen(name);
+    const char* p = list;
+    while (*p != '\0') {
+        while (is_space(*p)) p++;
+        const char* start = p;
+        while (*p != '\0' && !is_space(*p)) p++;
+        if ((size_t)(p - start) == length && memcmp(start, name, length) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int compound_matches(const Compound* c, const DomNode* element) {
+    if (element->type != ELEMENT_NODE || (element->flags & DOM_FLAG_DOCUMENT)) {
+        return 0;
+    }
+    if (c->tag != NULL) {
+        if (c->tag_atom != ATOM_NONE && element->tag_atom != ATOM_NONE && element->tag_atom < ATOM_STATIC_COUNT) {
+            if (c->tag_atom != element->tag_atom) return 0;
+        } else if (strcmp(c->tag, element->tag_name) != 0) {
+            return 0;
+        }
+    }
+    if (c->id != NULL) {
+        const char* id = dom_get_attribute(element, "id");
+        if (id == NULL || strcmp(id, c->id) != 0) return 0;
+    }
+    if (c->class_count > 0) {
+        const char* list = dom_get_attribute(element, "class");
+        if (list == NULL) return 0;
+        for (int i = 0; i < c->class_count; i++) {
+            if (!has_class(list, c->classes[i])) return 0;
+        }
+    }
+    for (int i = 0; i < c->attribute_count; i++) {
+        const char* value = dom_get_attribute(element, c->attributes[i].name);
+        if (value == NULL) return 0;
+        if (c->attributes[i].value != NULL && strcmp(value, c->attributes[i].value) != 0) return 0;
+    }
+    return 1;
+}
+
+// Matches compounds [0..last] with compound `last` on `element`, right to
+// left. Recursion depth is bounded by the selector, not by the tree.
+static int match_from(const Selector* selector, int last, const DomNode* element) {
+    const Compound* c = &selector->compounds[last];
+    if (!compound_matches(c, element)) {
+        return 0;
+    }
+    if (last == 0) {
+        return 1;
+    }
+    if (c->combinator == COMBINATOR_CHILD) {
+        return element->parent != NULL && match_from(selector, last - 1, element->parent);
+    }
+    for (const DomNode* ancestor = element->parent; ancestor != NULL; ancestor = ancestor->parent) {
+        if (match_from(selector, last - 1, ancestor)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int selector_matches(const Selector* selector, const DomNode* element) {
+    return element != NULL && match_from(selector, selector->count - 1, element);
+}
+
+// --- Querying ---
+
+static void list_push(DomNodeList* list, DomNode* node) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 16;
+        DomNode** grown = (DomNode**)realloc(list->nodes, list->capacity * sizeof(DomNode*));
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        list->nodes = grown;
+    }
+    list->nodes[list->count++] = node;
+}
+
+// Candidate elements for the rightmost compound from the index: the id
+// list if there is an id, else the shortest class list, else the tag
+// list. Returns 0 if the index cannot narrow the search.
+static int index_candidates(const DomIndex* index, const Compound* c, DomNode* const** nodes, int* count) {
+    if (c->id != NULL) {
+        *nodes = dom_index_lookup(index, DOM_INDEX_ID, c->id, strlen(c->id), count);
+        return 1;
+    }
+    if (c->class_count > 0) {
+        for (int i = 0; i < c->class_count; i++) {
+            int n;
+            DomNode* const* list = dom_index_lookup(index, DOM_INDEX_CLASS, c->classes[i], strlen(c->classes[i]), &n);
+            if (i == 0 || n < *count) {
+                *nodes = list;
+                *count = n;
+            }
+        }
+        return 1;
+    }
+    if (c->tag != NULL) {
+        *nodes = dom_index_lookup(index, DOM_INDEX_TAG, c->tag, strlen(c->tag), count);
+        return 1;
+    }
+    return 0;
+}
+
+static int is_below(const DomNode* node, const DomNode* root) {
+    for (node = node->parent; node != NULL; node = node->parent) {
+        if (node == root) return 1;
+    }
+    return 0;
+}
+
+// Shared by both queries; stops after the first match if `first_only`.
+static void run_query(DomNode* root, const Selector* selector, DomNodeList* out, int first_only) {
+    if (root == NULL || selector == NULL) {
+        return;
+    }
+
+    const DomIndex* index = dom_find_index(root);
+    DomNode* const* candidates;
+    int count;
+    if (index != NULL && index_candidates(index, &selector->compounds[selector->count - 1], &candidates, &count)) {
+        int whole_document = root->parent == NULL;
+        for (int i = 0; i < count; i++) {
+            DomNode* node = candidates[i];
+            if ((whole_document || is_below(node, root)) && selector_matches(selector, node)) {
+                list_push(out, node);
+                if (first_only) return;
+            }
+        }
+        return;
+    }
+
+    DomNode* node = root->first_child;
+    while (node != NULL) {
+        if (node->type == ELEMENT_NODE && selector_matches(selector, node)) {
+            list_push(out, node);
+            if (first_only) return;
+        }
+        if (node->first_child != NULL) {
+            node = node->first_child;
+            continue;
+        }
+        while (node != root && node->next_sibling == NULL) {
+            node = node->parent;
+        }
+        node = node == root ? NULL : node->next_sibling;
+    }
+}
+
+DomNode* dom_query_selector(DomNode* root, const Selector* selector) {
+    DomNodeList list = { NULL, 0, 0 };
+    run_query(root, selector, &list, 1);
+    DomNode* first = list.count > 0 ? list.nodes[0] : NULL;
+    dom_node_list_free(&list);
+    return first;
+}
+
+DomNodeList dom_query_selector_all(DomNode* root, const Selector* selector) {
+    DomNodeList list = { NULL, 0, 0 };
+    run_query(root, selector, &list, 0);
+    return list;
+}
+
+void dom_node_list_free(DomNodeList* list) {
+    free(list->nodes);
+    list->nodes = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
@@ -0,0 +1,39 @@
+#ifndef SELECTOR_H
+#define SELECTOR_H
+
+#include "dom.h"
+
+// Compiled CSS selectors. Supported syntax:
+//   tag  *  #id  .class  [attr]  [attr=value]  [attr="value"]
+// combined into compound selectors (div.note[lang=en]) and chained with
+// the descendant (space) and child (>) combinators. Selector lists
+// (a, b) and pseudo-classes are not supported.
+//
+// Queries use the document's DomIndex when it has one (see dom_index.h)
+// and fall back to walking the tree otherwise; results are the same.
+
+typedef struct Selector Selector;
+
+typedef struct {
+    DomNode** nodes;
+    int count;
+    int capacity;
+} DomNodeList;
+
+// Returns NULL if `text` is not a valid selector.
+Selector* selector_compile(const char* text);
+
+void selector_free(Selector* selector);
+
+int selector_matches(const Selector* selector, const DomNode* element);
+
+// First element below `root` (excluding root) that matches, in document
+// order, or NULL.
+DomNode* dom_query_selector(DomNode* root, const Selector* selector);
+
+// Every element below `root` that matches, in document order.
+DomNodeList dom_query_selector_all(DomNode* root, const Selector* selector);
+
+void dom_node_list_free(DomNodeList* list);
+
+#endif
@@ -0,0 +1,327 @@
+#include "serialize.h"
+#include "utils.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Buffered output is handed to write() once this much has piled up.
+#define OUT_FLUSH_THRESHOLD (64 * 1024)
+
+void out_init(OutBuffer* out, int fd) {
+    out->fd = fd;
+    out->data = NULL;
+    out->length = 0;
+    out->capacity = 0;
+    out->failed = 0;
+}
+
+static void out_write_all(OutBuffer* out) {
+    size_t written = 0;
+    while (!out->failed && written < out->length) {
+        ssize_t n = write(out->fd, out->data + written, out->length - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            out->failed = 1;
+        } else {
+            written += (size_t)n;
+        }
+    }
+    out->length = 0;
+}
+
+void out_append(OutBuffer* out, const char* data, size_t length) {
+    if (out->length + length + 1 > out->capacity) {
+        size_t capacity = out->capacity ? out->capacity : 4096;
+        while (out->length + length + 1 > capacity) {
+            capacity *= 2;
+        }
+        char* grown = (char*)realloc(out->data, capacity);
+        if (grown == NULL) {
+            fprintf(stderr, "Fatal: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        out->data = grown;
+        out->capacity = capacity;
+    }
+    memcpy(out->data + out->length, data, length);
+    out->length += length;
+    out->data[out->length] = '\0';
+
+    if (out->fd >= 0 && out->length >= OUT_FLUSH_THRESHOLD) {
+        out_write_all(out);
+    }
+}
+
+void out_puts(OutBuffer* out, const char* s) {
+    out_append(out, s, strlen(s));
+}
+
+int out_flush(OutBuffer* out) {
+    if (out->fd >= 0 && out->length > 0) {
+        out_write_all(out);
+    }
+    return out->failed ? -1 : 0;
+}
+
+void out_free(OutBuffer* out) {
+    free(out->data);
+    out_init(out, -1);
+}
+
+static void out_indent(OutBuffer* out, int levels) {
+    static const char spaces[] = "                                ";
+    size_t n = (size_t)levels * 2;
+    while (n > 0) {
+        size_t chunk = n < sizeof(spaces) - 1 ? n : sizeof(spaces) - 1;
+        out_append(out, spaces, chunk);
+        n -= chunk;
+    }
+}
+
+static void out_json_string(OutBuffer* out, const char* s) {
+    out_append(out, "\"", 1);
+    const char* run = s;
+    for (const char* p = s; *p != '\0'; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out_append(out, run, p - run);
+        run = p + 1;
+        switch (c) {
+            case '"': out_append(out, "\\\"", 2); break;
+            case '\\': out_append(out, "\\\\", 2); break;
+            case '\n': out_append(out, "\\n", 2); break;
+            case '\r': out_append(out, "\\r", 2); break;
+            case '\t': out_append(out, "\\t", 2); break;
+            default: {
+                char escape[8];
+                snprintf(escape, sizeof(escape), "\\u%04x", c);
+                out_append(out, escape, 6);
+            }
+        }
+    }
+    out_puts(out, run);
+    out_append(out, "\"", 1);
+}
+
+// Values come from quoted source text, so at most one quote kind is in
+// them; pick the other one and fall back to &quot; for built trees.
+static void out_html_attribute(OutBuffer* out, const Attribute* attr) {
+    out_append(out, " ", 1);
+    out_puts(out, attr->name);
+    if (strchr(attr->value, '"') == NULL) {
+        out_append(out, "=\"", 2);
+        out_puts(out, attr->value);
+        out_append(out, "\"", 1);
+    } else if (strchr(attr->value, '\'') == NULL) {
+        out_append(out, "='", 2);
+        out_puts(out, attr->value);
+        out_append(out, "'", 1);
+    } else {
+        out_append(out, "=\"", 2);
+        const char* run = attr->value;
+        for (const char* p = attr->value; *p != '\0'; p++) {
+            if (*p == '"') {
+                out_append(out, run, p - run);
+                out_append(out, "&quot;", 6);
+                run = p + 1;
+            }
+        }
+        out_puts(out, run);
+        out_append(out, "\"", 1);
+    }
+}
+
+static int is_void(const DomNode* node) {
+    return node->tag_atom != ATOM_NONE ? atom_is_void(node->tag_atom)
+                                       : atom_is_void(atom_lookup(node->tag_name, strlen(node->tag_name)));
+}
+
+typedef struct {
+    OutBuffer* out;
+    SerializeFormat format;
+    int indent;
+    const DomNode* skip;    // document root left out of the HTML formats
+} Serializer;
+
+static void enter_node(Serializer* s, const DomNode* node, int depth, int first) {
+    OutBuffer* out = s->out;
+    int level = s->indent + depth;
+
+    switch (s->format) {
+        case SERIALIZE_HTML:
+        case SERIALIZE_PRETTY:
+            if (node == s->skip) {
+                return;
+            }
+            if (s->format == SERIALIZE_PRETTY) {
+                out_indent(out, level - (s->skip != NULL));
+            }
+            if (node->type == TEXT_NODE) {
+                out_puts(out, node->text_content);
+            } else {
+                out_append(out, "<", 1);
+                out_puts(out, node->tag_name);
+                for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                    out_html_attribute(out, attr);
+                }
+                out_append(out, ">", 1);
+            }
+            // An empty element keeps its close tag on the same line.
+            if (s->format == SERIALIZE_PRETTY &&
+                (node->type == TEXT_NODE || node->first_child != NULL || is_void(node))) {
+                out_append(out, "\n", 1);
+            }
+            return;
+
+        case SERIALIZE_JSON:
+            if (!first) {
+                out_append(out, ",", 1);
+            }
+            if (node->type == TEXT_NODE) {
+                out_puts(out, "{\"type\":\"text\",\"text\":");
+                out_json_string(out, node->text_content);
+                out_append(out, "}", 1);
+                return;
+            }
+            if (node->flags & DOM_FLAG_DOCUMENT) {
+                out_puts(out, "{\"type\":\"document\",\"tag\":");
+            } else {
+                out_puts(out, "{\"type\":\"element\",\"tag\":");
+            }
+            out_json_string(out, node->tag_name);
+            out_puts(out, ",\"attributes\":{");
+            for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                if (attr != node->attributes) {
+                    out_append(out, ",", 1);
+                }
+                out_json_string(out, attr->name);
+                out_append(out, ":", 1);
+                out_json_string(out, attr->value);
+            }
+            out_puts(out, "},\"children\":[");
+            return;
+
+        case SERIALIZE_TREE:
+            out_indent(out, level);
+            if (node->type == ELEMENT_NODE) {
+                out_puts(out, "|-<");
+                out_puts(out, node->tag_name);
+                for (const Attribute* attr = node->attributes; attr != NULL; attr = attr->next) {
+                    out_append(out, " ", 1);
+                    out_puts(out, attr->name);
+                    out_append(out, "=\"", 2);
+                    out_puts(out, attr->value);
+                    out_append(out, "\"", 1);
+                }
+                out_append(out, ">\n", 2);
+            } else {
+                out_puts(out, "|-TEXT: ");
+                out_puts(out, node->text_content);
+                out_append(out, "\n", 1);
+            }
+            return;
+    }
+}
+
+// Called once an element's children are done (elements only).
+static void leave_node(Serializer* s, const DomNode* node, int depth) {
+    OutBuffer* out = s->out;
+
+    switch (s->format) {
+        case SERIALIZE_HTML:
+        case SERIALIZE_PRETTY:
+            if (node == s->skip || (node->first_child == NULL && is_void(node))) {
+                return;
+            }
+            if (s->format == SERIALIZE_PRETTY && node->first_child != NULL) {
+                out_indent(out, s->indent + depth - (s->skip != NULL));
+            }
+            out_append(out, "</", 2);
+            out_puts(out, node->tag_name);
+            out_append(out, ">", 1);
+            if (s->format == SERIALIZE_PRETTY) {
+                out_append(out, "\n", 1);
+            }
+            return;
+
+        case SERIALIZE_JSON:
+            out_append(out, "]}", 2);
+            return;
+
+        case SERIALIZE_TREE:
+            return;
+    }
+}
+
+void dom_serialize_to(OutBuffer* out, const DomNode* root, SerializeFormat format, int indent) {
+    if (root == NULL) {
+        return;
+    }
+    Serializer s = { out, format, indent, (root->flags & DOM_FLAG_DOCUMENT) ? root : NULL };
+
+    const DomNode** stack = NULL;
+    int depth = 0;
+    int capacity = 0;
+    int first = 1;
+
+    const DomNode* node = root;
+    while (node != NULL) {
+        enter_node(&s, node, depth, first);
+        first = 0;
+        if (node->type == ELEMENT_NODE) {
+            if (node->first_child != NULL) {
+                if (depth == capacity) {
+                    capacity = capacity ? capacity * 2 : 64;
+                    const DomNode** grown = (const DomNode**)realloc(stack, capacity * sizeof(DomNode*));
+                    if (grown == NULL) {
+                        fprintf(stderr, "Fatal: Memory allocation failed.\n");
+                        exit(EXIT_FAILURE);
+                    }
+                    stack = grown;
+                }
+                stack[depth++] = node;
+                node = node->first_child;
+                first = 1;
+                continue;
+            }
+            leave_node(&s, node, depth);
+        }
+        while (depth > 0 && node->next_sibling == NULL) {
+            node = stack[--depth];
+            leave_node(&s, node, depth);
+        }
+        node = depth > 0 ? node->next_sibling : NULL;
+    }
+    free(stack);
+    if (format == SERIALIZE_JSON) {
+        out_append(out, "\n", 1);
+    }
+}
+
+int dom_serialize(const DomNode* root, SerializeFormat format, int fd) {
+    OutBuffer out;
+    out_init(&out, fd);
+    dom_serialize_to(&out, root, format, 0);
+    int result = out_flush(&out);
+    out_free(&out);
+    return result;
+}
+
+char* dom_serialize_to_string(const DomNode* root, SerializeFormat format, size_t* length) {
+    OutBuffer out;
+    out_init(&out, -1);
+    dom_serialize_to(&out, root, format, 0);
+    if (out.data == NULL) {
+        out.data = safe_strdup("");
+    }
+    if (length) {
+        *length = out.length;
+    }
+    return out.data;
+}
@@ -0,0 +1,47 @@
+#ifndef SERIALIZE_H
+#define SERIALIZE_H
+
+#include <stddef.h>
+#include "dom.h"
+
+// Output formats for dom_serialize().
+typedef enum {
+    SERIALIZE_HTML,     // compact markup, re-parses to the same tree
+    SERIALIZE_PRETTY,   // markup with one node per line, indented
+    SERIALIZE_JSON,     // {"type": ..., "tag": ..., "attributes": {...}, "children": [...]}
+    SERIALIZE_TREE      // the "|-<tag>" / "|-TEXT:" debug listing
+} SerializeFormat;
+
+// Growable output buffer. With a file descriptor it is written out with
+// a single write() each time it fills up (and on out_flush); with fd < 0
+// it just accumulates in memory.
+typedef struct {
+    int fd;
+    char* data;
+    size_t length;
+    size_t capacity;
+    int failed;         // a write() failed; later output is dropped
+} OutBuffer;
+
+void out_init(OutBuffer* out, int fd);
+
+void out_append(OutBuffer* out, const char* data, size_t length);
+
+void out_puts(OutBuffer* out, const char* s);
+
+// Returns 0, or -1 if any write so far has failed.
+int out_flush(OutBuffer* out);
+
+void out_free(OutBuffer* out);
+
+// Serializes `root` into `out`. A document root contributes only its
+// children to the HTML formats.
+void dom_serialize_to(OutBuffer* out, const DomNode* root, SerializeFormat format, int indent);
+
+// Serializes straight to a file descriptor. Returns 0 or -1 on a write error.
+int dom_serialize(const DomNode* root, SerializeFormat format, int fd);
+
+// Returns a NUL-terminated string the caller frees; `length` may be NULL.
+char* dom_serialize_to_string(const DomNode* root, SerializeFormat format, size_t* length);
+
+#endif
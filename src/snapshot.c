@@ -0,0 +1,147 @@
+#define _POSIX_C_SOURCE 200809L
+#include "snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+int snapshot_write_flat(const FlatDocument* flat, const char* path) {
+    size_t offsets[FLAT_SECTIONS];
+    size_t payload = flat_layout(flat->node_count, flat->attr_count, flat->string_bytes, offsets);
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.atom_count = ATOM_STATIC_COUNT;
+    header.node_count = flat->node_count;
+    header.attr_count = flat->attr_count;
+    header.string_bytes = flat->string_bytes;
+    header.payload_bytes = payload;
+
+    // Written under a unique name next to the target and renamed over it
+    // once it is on disk, so concurrent writers of the same snapshot do
+    // not clobber each other and a crash never leaves a partial file
+    // under the final name.
+    size_t tmp_length = strlen(path) + 8;
+    char* tmp_path = (char*)safe_malloc(tmp_length);
+    snprintf(tmp_path, tmp_length, "%s.XXXXXX", path);
+    int fd = mkstemp(tmp_path);
+    if (fd < 0) {
+        free(tmp_path);
+        return -1;
+    }
+    FILE* file = fdopen(fd, "wb");
+    if (file == NULL) {
+        close(fd);
+        remove(tmp_path);
+        free(tmp_path);
+        return -1;
+    }
+    int ok = fchmod(fd, 0644) == 0;
+    ok = ok && fwrite(&header, sizeof(header), 1, file) == 1;
+    // The block is contiguous from the first array, padding included.
+    if (ok && payload > 0) {
+        ok = fwrite(flat->atoms, 1, payload, file) == payload;
+    }
+    ok = ok && fflush(file) == 0 && fsync(fd) == 0;
+    ok = (fclose(file) == 0) && ok;
+    ok = ok && rename(tmp_path, path) == 0;
+    if (!ok) {
+        remove(tmp_path);
+    }
+    free(tmp_path);
+    return ok ? 0 : -1;
+}
+
+int snapshot_write(const DomNode* root, const char* path) {
+    FlatDocument* flat = flat_from_dom(root);
+    if (flat == NULL) {
+        return -1;
+    }
+    int result = snapshot_write_flat(flat, path);
+    flat_free(flat);
+    return result;
+}
+
+// Every index and offset must stay inside the image, so a truncated or
+// corrupted file can never send a reader out of bounds.
+static int validate(const FlatDocument* flat) {
+    uint32_t nodes = flat->node_count;
+    uint32_t bytes = flat->string_bytes;
+    if (nodes == 0 || bytes == 0 || flat->strings[bytes - 1] != '\0') {
+        return 0;
+    }
+    if (flat->parents[0] != FLAT_NONE || flat->subtree_ends[0] != nodes ||
+        flat->attr_begins[0] != 0 || flat->attr_begins[nodes] != flat->attr_count) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < nodes; i++) {
+        if (flat->types[i] != ELEMENT_NODE && flat->types[i] != TEXT_NODE) return 0;
+        if (flat->subtree_ends[i] <= i || flat->subtree_ends[i] > nodes) return 0;
+        if (flat->strings_at[i] >= bytes) return 0;
+        if (flat->atoms[i] < ATOM_NONE || flat->atoms[i] >= ATOM_STATIC_COUNT) return 0;
+        if (flat->attr_begins[i] > flat->attr_begins[i + 1]) return 0;
+        if (i > 0) {
+            uint32_t parent = flat->parents[i];
+            if (parent >= i || flat->subtree_ends[i] > flat->subtree_ends[parent]) return 0;
+        }
+    }
+    for (uint32_t a = 0; a < flat->attr_count; a++) {
+        if (flat->attr_names[a] >= bytes || flat->attr_values[a] >= bytes) return 0;
+        if (flat->attr_atoms[a] < ATOM_NONE || flat->attr_atoms[a] >= ATOM_STATIC_COUNT) return 0;
+    }
+    return 1;
+}
+
+Snapshot* snapshot_open(const char* path) {
+    Snapshot* snapshot = (Snapshot*)safe_malloc(sizeof(Snapshot));
+    if (map_file(path, &snapshot->file, 0) != 0) {
+        free(snapshot);
+        return NULL;
+    }
+
+    const char* data = snapshot->file.data;
+    size_t length = snapshot->file.length;
+    SnapshotHeader header;
+    int ok = length >= sizeof(header);
+    if (ok) {
+        memcpy(&header, data, sizeof(header));
+        ok = memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0 &&
+             header.version == SNAPSHOT_VERSION &&
+             header.byte_order == SNAPSHOT_BYTE_ORDER &&
+             header.atom_count == ATOM_STATIC_COUNT;
+    }
+
+    size_t offsets[FLAT_SECTIONS];
+    if (ok) {
+        size_t payload = flat_layout(header.node_count, header.attr_count, header.string_bytes, offsets);
+        ok = header.payload_bytes == payload && length - sizeof(header) == payload;
+    }
+    if (ok) {
+        FlatDocument* flat = &snapshot->document;
+        flat->node_count = header.node_count;
+        flat->attr_count = header.attr_count;
+        flat->string_bytes = header.string_bytes;
+        flat_bind(flat, (char*)data + sizeof(header), offsets);
+        flat->block = NULL;
+        ok = validate(flat);
+    }
+    if (!ok) {
+        unmap_file(&snapshot->file);
+        free(snapshot);
+        return NULL;
+    }
+    return snapshot;
+}
+
+void snapshot_close(Snapshot* snapshot) {
+    if (snapshot) {
+        unmap_file(&snapshot->file);
+        free(snapshot);
+    }
+}
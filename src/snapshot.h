@@ -0,0 +1,49 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "dom.h"
+#include "flat_dom.h"
+#include "utils.h"
+
+// On-disk DOM snapshots. The file is a SnapshotHeader followed by the
+// FlatDocument block exactly as flat_layout() arranges it, so opening a
+// snapshot is one mmap plus a bounds check; the tree is read in place
+// through the flat_* accessors without rebuilding any DomNode.
+//
+// Snapshots are tied to the producer's byte order and to the generated
+// atom table; either changing makes snapshot_open() reject the file.
+
+#define SNAPSHOT_MAGIC "HTMLDOM"
+#define SNAPSHOT_VERSION 2
+
+typedef struct {
+    char magic[8];              // SNAPSHOT_MAGIC, NUL padded
+    uint32_t version;           // SNAPSHOT_VERSION
+    uint32_t byte_order;        // 0x01020304 as written by the producer
+    uint32_t atom_count;        // ATOM_STATIC_COUNT of the producer
+    uint32_t node_count;
+    uint32_t attr_count;
+    uint32_t string_bytes;
+    uint64_t payload_bytes;     // size of the block after the header
+} SnapshotHeader;
+
+typedef struct {
+    FlatDocument document;      // arrays point into the mapping; read-only
+    FileBuffer file;
+} Snapshot;
+
+// Flattens `root` and writes it to `path` (via a uniquely named temporary
+// file that is synced and then renamed into place, so readers only ever
+// see a complete snapshot). Returns 0, or -1 on an I/O error.
+int snapshot_write(const DomNode* root, const char* path);
+
+int snapshot_write_flat(const FlatDocument* flat, const char* path);
+
+// Maps a snapshot written by snapshot_write(). Returns NULL if the file
+// cannot be read, has the wrong magic, version, byte order or atom table,
+// or fails the structural checks.
+Snapshot* snapshot_open(const char* path);
+
+void snapshot_close(Snapshot* snapshot);
+
+#endif
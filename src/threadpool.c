@@ -0,0 +1,214 @@
+#define _POSIX_C_SOURCE 200809L
+#include "threadpool.h"
+#include "utils.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+    TaskFunction function;
+    void* arg;
+} Task;
+
+// Ring buffer of tasks. The owner works at the tail, thieves at the head.
+typedef struct {
+    pthread_mutex_t lock;
+    Task* tasks;
+    int head;
+    int count;
+    int capacity;
+} TaskDeque;
+
+typedef struct {
+    ThreadPool* pool;
+    int index;
+    pthread_t thread;
+} Worker;
+
+struct ThreadPool {
+    Worker* workers;
+    TaskDeque* deques;
+    int worker_count;
+    int next_deque;         // round-robin submit position (submitter only)
+
+    int queued;             // tasks sitting in some deque (atomic)
+    int unfinished;         // submitted but not yet completed (atomic)
+    int shutdown;
+
+    pthread_mutex_t lock;   // guards the sleeps below, not the deques
+    pthread_cond_t work_available;
+    pthread_cond_t all_done;
+};
+
+static void deque_push(TaskDeque* deque, Task task) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count == deque->capacity) {
+        int capacity = deque->capacity ? deque->capacity * 2 : 64;
+        Task* grown = (Task*)safe_malloc(capacity * sizeof(Task));
+        for (int i = 0; i < deque->count; i++) {
+            grown[i] = deque->tasks[(deque->head + i) % deque->capacity];
+        }
+        free(deque->tasks);
+        deque->tasks = grown;
+        deque->head = 0;
+        deque->capacity = capacity;
+    }
+    deque->tasks[(deque->head + deque->count) % deque->capacity] = task;
+    deque->count++;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+static int deque_pop_tail(TaskDeque* deque, Task* task) {
+    int found = 0;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count > 0) {
+        deque->count--;
+        *task = deque->tasks[(deque->head + deque->count) % deque->capacity];
+        found = 1;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static int deque_steal_head(TaskDeque* deque, Task* task) {
+    int found = 0;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count > 0) {
+        *task = deque->tasks[deque->head];
+        deque->head = (deque->head + 1) % deque->capacity;
+        deque->count--;
+        found = 1;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static int find_task(ThreadPool* pool, int self, Task* task) {
+    if (deque_pop_tail(&pool->deques[self], task)) {
+        return 1;
+    }
+    for (int i = 1; i < pool->worker_count; i++) {
+        int victim = (self + i) % pool->worker_count;
+        if (deque_steal_head(&pool->deques[victim], task)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void* worker_main(void* arg) {
+    Worker* worker = (Worker*)arg;
+    ThreadPool* pool = worker->pool;
+
+    for (;;) {
+        Task task;
+        if (find_task(pool, worker->index, &task)) {
+            __atomic_sub_fetch(&pool->queued, 1, __ATOMIC_ACQ_REL);
+            task.function(task.arg);
+            if (__atomic_sub_fetch(&pool->unfinished, 1, __ATOMIC_ACQ_REL) == 0) {
+                pthread_mutex_lock(&pool->lock);
+                pthread_cond_broadcast(&pool->all_done);
+                pthread_mutex_unlock(&pool->lock);
+            }
+            continue;
+        }
+
+        // Nothing anywhere: sleep until a submit or shutdown. `queued` is
+        // re-checked under the lock that submitters signal with.
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->shutdown && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) <= 0) {
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+        }
+        int stop = pool->shutdown && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) <= 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (stop) {
+            return NULL;
+        }
+    }
+}
+
+ThreadPool* thread_pool_create(int workers) {
+    if (workers < 1) {
+        workers = 1;
+    }
+    ThreadPool* pool = (ThreadPool*)safe_malloc(sizeof(ThreadPool));
+    pool->worker_count = workers;
+    pool->next_deque = 0;
+    pool->queued = 0;
+    pool->unfinished = 0;
+    pool->shutdown = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+
+    pool->deques = (TaskDeque*)safe_malloc(workers * sizeof(TaskDeque));
+    pool->workers = (Worker*)safe_malloc(workers * sizeof(Worker));
+    for (int i = 0; i < workers; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].tasks = NULL;
+        pool->deques[i].head = 0;
+        pool->deques[i].count = 0;
+        pool->deques[i].capacity = 0;
+    }
+    for (int i = 0; i < workers; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main, &pool->workers[i]) != 0) {
+            fprintf(stderr, "Fatal: Could not start worker thread.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return pool;
+}
+
+void thread_pool_submit(ThreadPool* pool, TaskFunction function, void* arg) {
+    Task task = { function, arg };
+    __atomic_add_fetch(&pool->unfinished, 1, __ATOMIC_ACQ_REL);
+    deque_push(&pool->deques[pool->next_deque], task);
+    pool->next_deque = (pool->next_deque + 1) % pool->worker_count;
+    __atomic_add_fetch(&pool->queued, 1, __ATOMIC_ACQ_REL);
+
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_signal(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void thread_pool_wait(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    while (__atomic_load_n(&pool->unfinished, __ATOMIC_ACQUIRE) > 0) {
+        pthread_cond_wait(&pool->all_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void thread_pool_destroy(ThreadPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+    thread_pool_wait(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->worker_count; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    for (int i = 0; i < pool->worker_count; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].tasks);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_cond_destroy(&pool->all_done);
+    free(pool->deques);
+    free(pool->workers);
+    free(pool);
+}
+
+int thread_pool_default_workers(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
@@ -0,0 +1,26 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+// Fixed-size worker pool with per-worker task deques. Each worker pops
+// its own newest task first and, when it runs dry, steals the oldest task
+// from another worker, so uneven task sizes still keep every thread busy.
+
+typedef void (*TaskFunction)(void* arg);
+
+typedef struct ThreadPool ThreadPool;
+
+// Starts `workers` threads (at least one).
+ThreadPool* thread_pool_create(int workers);
+
+// Queues a task. Tasks are spread over the workers round-robin.
+void thread_pool_submit(ThreadPool* pool, TaskFunction function, void* arg);
+
+// Blocks until every submitted task has finished.
+void thread_pool_wait(ThreadPool* pool);
+
+// Waits for outstanding tasks, then stops and frees the pool.
+void thread_pool_destroy(ThreadPool* pool);
+
+int thread_pool_default_workers(void);
+
+#endif
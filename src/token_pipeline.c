@@ -0,0 +1,106 @@
+#define _POSIX_C_SOURCE 200809L
+#include "token_pipeline.h"
+#include "utils.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define RING_SIZE 4096                  // slots, a power of two
+#define RING_MASK (RING_SIZE - 1)
+#define PUBLISH_EVERY 64                // tokens between tail updates
+#define CACHE_LINE 64
+
+struct TokenPipeline {
+    // Written by the lexer thread only.
+    unsigned int tail;                  // slots filled so far
+    char tail_pad[CACHE_LINE - sizeof(unsigned int)];
+    // Written by the consumer only.
+    unsigned int head;                  // slots taken so far
+    int stop;                           // asks the lexer thread to quit
+    char head_pad[CACHE_LINE - sizeof(unsigned int) - sizeof(int)];
+
+    Lexer* lexer;
+    pthread_t thread;
+    PipelineToken slots[RING_SIZE];
+};
+
+// Busy-waits for a short while, then gives the CPU away, so a waiting
+// side costs little when both threads share a core.
+static void back_off(int* spins) {
+    if (++*spins < 64) {
+        __asm__ __volatile__("" ::: "memory");
+    } else {
+        sched_yield();
+    }
+}
+
+static void* lex_ahead(void* arg) {
+    TokenPipeline* pipeline = (TokenPipeline*)arg;
+    Lexer* lexer = pipeline->lexer;
+    unsigned int tail = 0;
+    unsigned int head = 0;              // last seen value of pipeline->head
+    while (1) {
+        if (tail - head == RING_SIZE) {
+            // Full: let the consumer see everything, then wait for room.
+            __atomic_store_n(&pipeline->tail, tail, __ATOMIC_RELEASE);
+            int spins = 0;
+            while ((head = __atomic_load_n(&pipeline->head, __ATOMIC_ACQUIRE)) + RING_SIZE == tail) {
+                if (__atomic_load_n(&pipeline->stop, __ATOMIC_RELAXED)) {
+                    return NULL;
+                }
+                back_off(&spins);
+            }
+        }
+        PipelineToken* slot = &pipeline->slots[tail & RING_MASK];
+        slot->token = get_next_token(lexer);
+        slot->end = lexer->current;
+        slot->inside_tag = lexer->insideTag;
+        tail++;
+
+        int last = slot->token.type == TOKEN_EOF || slot->token.type == TOKEN_ERROR;
+        if (last || tail % PUBLISH_EVERY == 0) {
+            __atomic_store_n(&pipeline->tail, tail, __ATOMIC_RELEASE);
+            if (last || __atomic_load_n(&pipeline->stop, __ATOMIC_RELAXED)) {
+                return NULL;
+            }
+        }
+    }
+}
+
+TokenPipeline* token_pipeline_start(Lexer* lexer) {
+    TokenPipeline* pipeline = (TokenPipeline*)safe_malloc(sizeof(TokenPipeline));
+    pipeline->tail = 0;
+    pipeline->head = 0;
+    pipeline->stop = 0;
+    pipeline->lexer = lexer;
+    if (pthread_create(&pipeline->thread, NULL, lex_ahead, pipeline) != 0) {
+        free(pipeline);
+        return NULL;
+    }
+    return pipeline;
+}
+
+int token_pipeline_take(TokenPipeline* pipeline, PipelineToken* out, int max) {
+    unsigned int head = pipeline->head;
+    unsigned int tail;
+    int spins = 0;
+    while ((tail = __atomic_load_n(&pipeline->tail, __ATOMIC_ACQUIRE)) == head) {
+        back_off(&spins);
+    }
+    int count = tail - head < (unsigned int)max ? (int)(tail - head) : max;
+    for (int i = 0; i < count; i++) {
+        out[i] = pipeline->slots[(head + i) & RING_MASK];
+    }
+    __atomic_store_n(&pipeline->head, head + count, __ATOMIC_RELEASE);
+    return count;
+}
+
+void token_pipeline_stop(TokenPipeline* pipeline) {
+    __atomic_store_n(&pipeline->stop, 1, __ATOMIC_RELAXED);
+    pthread_join(pipeline->thread, NULL);
+    // Tokens that were lexed but never taken.
+    for (unsigned int i = pipeline->head; i != pipeline->tail; i++) {
+        free_token_lexeme(&pipeline->slots[i & RING_MASK].token);
+    }
+    free(pipeline);
+}
@@ -0,0 +1,40 @@
+#ifndef TOKEN_PIPELINE_H
+#define TOKEN_PIPELINE_H
+
+#include "lexer.h"
+
+// Inputs shorter than this are not worth a thread (ParserOptions.pipeline).
+#define TOKEN_PIPELINE_MIN_INPUT (64 * 1024)
+
+// Tokens handed to the consumer per token_pipeline_take().
+#define TOKEN_PIPELINE_BATCH 256
+
+// A token and the lexer's position right after it.
+typedef struct {
+    Token token;
+    int end;
+    int inside_tag;
+} PipelineToken;
+
+// Runs a lexer on its own thread, ahead of the parser. Tokens travel
+// through a single-producer, single-consumer ring: each side only ever
+// writes its own index, and the indexes are published with release
+// stores and read with acquire loads, so neither side takes a lock. A
+// side that finds the ring empty (or full) spins briefly, then yields.
+typedef struct TokenPipeline TokenPipeline;
+
+// Starts lexing `lexer` (whole input, not streaming) on a new thread;
+// from now on only that thread may advance it. NULL if no thread could
+// be started.
+TokenPipeline* token_pipeline_start(Lexer* lexer);
+
+// Moves up to `max` tokens into `out`, waiting until there is at least
+// one. The last token of the input is TOKEN_EOF or TOKEN_ERROR; do not
+// ask for more after it.
+int token_pipeline_take(TokenPipeline* pipeline, PipelineToken* out, int max);
+
+// Stops the lexer thread, if it is still running, and frees the
+// pipeline. The lexer belongs to the caller again.
+void token_pipeline_stop(TokenPipeline* pipeline);
+
+#endif
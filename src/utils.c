@@ -1,9 +1,23 @@
+#define _POSIX_C_SOURCE 200809L
 #include "utils.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static __thread AllocStats thread_alloc_stats;
+
+AllocStats alloc_stats(void) {
+    return thread_alloc_stats;
+}
 
 void* safe_malloc(size_t size) {
+    thread_alloc_stats.count++;
+    thread_alloc_stats.bytes += size;
     void* ptr = malloc(size);
     if (ptr == NULL) {
         fprintf(stderr, "Fatal: Memory allocation failed.\n");
@@ -22,33 +36,119 @@ char* safe_strdup(const char* s) {
     return new_str;
 }
 
-char* read_file_to_buffer(const char* filename) {
-    FILE* file = fopen(filename, "r");
-    if (file == NULL) {
-        perror("Error opening file");
+char* safe_strndup(const char* s, size_t n) {
+    if (s == NULL) {
         return NULL;
     }
-    fseek(file, 0, SEEK_END);
-    long file_size = ftell(file);
-    if (file_size == -1) {
+    char* new_str = (char*)safe_malloc(n + 1);
+    memcpy(new_str, s, n);
+    new_str[n] = '\0';
+    return new_str;
+}
+
+static int input_too_large(size_t limit) {
+    fprintf(stderr, "Error: Input is larger than the limit of %zu bytes.\n", limit);
+    return -1;
+}
+
+// Reads at most `limit` bytes; one more is an error.
+static int read_fd_to_buffer(int fd, FileBuffer* file, size_t limit) {
+    size_t capacity = limit < 64 * 1024 ? limit + 1 : 64 * 1024;
+    size_t length = 0;
+    char* buffer = (char*)safe_malloc(capacity);
+    while (1) {
+        if (length == capacity) {
+            if (length > limit) {
+                free(buffer);
+                return input_too_large(limit);
+            }
+            capacity = capacity <= limit / 2 ? capacity * 2 : limit + 1;
+            char* grown = (char*)realloc(buffer, capacity);
+            if (grown == NULL) {
+                free(buffer);
+                fprintf(stderr, "Fatal: Memory allocation failed.\n");
+                exit(EXIT_FAILURE);
+            }
+            buffer = grown;
+        }
+        ssize_t n = read(fd, buffer + length, capacity - length);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("Error reading file");
+            free(buffer);
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        length += (size_t)n;
+    }
+    file->data = buffer;
+    file->length = length;
+    file->mapped = 0;
+    return 0;
+}
+
+int map_file(const char* filename, FileBuffer* file, size_t max_bytes) {
+    file->data = NULL;
+    file->length = 0;
+    file->mapped = 0;
+    size_t limit = max_bytes != 0 && max_bytes < INPUT_MAX_BYTES ? max_bytes : INPUT_MAX_BYTES;
+
+    if (strcmp(filename, "-") == 0) {
+        return read_fd_to_buffer(STDIN_FILENO, file, limit);
+    }
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("Error opening file");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
         perror("Error getting file size");
-        fclose(file);
-        return NULL;
+        close(fd);
+        return -1;
     }
-    fseek(file, 0, SEEK_SET);
-    char* buffer = (char*)safe_malloc(file_size + 1);
-    size_t bytes_read = fread(buffer, 1, file_size, file);
-    if (bytes_read < (size_t)file_size) {
-        if (ferror(file)) {
-            perror("Error reading file");
+
+    if (S_ISREG(st.st_mode) && (unsigned long long)st.st_size > limit) {
+        close(fd);
+        return input_too_large(limit);
+    }
+
+    int result;
+    // Pipes, FIFOs and character devices cannot be mapped; empty files
+    // cannot either (mmap rejects a zero length).
+    if (!S_ISREG(st.st_mode) || st.st_size == 0) {
+        result = read_fd_to_buffer(fd, file, limit);
+    } else {
+        void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            result = read_fd_to_buffer(fd, file, limit);
         } else {
-            fprintf(stderr, "Error: Incomplete file read.\n");
+            posix_madvise(view, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+            file->data = (const char*)view;
+            file->length = (size_t)st.st_size;
+            file->mapped = 1;
+            result = 0;
         }
-        fclose(file);
-        free(buffer);
-        return NULL;
     }
-    buffer[file_size] = '\0';
-    fclose(file);
-    return buffer;
+    close(fd);
+    return result;
+}
+
+void unmap_file(FileBuffer* file) {
+    if (file == NULL || file->data == NULL) {
+        return;
+    }
+    if (file->mapped) {
+        munmap((void*)file->data, file->length);
+    } else {
+        free((void*)file->data);
+    }
+    file->data = NULL;
+    file->length = 0;
+    file->mapped = 0;
 }
@@ -1,11 +1,41 @@
 #ifndef UTILS_H
 #define UTILS_H
 #include <stddef.h> 
+#include <limits.h>
 
 void* safe_malloc(size_t size);
 
+// safe_malloc() calls made by the calling thread and the bytes they asked
+// for. Counted per thread, so the count costs no synchronisation; take the
+// difference of two readings to measure a piece of work.
+typedef struct {
+    size_t count;
+    size_t bytes;
+} AllocStats;
+
+AllocStats alloc_stats(void);
+
 char* safe_strdup(const char* s);
 
-char* read_file_to_buffer(const char* filename);
+char* safe_strndup(const char* s, size_t n);
+
+// An input document held either as a read-only mmap view of a regular
+// file or, for pipes, terminals and stdin ("-"), as a heap buffer.
+// `data` is NOT NUL-terminated; always use `length`.
+typedef struct {
+    const char* data;
+    size_t length;
+    int mapped;
+} FileBuffer;
+
+// Largest input a Lexer can index; its offsets are int.
+#define INPUT_MAX_BYTES ((size_t)INT_MAX)
+
+// Returns 0 on success, -1 (after printing the reason) on failure. Inputs
+// over `max_bytes` (0 for no limit of its own) or INPUT_MAX_BYTES are
+// refused; a pipe is read no further than that, so memory stays bounded.
+int map_file(const char* filename, FileBuffer* file, size_t max_bytes);
+
+void unmap_file(FileBuffer* file);
 
 #endif 
@@ -0,0 +1,441 @@
+/**
+ * tests/test_dom.c
+ *
+ * Unit tests for the DOM and its supporting allocators.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/arena.h"
+#include "../src/atoms.h"
+#include "../src/dom.h"
+#include "../src/entities.h"
+#include "../src/flat_dom.h"
+#include "../src/serialize.h"
+#include "../src/snapshot.h"
+
+// Helper macro for assertions
+#define ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s (at %s:%d)\n", message, __FILE__, __LINE__); \
+            return 0; \
+        } \
+    } while (0)
+
+int test_arena_alloc() {
+    printf("  Running test_arena_alloc...\n");
+    Arena* arena = arena_create();
+
+    char* small = arena_strndup(arena, "hello world", 5);
+    ASSERT(strcmp(small, "hello") == 0, "arena_strndup did not copy 5 bytes");
+
+    // Enough allocations to spill over several blocks, plus one oversized.
+    for (int i = 0; i < 10000; i++) {
+        void** slot = (void**)arena_alloc(arena, sizeof(void*) * 3);
+        ASSERT(((size_t)slot % sizeof(void*)) == 0, "arena_alloc returned misaligned memory");
+        slot[0] = slot;
+    }
+    char* big = arena_alloc_bytes(arena, 1024 * 1024);
+    memset(big, 'x', 1024 * 1024);
+    ASSERT(strcmp(small, "hello") == 0, "Earlier allocation was clobbered");
+    ASSERT(arena->bytes_used >= 1024 * 1024, "bytes_used not tracked");
+
+    arena_destroy(arena);
+    printf("  ...test_arena_alloc: PASS\n");
+    return 1;
+}
+
+int test_document_build() {
+    printf("  Running test_document_build...\n");
+    DomDocument* doc = dom_document_create("#document");
+    DomNode* root = &doc->root;
+    ASSERT(root->flags & DOM_FLAG_DOCUMENT, "Root is not flagged as a document");
+
+    DomNode* div = document_create_element(doc, "divx", 3);
+    document_add_attribute(doc, div, "id", 2, "main", 4);
+    add_child(root, div);
+    add_child(div, document_create_text(doc, "Hi!", 2));
+
+    ASSERT(strcmp(root->first_child->tag_name, "div") == 0, "Tag is not 'div'");
+    ASSERT(strcmp(div->attributes->name, "id") == 0, "Attribute is not 'id'");
+    ASSERT(strcmp(div->attributes->value, "main") == 0, "Value is not 'main'");
+    ASSERT(strcmp(div->first_child->text_content, "Hi") == 0, "Text is not 'Hi'");
+    ASSERT(div->flags & DOM_FLAG_ARENA, "Node is not arena-owned");
+
+    // Arena nodes are released with their document, not one by one.
+    free_dom_tree(div);
+    free_dom_tree(root);
+    printf("  ...test_document_build: PASS\n");
+    return 1;
+}
+
+// Deep chains and long sibling lists used to overflow the recursive
+// free_dom_tree; both must now be released in constant stack space.
+int test_free_deep_and_wide() {
+    printf("  Running test_free_deep_and_wide...\n");
+    const int count = 200000;
+
+    DomNode* deep = create_element_node("div");
+    DomNode* current = deep;
+    for (int i = 0; i < count; i++) {
+        DomNode* child = create_element_node("div");
+        add_child(current, child);
+        current = child;
+    }
+    add_attribute(current, "id", "leaf");
+    free_dom_tree(deep);
+
+    DomNode* wide = create_element_node("ul");
+    DomNode* last = NULL;
+    for (int i = 0; i < count; i++) {
+        DomNode* item = create_text_node("x");
+        item->parent = wide;
+        if (last == NULL) {
+            wide->first_child = item;
+        } else {
+            last->next_sibling = item;
+        }
+        last = item;
+    }
+    free_dom_tree(wide);
+
+    printf("  ...test_free_deep_and_wide: PASS\n");
+    return 1;
+}
+
+int test_append_and_lookup() {
+    printf("  Running test_append_and_lookup...\n");
+    char name[16];
+    char value[16];
+
+    // Heap-built and document-built elements, across the map threshold.
+    DomDocument* doc = dom_document_create("#document");
+    DomNode* heap = create_element_node("div");
+    DomNode* element = document_create_element(doc, "div", 3);
+    add_child(&doc->root, element);
+    for (int i = 0; i < 100; i++) {
+        sprintf(name, "data-%d", i);
+        sprintf(value, "v%d", i);
+        add_attribute(heap, name, value);
+        document_add_attribute(doc, element, name, strlen(name), value, strlen(value));
+        if (i == 3 || i == 99) {
+            ASSERT(strcmp(dom_get_attribute(heap, "data-2"), "v2") == 0, "Heap lookup failed");
+            ASSERT(strcmp(dom_get_attribute(element, "data-3"), "v3") == 0, "Document lookup failed");
+            ASSERT((heap->attribute_map != NULL) == (i == 99), "Map threshold not respected");
+        }
+    }
+    add_attribute(heap, "data-7", "duplicate");
+    document_add_attribute(doc, element, "data-7", 6, "duplicate", 9);
+    ASSERT(heap->attribute_count == 101 && element->attribute_count == 101, "Wrong attribute count");
+    ASSERT(strcmp(heap->last_attribute->value, "duplicate") == 0, "Wrong attribute tail");
+    ASSERT(strcmp(dom_get_attribute(heap, "data-7"), "v7") == 0, "First duplicate must win");
+    ASSERT(strcmp(dom_get_attribute(element, "data-7"), "v7") == 0, "First duplicate must win");
+    ASSERT(strcmp(dom_get_attribute_n(element, "data-42xyz", 7), "v42") == 0, "Length-bounded lookup failed");
+    ASSERT(dom_get_attribute(element, "data-100") == NULL, "Missing attribute found");
+    ASSERT(dom_get_attribute(element, "data") == NULL, "Prefix matched an attribute");
+
+    for (int i = 0; i < 1000; i++) {
+        add_child(heap, create_text_node("x"));
+    }
+    ASSERT(heap->child_count == 1000, "Wrong child count");
+    ASSERT(heap->last_child->next_sibling == NULL && heap->last_child->parent == heap, "Wrong child tail");
+    ASSERT(doc->root.child_count == 1 && doc->root.last_child == element, "Wrong document children");
+
+    free_dom_tree(heap);
+    free_dom_tree(&doc->root);
+    printf("  ...test_append_and_lookup: PASS\n");
+    return 1;
+}
+
+static int decodes_to(const char* text, int attribute, const char* expected) {
+    char out[256];
+    size_t length = entity_decode(text, strlen(text), out, attribute);
+    if (length != strlen(expected) || strcmp(out, expected) != 0) {
+        printf("FAIL: '%s' decoded to '%s', expected '%s'\n", text, out, expected);
+        return 0;
+    }
+    return 1;
+}
+
+int test_entities() {
+    printf("  Running test_entities...\n");
+
+    int ok = 1;
+    ok &= decodes_to("no references", 0, "no references");
+    ok &= decodes_to("a &amp; b &lt;c&gt;", 0, "a & b <c>");
+    ok &= decodes_to("&eacute;t&eacute; &hellip;", 0, "\xC3\xA9t\xC3\xA9 \xE2\x80\xA6");
+    ok &= decodes_to("&#39;&#x27;&#X41;&#65", 0, "''AA");
+    ok &= decodes_to("&#0;&#xD800;&#x110000;", 0, "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD");
+    ok &= decodes_to("&#128;&#x9F;&#x81;", 0, "\xE2\x82\xAC\xC5\xB8\xC2\x81");
+    ok &= decodes_to("&nGt;", 0, "\xE2\x89\xAB\xE2\x83\x92");
+    // Legacy names match without ';' and as a prefix, except in
+    // attribute values where an alphanumeric or '=' follows.
+    ok &= decodes_to("&copy 2024 &notit;", 0, "\xC2\xA9 2024 \xC2\xACit;");
+    ok &= decodes_to("?a=1&copy=2&amp;b", 1, "?a=1&copy=2&b");
+    ok &= decodes_to("&ampx", 0, "&x");
+    ok &= decodes_to("&ampx", 1, "&ampx");
+    ok &= decodes_to("& &; &# &#x; &unknown; &", 0, "& &; &# &#x; &unknown; &");
+    ASSERT(ok, "Character references decoded incorrectly");
+
+    // DOM access decodes lazily and keeps undecoded strings as they are.
+    DomDocument* doc = dom_document_create("#document");
+    DomNode* a = document_create_element(doc, "a", 1);
+    add_child(&doc->root, a);
+    document_add_attribute(doc, a, "href", 4, "?x=1&amp;y=2", 12);
+    document_add_attribute(doc, a, "id", 2, "plain", 5);
+    DomNode* plain = document_create_text(doc, "plain text", 10);
+    DomNode* text = document_create_text(doc, "1 &lt; 2", 8);
+    add_child(a, plain);
+    add_child(a, text);
+    ASSERT(text->decoded_text == NULL, "Text was decoded before it was read");
+    ASSERT(strcmp(dom_text(text), "1 < 2") == 0, "Wrong decoded text");
+    ASSERT(strcmp(text->text_content, "1 &lt; 2") == 0, "Source text was changed");
+    ASSERT(dom_text(plain) == plain->text_content, "Text without '&' was copied");
+    ASSERT(strcmp(dom_attribute_value(a, "href"), "?x=1&y=2") == 0, "Wrong decoded attribute");
+    ASSERT(dom_attribute_value(a, "id") == dom_get_attribute(a, "id"), "Value without '&' was copied");
+    ASSERT(dom_attribute_value(a, "title") == NULL && dom_text(a) == NULL, "Decoded something that is not there");
+    free_dom_tree(&doc->root);
+
+    DomNode* heap = create_element_node("p");
+    add_attribute(heap, "title", "&quot;x&quot;");
+    add_child(heap, create_text_node("&#x263A;"));
+    dom_decode_tree(heap);
+    ASSERT(strcmp(heap->attributes->decoded, "\"x\"") == 0, "Heap attribute not decoded");
+    ASSERT(strcmp(heap->first_child->decoded_text, "\xE2\x98\xBA") == 0, "Heap text not decoded");
+    free_dom_tree(heap);
+
+    printf("  ...test_entities: PASS\n");
+    return 1;
+}
+
+int test_atoms() {
+    printf("  Running test_atoms...\n");
+
+    // Every generated name must hash back to its own id.
+    for (Atom atom = 1; atom < ATOM_STATIC_COUNT; atom++) {
+        const char* name = atom_table_name(NULL, atom);
+        ASSERT(name != NULL, "Static atom has no name");
+        ASSERT(atom_lookup(name, strlen(name)) == atom, name);
+    }
+    ASSERT(atom_lookup("div", 3) == ATOM_DIV, "div is not ATOM_DIV");
+    ASSERT(atom_lookup("divx", 3) == ATOM_DIV, "Lookup ignored the length");
+    ASSERT(atom_lookup("DIV", 3) == ATOM_NONE, "Names are case-sensitive");
+    ASSERT(atom_lookup("my-widget", 9) == ATOM_NONE, "Unknown name resolved");
+    ASSERT(atom_is_void(ATOM_BR) && !atom_is_void(ATOM_DIV), "Void flags are wrong");
+
+    DomDocument* doc = dom_document_create("#document");
+    Atom first = atom_intern(&doc->atoms, "my-widget", 9);
+    ASSERT(first >= ATOM_STATIC_COUNT, "Unknown name did not get a dynamic atom");
+    for (int i = 0; i < 1000; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "x-%d", i);
+        atom_intern(&doc->atoms, name, strlen(name));
+    }
+    ASSERT(atom_intern(&doc->atoms, "my-widget", 9) == first, "Interning is not stable");
+    ASSERT(atom_intern(&doc->atoms, "x-512", 5) == first + 513, "Dynamic ids are not sequential");
+
+    DomNode* a = document_create_element(doc, "my-widget", 9);
+    DomNode* b = document_create_element(doc, "my-widget", 9);
+    ASSERT(a->tag_atom == first && a->tag_name == b->tag_name, "Repeated names are not shared");
+    free_dom_tree(&doc->root);
+
+    printf("  ...test_atoms: PASS\n");
+    return 1;
+}
+
+
+// Recursive is fine here: the trees under test are shallow.
+static int same_tree(const DomNode* a, const DomNode* b) {
+    if (a->type != b->type) return 0;
+    if (a->type == ELEMENT_NODE && strcmp(a->tag_name, b->tag_name) != 0) return 0;
+    if (a->type == TEXT_NODE && strcmp(a->text_content, b->text_content) != 0) return 0;
+    const Attribute* x = a->attributes;
+    const Attribute* y = b->attributes;
+    for (; x && y; x = x->next, y = y->next) {
+        if (strcmp(x->name, y->name) != 0 || strcmp(x->value, y->value) != 0) return 0;
+    }
+    if (x || y) return 0;
+    const DomNode* c = a->first_child;
+    const DomNode* d = b->first_child;
+    for (; c && d; c = c->next_sibling, d = d->next_sibling) {
+        if (c->parent != a || d->parent != b || !same_tree(c, d)) return 0;
+    }
+    return c == NULL && d == NULL;
+}
+
+int test_flat_round_trip() {
+    printf("  Running test_flat_round_trip...\n");
+
+    // <root><div id="a" class="x"><p>one</p><p>two</p></div><my-tag k="v"/>tail</root>
+    DomDocument* doc = dom_document_create("root");
+    DomNode* div = document_create_element(doc, "div", 3);
+    document_add_attribute(doc, div, "id", 2, "a", 1);
+    document_add_attribute(doc, div, "class", 5, "x", 1);
+    add_child(&doc->root, div);
+    for (int i = 0; i < 2; i++) {
+        DomNode* p = document_create_element(doc, "p", 1);
+        add_child(p, document_create_text(doc, i ? "two" : "one", 3));
+        add_child(div, p);
+    }
+    DomNode* custom = document_create_element(doc, "my-tag", 6);
+    document_add_attribute(doc, custom, "k", 1, "v", 1);
+    add_child(&doc->root, custom);
+    add_child(&doc->root, document_create_text(doc, "tail", 4));
+
+    FlatDocument* flat = flat_from_dom(&doc->root);
+    ASSERT(flat->node_count == 8, "Wrong node count");
+    ASSERT(flat->attr_count == 3, "Wrong attribute count");
+    ASSERT(flat->subtree_ends[0] == 8 && flat->subtree_ends[1] == 6, "Subtree ranges are wrong");
+    ASSERT(flat->parents[2] == 1 && flat->parents[4] == 1, "Parents are wrong");
+    ASSERT(flat_first_child(flat, 1) == 2 && flat_next_sibling(flat, 2) == 4, "Navigation is wrong");
+    ASSERT(flat_next_sibling(flat, 4) == FLAT_NONE, "Last child has a sibling");
+    ASSERT(flat_first_child(flat, 3) == FLAT_NONE, "Text node has children");
+    ASSERT(flat->strings_at[2] == flat->strings_at[4], "Tag names are not shared");
+    ASSERT(strcmp(flat_node_string(flat, 5), "two") == 0, "Wrong text");
+    ASSERT(flat->attr_begins[1] == 0 && flat->attr_begins[2] == 2, "Attribute range is wrong");
+    ASSERT(strcmp(flat->strings + flat->attr_values[2], "v") == 0, "Wrong attribute value");
+
+    DomNode* rebuilt = flat_to_dom(flat);
+    ASSERT(same_tree(&doc->root, rebuilt), "Round trip changed the tree");
+    ASSERT(rebuilt->first_child->next_sibling->tag_atom != ATOM_NONE, "Custom tag lost its atom");
+    free_dom_tree(rebuilt);
+    flat_free(flat);
+    free_dom_tree(&doc->root);
+
+    printf("  ...test_flat_round_trip: PASS\n");
+    return 1;
+}
+
+
+int test_serialize() {
+    printf("  Running test_serialize...\n");
+
+    DomDocument* doc = dom_document_create("#document");
+    DomNode* div = document_create_element(doc, "div", 3);
+    document_add_attribute(doc, div, "title", 5, "say \"hi\"", 8);
+    document_add_attribute(doc, div, "id", 2, "a", 1);
+    add_child(&doc->root, div);
+    add_child(div, document_create_text(doc, "x\ty", 3));
+    add_child(div, document_create_element(doc, "br", 2));
+    add_child(div, document_create_element(doc, "p", 1));
+
+    size_t length;
+    char* html = dom_serialize_to_string(&doc->root, SERIALIZE_HTML, &length);
+    ASSERT(strcmp(html, "<div title='say \"hi\"' id=\"a\">x\ty<br><p></p></div>") == 0, html);
+    ASSERT(length == strlen(html), "Wrong length");
+    free(html);
+
+    char* pretty = dom_serialize_to_string(&doc->root, SERIALIZE_PRETTY, NULL);
+    ASSERT(strcmp(pretty, "<div title='say \"hi\"' id=\"a\">\n  x\ty\n  <br>\n  <p></p>\n</div>\n") == 0, pretty);
+    free(pretty);
+
+    char* json = dom_serialize_to_string(div, SERIALIZE_JSON, NULL);
+    ASSERT(strcmp(json, "{\"type\":\"element\",\"tag\":\"div\","
+                        "\"attributes\":{\"title\":\"say \\\"hi\\\"\",\"id\":\"a\"},\"children\":["
+                        "{\"type\":\"text\",\"text\":\"x\\ty\"},"
+                        "{\"type\":\"element\",\"tag\":\"br\",\"attributes\":{},\"children\":[]},"
+                        "{\"type\":\"element\",\"tag\":\"p\",\"attributes\":{},\"children\":[]}]}\n") == 0, json);
+    free(json);
+
+    char* tree = dom_serialize_to_string(div, SERIALIZE_TREE, NULL);
+    ASSERT(strncmp(tree, "|-<div title=\"say \"hi\"\" id=\"a\">\n  |-TEXT: x\ty\n", 40) == 0, tree);
+    free(tree);
+
+    free_dom_tree(&doc->root);
+    printf("  ...test_serialize: PASS\n");
+    return 1;
+}
+
+int test_snapshot() {
+    printf("  Running test_snapshot...\n");
+
+    DomDocument* doc = dom_document_create("#document");
+    DomNode* ul = document_create_element(doc, "ul", 2);
+    document_add_attribute(doc, ul, "id", 2, "list", 4);
+    add_child(&doc->root, ul);
+    for (int i = 0; i < 100; i++) {
+        char text[16];
+        snprintf(text, sizeof(text), "item %d", i);
+        DomNode* li = document_create_element(doc, "li", 2);
+        add_child(li, document_create_text(doc, text, strlen(text)));
+        add_child(ul, li);
+    }
+
+    const char* path = "/tmp/html_parser_test_snapshot.bin";
+    ASSERT(snapshot_write(&doc->root, path) == 0, "Could not write snapshot");
+
+    Snapshot* snapshot = snapshot_open(path);
+    ASSERT(snapshot != NULL, "Could not open snapshot");
+    const FlatDocument* flat = &snapshot->document;
+    ASSERT(flat->node_count == 202, "Wrong node count");
+    // "#document" is not a static name, so only its string is kept.
+    ASSERT(flat->atoms[0] == ATOM_NONE && flat->atoms[1] == ATOM_UL && flat->atoms[2] == ATOM_LI,
+           "Wrong atoms in snapshot");
+    ASSERT(strcmp(flat_get_attribute(flat, 1, "id"), "list") == 0, "Attribute lookup failed");
+    ASSERT(flat_get_attribute(flat, 1, "class") == NULL, "Missing attribute was found");
+    uint32_t last = FLAT_NONE;
+    int items = 0;
+    for (uint32_t li = flat_first_child(flat, 1); li != FLAT_NONE; li = flat_next_sibling(flat, li)) {
+        last = li;
+        items++;
+    }
+    ASSERT(items == 100, "Wrong number of items");
+    ASSERT(strcmp(flat_node_string(flat, flat_first_child(flat, last)), "item 99") == 0, "Wrong item text");
+
+    DomNode* rebuilt = flat_to_dom(flat);
+    ASSERT(same_tree(&doc->root, rebuilt), "Snapshot changed the tree");
+    free_dom_tree(rebuilt);
+    snapshot_close(snapshot);
+
+    // A truncated file must be rejected, not read out of bounds.
+    FILE* file = fopen(path, "rb");
+    ASSERT(file != NULL, "Could not reopen snapshot");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    char* data = (char*)malloc(size);
+    file = fopen(path, "rb");
+    ASSERT(fread(data, 1, size, file) == (size_t)size, "Could not read snapshot");
+    fclose(file);
+    file = fopen(path, "wb");
+    fwrite(data, 1, size - 8, file);
+    fclose(file);
+    ASSERT(snapshot_open(path) == NULL, "Truncated snapshot was accepted");
+    // So must a header from another version.
+    ((SnapshotHeader*)data)->version = SNAPSHOT_VERSION + 1;
+    file = fopen(path, "wb");
+    fwrite(data, 1, size, file);
+    fclose(file);
+    ASSERT(snapshot_open(path) == NULL, "Snapshot with a future version was accepted");
+
+    free(data);
+    remove(path);
+    free_dom_tree(&doc->root);
+    printf("  ...test_snapshot: PASS\n");
+    return 1;
+}
+
+// Public test function
+int run_dom_tests() {
+    printf("--- Running DOM Tests ---\n");
+    int success = 1;
+
+    if (!test_arena_alloc()) success = 0;
+    if (!test_document_build()) success = 0;
+    if (!test_free_deep_and_wide()) success = 0;
+    if (!test_append_and_lookup()) success = 0;
+    if (!test_entities()) success = 0;
+    if (!test_atoms()) success = 0;
+    if (!test_flat_round_trip()) success = 0;
+    if (!test_serialize()) success = 0;
+    if (!test_snapshot()) success = 0;
+
+    if(success) {
+        printf("DOM Tests: PASS\n");
+    } else {
+        printf("DOM Tests: FAIL\n");
+    }
+    printf("-----------------------\n");
+    return success;
+}
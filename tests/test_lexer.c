@@ -8,6 +8,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "../src/lexer.h"
+#include "../src/scan.h"
+#include "../src/utils.h"
 
 // Helper function to check a token
 // Returns 1 on success, 0 on failure
@@ -29,7 +31,252 @@ int check_token(Lexer* lexer, TokenType expected_type, const char* expected_lexe
     return success;
 }
 
+// Same as check_token, but for a lexer in LEXEME_SPAN mode
+int check_span_token(Lexer* lexer, TokenType expected_type, const char* expected_lexeme) {
+    Token token = get_next_token(lexer);
+    int success = 1;
+
+    if (token.type != expected_type) {
+        printf("FAIL: Expected token %d, but got %d\n", expected_type, token.type);
+        success = 0;
+    }
+
+    if (token.lexeme != NULL) {
+        printf("FAIL: Span token should not own a lexeme\n");
+        success = 0;
+    }
+
+    if (expected_lexeme && !token_equals(lexer, &token, expected_lexeme)) {
+        printf("FAIL: Expected lexeme '%s', but got '%.*s'\n", expected_lexeme,
+               token_length(&token), token_text(lexer, &token));
+        success = 0;
+    }
+
+    return success;
+}
+
+int test_span_mode() {
+    int success = 1;
+    const char* test_string = "<a href='x'>Hi</a>";
+    Lexer* lexer = lexer_init(test_string);
+    lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
+
+    if (!check_span_token(lexer, TOKEN_OPEN_TAG, "a")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_NAME, "href")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_EQUALS, "=")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_VALUE, "x")) success = 0;
+    if (!check_span_token(lexer, TOKEN_GT, ">")) success = 0;
+    if (!check_span_token(lexer, TOKEN_TEXT, "Hi")) success = 0;
+    if (!check_span_token(lexer, TOKEN_CLOSE_TAG, "a")) success = 0;
+    if (!check_span_token(lexer, TOKEN_GT, ">")) success = 0;
+    if (!check_span_token(lexer, TOKEN_EOF, "")) success = 0;
+
+    lexer_free(lexer);
+    return success;
+}
+
+// The lexer must stop at `length` even when the buffer continues.
+int test_length_bounded() {
+    int success = 1;
+    const char buffer[] = { '<', 'p', '>', 'H', 'i', '<', '/', 'p', '>', 'X', 'Y' };
+    Lexer* lexer = lexer_init_n(buffer, 5);
+
+    if (!check_token(lexer, TOKEN_OPEN_TAG, "p")) success = 0;
+    if (!check_token(lexer, TOKEN_GT, ">")) success = 0;
+    if (!check_token(lexer, TOKEN_TEXT, "Hi")) success = 0;
+    if (!check_token(lexer, TOKEN_EOF, "")) success = 0;
+
+    lexer_free(lexer);
+
+    // A streaming lexer refuses a chunk its int offsets could not cover,
+    // before touching it.
+    Lexer* stream = lexer_init_stream();
+    if (lexer_feed(stream, "<p", 2) != 0 || lexer_feed(stream, "", INPUT_MAX_BYTES - 1) != -1 ||
+        stream->length != 2) {
+        printf("FAIL: Oversized chunk was taken\n");
+        success = 0;
+    }
+    lexer_free(stream);
+    return success;
+}
+
+// Positions are derived from offsets; a streaming lexer must report the
+// same ones after its buffer has been compacted.
+int test_positions() {
+    int success = 1;
+    const char* source = "<a>\n  <b x=\"1\">\n\n<c>";
+    int expected[][3] = { { 0, 1, 1 }, { 7, 2, 4 }, { 9, 2, 6 }, { 18, 4, 2 } };
+
+    Lexer* lexer = lexer_init(source);
+    for (int i = 0; i < 4; i++) {
+        int line, col;
+        lexer_position(lexer, expected[i][0], &line, &col);
+        if (line != expected[i][1] || col != expected[i][2]) {
+            printf("FAIL: offset %d is %d:%d, expected %d:%d\n", expected[i][0], line, col,
+                   expected[i][1], expected[i][2]);
+            success = 0;
+        }
+    }
+    lexer_free(lexer);
+
+    // Feed one byte at a time and ask for the position of every token.
+    Lexer* whole = lexer_init(source);
+    Lexer* stream = lexer_init_stream();
+    size_t fed = 0;
+    size_t length = strlen(source);
+    for (;;) {
+        Token token = get_next_token(stream);
+        if (token.type == TOKEN_NEED_MORE) {
+            free_token_lexeme(&token);
+            if (fed < length) {
+                lexer_feed(stream, source + fed++, 1);
+            } else {
+                lexer_finish(stream);
+            }
+            continue;
+        }
+        Token reference = get_next_token(whole);
+        int line, col, ref_line, ref_col;
+        lexer_position(stream, token.span.offset, &line, &col);
+        lexer_position(whole, reference.span.offset, &ref_line, &ref_col);
+        if (line != ref_line || col != ref_col) {
+            printf("FAIL: streamed token at %d:%d, expected %d:%d\n", line, col, ref_line, ref_col);
+            success = 0;
+        }
+        free_token_lexeme(&token);
+        free_token_lexeme(&reference);
+        if (reference.type == TOKEN_EOF || reference.type == TOKEN_ERROR) {
+            break;
+        }
+    }
+    lexer_free(stream);
+    lexer_free(whole);
+    return success;
+}
+
+// Every kernel level must agree with the scalar one for every needle
+// position, including the unaligned tails that are not a full vector.
+int test_scan_kernels() {
+    int success = 1;
+    char buffer[100];
+    ScanLevel levels[] = { SCAN_SCALAR, SCAN_SSE2, SCAN_AVX2 };
+
+    for (int l = 0; l < 3; l++) {
+        scan_set_level(levels[l]);
+        for (size_t n = 0; n < sizeof(buffer); n++) {
+            for (size_t hit = 0; hit <= n; hit++) {
+                memset(buffer, 'a', n);
+                memset(buffer, ' ', hit);
+                if (hit < n) buffer[hit] = '<';
+                if (scan_find_byte(buffer, n, '<') != hit) {
+                    printf("FAIL: scan_find_byte (%s) n=%zu hit=%zu\n", scan_level_name(scan_level()), n, hit);
+                    success = 0;
+                }
+                if (scan_count_byte(buffer, n, ' ') != hit) {
+                    printf("FAIL: scan_count_byte (%s) n=%zu hit=%zu\n", scan_level_name(scan_level()), n, hit);
+                    success = 0;
+                }
+                if (scan_skip_whitespace(buffer, n) != hit) {
+                    printf("FAIL: scan_skip_whitespace (%s) n=%zu hit=%zu\n", scan_level_name(scan_level()), n, hit);
+                    success = 0;
+                }
+            }
+        }
+    }
+    scan_set_level(SCAN_AVX2);
+    return success;
+}
+
 // Public test function
+// Names are ASCII letters, digits and '-' whatever the locale; other
+// bytes, including UTF-8, end them.
+int test_character_classes() {
+    int success = 1;
+    const char* source = "<h1 data-x9=\"v\" \xC3\xA9";
+    Lexer* lexer = lexer_init(source);
+    lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
+    if (!check_span_token(lexer, TOKEN_OPEN_TAG, "h1")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_NAME, "data-x9")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_EQUALS, "=")) success = 0;
+    if (!check_span_token(lexer, TOKEN_ATTR_VALUE, "v")) success = 0;
+    Token token = get_next_token(lexer);
+    if (token.type != TOKEN_ERROR || token.span.offset != 16) {
+        printf("FAIL: Expected an error at offset 16, got token %d at %d\n", token.type, token.span.offset);
+        success = 0;
+    }
+    lexer_free(lexer);
+
+    // A bad byte after '<' and a '/' without '>' are reported where they are.
+    const char* cases[][2] = { { "<\xC3\xA9>", "Invalid tag start." }, { "<a /b>", "Unexpected char inside tag." } };
+    int offsets[] = { 1, 3 };
+    for (int i = 0; i < 2; i++) {
+        lexer = lexer_init(cases[i][0]);
+        lexer_set_lexeme_mode(lexer, LEXEME_SPAN);
+        do {
+            token = get_next_token(lexer);
+        } while (token.type != TOKEN_ERROR && token.type != TOKEN_EOF);
+        if (token.type != TOKEN_ERROR || strcmp(token.message, cases[i][1]) != 0 || token.span.offset != offsets[i]) {
+            printf("FAIL: '%s' gave token %d at %d\n", cases[i][0], token.type, token.span.offset);
+            success = 0;
+        }
+        lexer_free(lexer);
+    }
+    return success;
+}
+
+// A token that keeps running into the end of the buffer is resumed, not
+// searched again from its start, whatever kind it is.
+int test_stream_resume() {
+    int success = 1;
+    const char* cases[][3] = {
+        { "<!--", "-", ">x" },         // comment, then the text "x"
+        { "<a b=\"", "v", "\">" },     // quoted value
+        { "", "t", "<" },              // text run
+        { "", " ", "x" },              // whitespace, then the text "x"
+    };
+    int longest[] = { 1, 6400, 6400, 1 };
+    char chunk[64];
+    for (int i = 0; i < 4; i++) {
+        Lexer* stream = lexer_init_stream();
+        lexer_set_lexeme_mode(stream, LEXEME_SPAN);
+        lexer_feed(stream, cases[i][0], strlen(cases[i][0]));
+        memset(chunk, cases[i][1][0], sizeof(chunk));
+        int fed = 0;
+        int length = 0;
+        int finished = 0;
+        for (;;) {
+            Token token = get_next_token(stream);
+            if (token.type == TOKEN_EOF || token.type == TOKEN_ERROR) {
+                break;
+            }
+            if (token.type != TOKEN_NEED_MORE) {
+                length = token.span.length > length ? token.span.length : length;
+                continue;
+            }
+            // Everything but the last two bytes has been searched for good.
+            if (stream->current != stream->length && stream->length - stream->scanned > 2) {
+                printf("FAIL: case %d rescans from %d of %d bytes\n", i, stream->scanned, stream->length);
+                success = 0;
+                break;
+            }
+            if (fed < 100) {
+                lexer_feed(stream, chunk, sizeof(chunk));
+                fed++;
+            } else if (!finished) {
+                lexer_feed(stream, cases[i][2], strlen(cases[i][2]));
+                lexer_finish(stream);
+                finished = 1;
+            }
+        }
+        if (length != longest[i]) {
+            printf("FAIL: case %d gave a %d byte token, expected %d\n", i, length, longest[i]);
+            success = 0;
+        }
+        lexer_free(stream);
+    }
+    return success;
+}
+
 int run_lexer_tests() {
     printf("--- Running Lexer Tests ---\n");
     int success = 1;
@@ -55,6 +302,13 @@ int run_lexer_tests() {
     if (!check_token(lexer, TOKEN_EOF, "")) success = 0;
 
     lexer_free(lexer);
+
+    if (!test_span_mode()) success = 0;
+    if (!test_scan_kernels()) success = 0;
+    if (!test_length_bounded()) success = 0;
+    if (!test_positions()) success = 0;
+    if (!test_character_classes()) success = 0;
+    if (!test_stream_resume()) success = 0;
     
     if(success) {
         printf("Lexer Tests: PASS\n");
@@ -3,12 +3,22 @@
  *
  * Unit tests for the Parser.
  */
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "../src/lexer.h"
 #include "../src/parser.h"
 #include "../src/dom.h"
 #include "../src/utils.h"
+#include "../src/threadpool.h"
+#include "../src/parse_cache.h"
+#include "../src/selector.h"
+#include "../src/serialize.h"
+#include "../src/parallel_parse.h"
+#include "../src/token_pipeline.h"
+#include "../src/reparse.h"
 
 // Helper macro for assertions
 #define ASSERT(condition, message) \
@@ -23,7 +33,7 @@ int test_simple_element() {
     printf("  Running test_simple_element...\n");
     const char* source = "<p>Hello</p>";
     Lexer* lexer = lexer_init(source);
-    Parser* parser = parser_init(lexer);
+    Parser* parser = parser_init(lexer, NULL);
     DomNode* root = parse(parser);
 
     ASSERT(root != NULL, "Root is NULL");
@@ -38,6 +48,8 @@ int test_simple_element() {
     ASSERT(text != NULL, "Text node is NULL");
     ASSERT(text->type == TEXT_NODE, "Child is not TEXT_NODE");
     ASSERT(strcmp(text->text_content, "Hello") == 0, "Text content is not 'Hello'");
+    ASSERT(root->flags & DOM_FLAG_DOCUMENT, "parse() did not return an arena document");
+    ASSERT(text->flags & DOM_FLAG_ARENA, "Parsed node is not arena-owned");
     
     free_dom_tree(root);
     parser_free(parser);
@@ -50,7 +62,7 @@ int test_self_closing() {
     printf("  Running test_self_closing...\n");
     const char* source = "<div><br/><img src=\"test.png\"></div>";
     Lexer* lexer = lexer_init(source);
-    Parser* parser = parser_init(lexer);
+    Parser* parser = parser_init(lexer, NULL);
     DomNode* root = parse(parser);
 
     ASSERT(root != NULL, "Root is NULL");
@@ -84,7 +96,7 @@ int test_mismatched_tag_error() {
     printf("  Running test_mismatched_tag_error...\n");
     const char* source = "<b><i>Hello</b></i>";
     Lexer* lexer = lexer_init(source);
-    Parser* parser = parser_init(lexer);
+    Parser* parser = parser_init(lexer, NULL);
     DomNode* root = parse(parser);
 
     ASSERT(parser->has_error, "Parser did not detect mismatched tag error");
@@ -97,6 +109,864 @@ int test_mismatched_tag_error() {
     return 1;
 }
 
+int test_streaming_feed() {
+    printf("  Running test_streaming_feed...\n");
+    const char* source = "<div>\n  <p class='intro'>Hello <!-- note --></p><br/>\n</div>";
+    Lexer* lexer = lexer_init_stream();
+    Parser* parser = parser_init(lexer, NULL);
+
+    // One byte at a time splits every token, quote and comment.
+    for (size_t i = 0; source[i] != '\0'; i++) {
+        ASSERT(parser_feed(parser, source + i, 1), "parser_feed reported an error");
+    }
+    DomNode* root = parser_finish(parser);
+
+    ASSERT(root != NULL, "Root is NULL");
+    ASSERT(!parser->has_error, parser->error_message ? parser->error_message : "Unknown parse error");
+
+    DomNode* div = root->first_child;
+    ASSERT(div != NULL && strcmp(div->tag_name, "div") == 0, "Tag is not 'div'");
+    DomNode* p = div->first_child;
+    ASSERT(p != NULL && strcmp(p->tag_name, "p") == 0, "Tag is not 'p'");
+    ASSERT(p->parent == div, "<p> parent is not <div>");
+    ASSERT(strcmp(p->attributes->name, "class") == 0, "Attribute is not 'class'");
+    ASSERT(strcmp(p->attributes->value, "intro") == 0, "Value is not 'intro'");
+    ASSERT(strcmp(p->first_child->text_content, "Hello ") == 0, "Text content is not 'Hello '");
+    ASSERT(p->next_sibling != NULL && strcmp(p->next_sibling->tag_name, "br") == 0, "Tag is not 'br'");
+
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    printf("  ...test_streaming_feed: PASS\n");
+    return 1;
+}
+
+// Records the event stream as a compact string, e.g. "<a[href=x]'t'/a>".
+typedef struct {
+    char log[256];
+    int errors;
+} EventLog;
+
+static void log_append(EventLog* log, const char* prefix, const char* text, size_t length) {
+    size_t used = strlen(log->log);
+    snprintf(log->log + used, sizeof(log->log) - used, "%s%.*s", prefix, (int)length, text);
+}
+
+static void log_start(void* user_data, const char* name, size_t length) {
+    log_append((EventLog*)user_data, "<", name, length);
+}
+
+static void log_attribute(void* user_data, const char* name, size_t name_length,
+                          const char* value, size_t value_length) {
+    log_append((EventLog*)user_data, "[", name, name_length);
+    log_append((EventLog*)user_data, "=", value, value_length);
+    log_append((EventLog*)user_data, "]", "", 0);
+}
+
+static void log_text(void* user_data, const char* text, size_t length) {
+    log_append((EventLog*)user_data, "'", text, length);
+    log_append((EventLog*)user_data, "'", "", 0);
+}
+
+static void log_end(void* user_data, const char* name, size_t length) {
+    log_append((EventLog*)user_data, "/", name, length);
+    log_append((EventLog*)user_data, ">", "", 0);
+}
+
+static void log_error(void* user_data, const char* message) {
+    (void)message;
+    ((EventLog*)user_data)->errors++;
+}
+
+int test_event_callbacks() {
+    printf("  Running test_event_callbacks...\n");
+    const ParserEvents events = { log_start, log_attribute, log_text, log_end, log_error };
+
+    EventLog log = { "", 0 };
+    Lexer* lexer = lexer_init("<a href=\"x\" hidden>t<br></a>");
+    Parser* parser = parser_init(lexer, NULL);
+    parser_set_events(parser, &events, &log);
+    DomNode* root = parse(parser);
+
+    ASSERT(root == NULL, "parse() built a DOM despite custom events");
+    ASSERT(!parser->has_error, parser->error_message ? parser->error_message : "Unknown parse error");
+    ASSERT(strcmp(log.log, "<a[href=x][hidden=true]'t'<br/br>/a>") == 0, log.log);
+    ASSERT(log.errors == 0, "on_error fired for valid input");
+    parser_free(parser);
+    lexer_free(lexer);
+
+    EventLog bad = { "", 0 };
+    lexer = lexer_init("<b><i></b>");
+    parser = parser_init(lexer, NULL);
+    parser_set_events(parser, &events, &bad);
+    parse(parser);
+    ASSERT(parser->has_error, "Parser did not detect mismatched tag error");
+    ASSERT(bad.errors == 1, "on_error did not fire exactly once");
+    parser_free(parser);
+    lexer_free(lexer);
+
+    printf("  ...test_event_callbacks: PASS\n");
+    return 1;
+}
+
+int test_deep_nesting() {
+    printf("  Running test_deep_nesting...\n");
+    const int depth = 100000;
+    char* source = (char*)safe_malloc(depth * 11 + 1);
+    char* p = source;
+    for (int i = 0; i < depth; i++) { memcpy(p, "<b>", 3); p += 3; }
+    for (int i = 0; i < depth; i++) { memcpy(p, "</b>", 4); p += 4; }
+    *p = '\0';
+
+    Lexer* lexer = lexer_init(source);
+    Parser* parser = parser_init(lexer, NULL);
+    DomNode* root = parse(parser);
+
+    ASSERT(root != NULL, "Root is NULL");
+    ASSERT(!parser->has_error, parser->error_message ? parser->error_message : "Unknown parse error");
+    int levels = 0;
+    for (DomNode* node = root->first_child; node != NULL; node = node->first_child) {
+        levels++;
+    }
+    ASSERT(levels == depth, "Nesting depth was not preserved");
+
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    free(source);
+    printf("  ...test_deep_nesting: PASS\n");
+    return 1;
+}
+
+
+// One concurrent parse: element count depends on the job's index.
+typedef struct {
+    int index;
+    int children;
+    int ok;
+} ParseJob;
+
+static void run_parse_job(void* arg) {
+    ParseJob* job = (ParseJob*)arg;
+    int count = job->index % 50 + 1;
+    char* source = (char*)safe_malloc(count * 20 + 16);
+    char* p = source;
+    p += sprintf(p, "<ul>");
+    for (int i = 0; i < count; i++) {
+        p += sprintf(p, "<li id=\"%d\">x</li>", i % 10);
+    }
+    sprintf(p, "</ul>");
+
+    Lexer* lexer = lexer_init(source);
+    Parser* parser = parser_init(lexer, NULL);
+    DomNode* root = parse(parser);
+    job->ok = root != NULL && !parser->has_error;
+    job->children = 0;
+    if (job->ok) {
+        for (DomNode* li = root->first_child->first_child; li != NULL; li = li->next_sibling) {
+            job->children++;
+        }
+    }
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    free(source);
+}
+
+int test_concurrent_parses() {
+    printf("  Running test_concurrent_parses...\n");
+    enum { JOBS = 400 };
+    static ParseJob jobs[JOBS];
+
+    ThreadPool* pool = thread_pool_create(4);
+    for (int i = 0; i < JOBS; i++) {
+        jobs[i].index = i;
+        jobs[i].ok = 0;
+        thread_pool_submit(pool, run_parse_job, &jobs[i]);
+    }
+    thread_pool_wait(pool);
+    thread_pool_destroy(pool);
+
+    for (int i = 0; i < JOBS; i++) {
+        ASSERT(jobs[i].ok, "A concurrent parse failed");
+        ASSERT(jobs[i].children == i % 50 + 1, "A concurrent parse produced the wrong tree");
+    }
+    printf("  ...test_concurrent_parses: PASS\n");
+    return 1;
+}
+
+
+int test_parse_cache() {
+    printf("  Running test_parse_cache...\n");
+
+    // Published XXH64 vectors.
+    ASSERT(hash_bytes("", 0, 0) == 0xEF46DB3751D8E999ULL, "Wrong hash of empty input");
+    ASSERT(hash_bytes("abc", 3, 0) == 0x44BC2CF5AD770999ULL, "Wrong hash of 'abc'");
+    const char* long_input = "Nobody inspects the spammish repetition";
+    ASSERT(hash_bytes(long_input, strlen(long_input), 0) == 0xFBCEA83C8A378BF1ULL, "Wrong hash of long input");
+
+    ParseCache* cache = parse_cache_create(1 << 20, NULL);
+    const char* page = "<div><p>same</p></div>";
+    CachedDocument* first = parse_cache_get(cache, page, strlen(page));
+    CachedDocument* second = parse_cache_get(cache, page, strlen(page));
+    ASSERT(first == second, "Identical input was parsed twice");
+    ASSERT(cached_document_error(first) == NULL, "Unexpected parse error");
+    ASSERT(strcmp(cached_document_root(first)->first_child->tag_name, "div") == 0, "Wrong tree");
+
+    const char* broken = "<a></b>";
+    CachedDocument* error = parse_cache_get(cache, broken, strlen(broken));
+    ASSERT(cached_document_error(error) != NULL, "Parse error was not kept");
+    cached_document_release(parse_cache_get(cache, broken, strlen(broken)));
+
+    ParseCacheStats stats = parse_cache_stats(cache);
+    ASSERT(stats.hits == 2 && stats.misses == 2 && stats.entries == 2, "Wrong hit/miss counts");
+    cached_document_release(second);
+    cached_document_release(error);
+    parse_cache_destroy(cache);
+
+    // With room for roughly one document, the least recently used goes
+    // first, and a reference keeps an evicted document usable.
+    cache = parse_cache_create(12 * 1024, NULL);
+    CachedDocument* a = parse_cache_get(cache, "<a>1</a>", 8);
+    cached_document_release(parse_cache_get(cache, "<b>2</b>", 8));
+    stats = parse_cache_stats(cache);
+    ASSERT(stats.evictions == 1 && stats.entries == 1, "Nothing was evicted");
+    ASSERT(strcmp(cached_document_root(a)->first_child->tag_name, "a") == 0, "Evicted document was freed");
+    cached_document_release(parse_cache_get(cache, "<a>1</a>", 8));
+    ASSERT(parse_cache_stats(cache).misses == 3, "Evicted entry was still cached");
+    ASSERT(parse_cache_stats(cache).bytes_used <= 12 * 1024, "Budget exceeded");
+    cached_document_release(a);
+    parse_cache_destroy(cache);
+
+    cached_document_release(first);
+    printf("  ...test_parse_cache: PASS\n");
+    return 1;
+}
+
+// Parses `source` sequentially and on `workers` threads; the JSON dumps
+// (or the error messages) must be identical. `options` may be NULL.
+static int check_parallel(const char* source, size_t length, int workers, const ParserOptions* options) {
+    char* results[2];
+    for (int run = 0; run < 2; run++) {
+        Lexer* lexer = lexer_init_n(source, length);
+        Parser* parser = parser_init(lexer, options);
+        DomNode* root = run ? parse_parallel(parser, workers) : parse(parser);
+        if (parser->has_error) {
+            results[run] = safe_strdup(parser->error_message);
+        } else {
+            results[run] = dom_serialize_to_string(root, SERIALIZE_JSON, NULL);
+        }
+        free_dom_tree(root);
+        parser_free(parser);
+        lexer_free(lexer);
+    }
+    int same = strcmp(results[0], results[1]) == 0;
+    if (!same) {
+        printf("FAIL: parallel parse (%d workers) differs: %.120s\n", workers, results[1]);
+    }
+    free(results[0]);
+    free(results[1]);
+    return same;
+}
+
+int test_parallel_parse() {
+    printf("  Running test_parallel_parse...\n");
+    OutBuffer page;
+    out_init(&page, -1);
+    out_puts(&page, "<html><body>");
+    for (int i = 0; i < 6000; i++) {
+        char item[256];
+        snprintf(item, sizeof(item),
+                 "<section id=\"s%d\" class=\"a b\"><x-item data-k=\"v%d\" title='<p>not a tag</p>'>"
+                 "text %d <b>bold</b><br></x-item><!-- <div> --><custom%d>t</custom%d></section>\n",
+                 i, i, i, i % 7, i % 7);
+        out_puts(&page, item);
+    }
+    size_t body_end = page.length;
+    out_puts(&page, "</body></html>");
+    ASSERT(page.length > 4 * PARALLEL_MIN_SEGMENT, "Test input too small to split");
+
+    int ok = 1;
+    for (int workers = 2; workers <= 16; workers *= 2) {
+        ok &= check_parallel(page.data, page.length, workers, NULL);
+    }
+    // Missing close tags, and a mismatch late in the document.
+    ok &= check_parallel(page.data, body_end, 4, NULL);
+    memcpy(page.data + body_end - 300, "</i>", 4);
+    ok &= check_parallel(page.data, page.length, 4, NULL);
+    out_free(&page);
+
+    // Inputs where every cut lands inside a comment or a quoted value,
+    // and one whose document ends at a stray close tag.
+    const char* wrappers[][2] = {
+        { "<div><!--", "--></div>" },
+        { "<div title=\"", "\">x</div>" },
+        { "<a></a></b>", "" },
+    };
+    for (int w = 0; w < 3; w++) {
+        out_init(&page, -1);
+        out_puts(&page, wrappers[w][0]);
+        for (int i = 0; i < 40000; i++) {
+            out_puts(&page, "<p>x</p>");
+        }
+        out_puts(&page, wrappers[w][1]);
+        ok &= check_parallel(page.data, page.length, 4, NULL);
+        out_free(&page);
+    }
+    ASSERT(ok, "Parallel parse did not match the sequential parse");
+    printf("  ...test_parallel_parse: PASS\n");
+    return 1;
+}
+
+// Text of the `index`-th text node in document order, or NULL.
+static const char* nth_text(DomNode* node, int* index) {
+    for (; node != NULL; node = node->next_sibling) {
+        if (node->type == TEXT_NODE && (*index)-- == 0) {
+            return node->text_content;
+        }
+        const char* text = nth_text(node->first_child, index);
+        if (text != NULL) {
+            return text;
+        }
+    }
+    return NULL;
+}
+
+int test_whitespace() {
+    printf("  Running test_whitespace...\n");
+    const char* source =
+        "<div>\n  <p>Hello \t big\n  world  </p>\n"
+        "  <pre>a  \n   b  </pre><textarea>x\n  y  </textarea>\n"
+        "  <p>one <b> two </b>three</p>\n</div>";
+    const char* expected[3][6] = {
+        { "Hello \t big\n  world  ", "a  \n   b  ", "x\n  y  ", "one ", "two ", "three" },
+        { "Hello \t big\n  world", "a  \n   b  ", "x\n  y  ", "one", "two", "three" },
+        { "Hello big world", "a  \n   b  ", "x\n  y  ", "one", "two", "three" },
+    };
+    for (int mode = WHITESPACE_KEEP; mode <= WHITESPACE_COLLAPSE; mode++) {
+        Lexer* lexer = lexer_init(source);
+        ParserOptions options = { 0 };
+        options.whitespace = (WhitespaceMode)mode;
+        Parser* parser = parser_init(lexer, &options);
+        DomNode* root = parse(parser);
+        ASSERT(!parser->has_error, "Parse failed");
+        for (int i = 0; i < 6; i++) {
+            int index = i;
+            const char* text = nth_text(root, &index);
+            if (text == NULL || strcmp(text, expected[mode][i]) != 0) {
+                printf("FAIL: mode %d, text %d is '%s'\n", mode, i, text ? text : "(none)");
+                return 0;
+            }
+        }
+        free_dom_tree(root);
+        parser_free(parser);
+        lexer_free(lexer);
+    }
+
+    // Heap trees: text that is only whitespace goes away.
+    DomNode* div = create_element_node("div");
+    add_child(div, create_text_node(" \n "));
+    DomNode* pre = create_element_node("pre");
+    add_child(pre, create_text_node("  "));
+    add_child(div, pre);
+    add_child(div, create_text_node("  a  b "));
+    add_child(div, create_text_node("\t"));
+    dom_normalize_whitespace(div, WHITESPACE_COLLAPSE);
+    ASSERT(div->child_count == 2 && div->first_child == pre, "Whitespace-only text was kept");
+    ASSERT(strcmp(pre->first_child->text_content, "  ") == 0, "<pre> text was changed");
+    ASSERT(div->last_child == pre->next_sibling && div->last_child->next_sibling == NULL, "Broken child list");
+    ASSERT(strcmp(div->last_child->text_content, "a b") == 0, "Text was not collapsed");
+    free_dom_tree(div);
+
+    // The parallel parse applies the mode after joining, so segments that
+    // start inside a <pre> still leave it alone.
+    OutBuffer page;
+    out_init(&page, -1);
+    out_puts(&page, "<html><body>");
+    for (int i = 0; i < 8000; i++) {
+        out_puts(&page, i % 3 ? "<p> some   text\n </p>\n" : "<pre>\n  kept   as is  \n<b> x </b>  </pre>\n");
+    }
+    out_puts(&page, "</body></html>");
+    ParserOptions options = { 0 };
+    options.whitespace = WHITESPACE_COLLAPSE;
+    ASSERT(check_parallel(page.data, page.length, 4, &options), "Parallel parse did not match");
+    out_free(&page);
+
+    printf("  ...test_whitespace: PASS\n");
+    return 1;
+}
+
+int test_parse_stats() {
+    printf("  Running test_parse_stats...\n");
+    const char* source = "<div id=\"a\"><p class=\"x\" hidden>one<br></p><ul><li><b>two</b></li></ul></div>";
+    Lexer* lexer = lexer_init(source);
+    Parser* parser = parser_init(lexer, NULL);
+    DomNode* root = parse(parser);
+    ASSERT(!parser->has_error, "Parse failed");
+    const ParseStats* stats = &parser->stats;
+    ASSERT(stats->tokens[TOKEN_OPEN_TAG] == 6 && stats->tokens[TOKEN_CLOSE_TAG] == 5, "Wrong tag token counts");
+    ASSERT(stats->tokens[TOKEN_ATTR_NAME] == 3 && stats->tokens[TOKEN_ATTR_VALUE] == 2, "Wrong attribute token counts");
+    ASSERT(stats->tokens[TOKEN_TEXT] == 2 && stats->tokens[TOKEN_EOF] == 1, "Wrong text/EOF counts");
+    ASSERT(stats->elements == 6 && stats->text_nodes == 2 && stats->attributes == 3, "Wrong node counts");
+    ASSERT(stats->max_depth == 4, "Wrong maximum depth");
+    ASSERT(stats->bytes_lexed == strlen(source), "Wrong byte count");
+    ASSERT(stats->allocations > 0 && stats->allocated_bytes > 0, "Allocations were not counted");
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+
+    // A parallel parse reports the same counts as a sequential one.
+    OutBuffer page;
+    out_init(&page, -1);
+    out_puts(&page, "<html><body>");
+    for (int i = 0; i < 5000; i++) {
+        out_puts(&page, i % 50 == 0 ? "<div><section><p a=\"1\">deep <i>x</i></p></section></div>\n"
+                                    : "<p class=\"c\">text <b>b</b><br></p>\n");
+    }
+    out_puts(&page, "</body></html>");
+    ParseStats results[2];
+    for (int run = 0; run < 2; run++) {
+        lexer = lexer_init_n(page.data, page.length);
+        parser = parser_init(lexer, NULL);
+        root = run ? parse_parallel(parser, 4) : parse(parser);
+        ASSERT(!parser->has_error, "Parse failed");
+        results[run] = parser->stats;
+        free_dom_tree(root);
+        parser_free(parser);
+        lexer_free(lexer);
+    }
+    out_free(&page);
+    ASSERT(memcmp(results[0].tokens, results[1].tokens, sizeof(results[0].tokens)) == 0, "Token counts differ");
+    ASSERT(results[0].elements == results[1].elements && results[0].attributes == results[1].attributes &&
+           results[0].text_nodes == results[1].text_nodes, "Node counts differ");
+    ASSERT(results[0].max_depth == 6 && results[1].max_depth == 6, "Wrong maximum depth");
+    ASSERT(results[0].bytes_lexed == results[1].bytes_lexed, "Byte counts differ");
+
+    // Every cut lands inside the comment, so the parallel attempt is
+    // thrown away; its time counts once, next to the sequential parse.
+    out_init(&page, -1);
+    out_puts(&page, "<div><!--");
+    for (int i = 0; i < 40000; i++) {
+        out_puts(&page, "<p>x</p>");
+    }
+    out_puts(&page, "--></div>");
+    lexer = lexer_init_n(page.data, page.length);
+    parser = parser_init(lexer, NULL);
+    double start = stats_now_ms();
+    root = parse_parallel(parser, 4);
+    double elapsed = stats_now_ms() - start;
+    ASSERT(!parser->has_error, "Parse failed");
+    ASSERT(parser->stats.phase_ms[STATS_PHASE_PARSE] > 0 &&
+           parser->stats.phase_ms[STATS_PHASE_PARSE] <= elapsed, "Fallback parse time was counted twice");
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    out_free(&page);
+
+    printf("  ...test_parse_stats: PASS\n");
+    return 1;
+}
+
+// Parses `source` with `options`; the error message must contain
+// `expected`, or there must be no error if `expected` is NULL.
+static int check_limit(const char* source, const ParserOptions* options, const char* expected) {
+    Lexer* lexer = lexer_init(source);
+    Parser* parser = parser_init(lexer, options);
+    DomNode* root = parse(parser);
+    int ok = expected ? parser->has_error && strstr(parser->error_message, expected) != NULL
+                      : !parser->has_error;
+    if (!ok) {
+        printf("FAIL: '%s' gave '%s'\n", source, parser->has_error ? parser->error_message : "no error");
+    }
+    free_dom_tree(root);
+    parser_free(parser);
+    lexer_free(lexer);
+    return ok;
+}
+
+int test_limits() {
+    printf("  Running test_limits...\n");
+    const char* source = "<div a=\"1\" b><p>x</p><p>y<i>z</i></p></div>";
+    ParserOptions options = { 0 };
+    int ok = check_limit(source, &options, NULL);
+
+    options.max_depth = 3;
+    ok &= check_limit(source, &options, NULL);
+    options.max_depth = 2;
+    ok &= check_limit(source, &options, "Nesting depth exceeds the limit of 2");
+    options.max_depth = 0;
+
+    options.max_nodes = 7;
+    ok &= check_limit(source, &options, NULL);
+    options.max_nodes = 6;
+    ok &= check_limit(source, &options, "Node count exceeds the limit of 6");
+    options.max_nodes = 0;
+
+    options.max_attributes = 2;
+    ok &= check_limit(source, &options, NULL);
+    options.max_attributes = 1;
+    ok &= check_limit(source, &options, "Attribute count exceeds the limit of 1");
+    options.max_attributes = 0;
+
+    options.max_input_bytes = strlen(source);
+    ok &= check_limit(source, &options, NULL);
+    options.max_input_bytes = 20;
+    ok &= check_limit(source, &options, "[Line 1, Col 21] Error: Input size in bytes exceeds the limit of 20");
+    options.max_input_bytes = 0;
+
+    options.max_dom_bytes = 1024 * 1024;
+    ok &= check_limit(source, &options, NULL);
+    options.max_dom_bytes = 1024;
+    ok &= check_limit(source, &options, "DOM size in bytes exceeds the limit of 1024");
+    options.max_dom_bytes = 0;
+    ASSERT(ok, "Limits were not applied as expected");
+
+    // Streaming input is held to the same limit as it arrives.
+    options.max_input_bytes = 64;
+    Lexer* lexer = lexer_init_stream();
+    Parser* parser = parser_init(lexer, &options);
+    int fed = 0;
+    while (fed < 100 && parser_feed(parser, "<p>chunk</p>", 12)) {
+        fed++;
+    }
+    ASSERT(fed == 5 && parser->has_error, "Streaming input was not limited");
+    free_dom_tree(parser_finish(parser));
+    parser_free(parser);
+    lexer_free(lexer);
+
+    // Also while no token is complete: the buffer stays within the limit.
+    options.max_input_bytes = 4096;
+    lexer = lexer_init_stream();
+    parser = parser_init(lexer, &options);
+    char chunk[1024];
+    memset(chunk, '-', sizeof(chunk));
+    ASSERT(parser_feed(parser, "<!--", 4), "Comment start was refused");
+    fed = 0;
+    while (fed < 100 && parser_feed(parser, chunk, sizeof(chunk))) {
+        fed++;
+    }
+    ASSERT(fed == 3 && lexer->base_offset + lexer->length <= 4096, "Unterminated comment was not limited");
+    ASSERT(strstr(parser->error_message, "Input size in bytes exceeds the limit of 4096") != NULL,
+           "Unterminated comment was not reported");
+    parser_free(parser);
+    lexer_free(lexer);
+    options.max_input_bytes = 0;
+
+    // Without a limit of its own, a stream still ends where the lexer's
+    // offsets would overflow; the oversized chunk is refused unread.
+    lexer = lexer_init_stream();
+    parser = parser_init(lexer, NULL);
+    ASSERT(parser_feed(parser, "<p", 2) && !parser_feed(parser, "", INPUT_MAX_BYTES - 1), "Oversized chunk was taken");
+    ASSERT(strstr(parser->error_message, "Input size in bytes exceeds the limit of 2147483647") != NULL,
+           "Oversized chunk was not reported");
+    parser_free(parser);
+    lexer_free(lexer);
+
+    // Piped input (stdin) stops being read at the limit.
+    ok = 1;
+    int saved_stdin = dup(STDIN_FILENO);
+    for (int run = 0; run < 2; run++) {
+        int fds[2];
+        ASSERT(pipe(fds) == 0, "Could not create a pipe");
+        char chunk[1000];
+        memset(chunk, 'x', sizeof(chunk));
+        for (int i = 0; i < 40; i++) {
+            ok &= write(fds[1], chunk, sizeof(chunk)) == (ssize_t)sizeof(chunk);
+        }
+        close(fds[1]);
+        dup2(fds[0], STDIN_FILENO);
+        close(fds[0]);
+        FileBuffer input;
+        if (run == 0) {
+            ok &= map_file("-", &input, 16 * 1024) == -1 && input.data == NULL;
+        } else {
+            ok &= map_file("-", &input, 64 * 1024) == 0 && input.length == 40000;
+            unmap_file(&input);
+        }
+    }
+    dup2(saved_stdin, STDIN_FILENO);
+    close(saved_stdin);
+    ASSERT(ok, "Piped input was not limited");
+
+    // A parallel parse that goes over a limit reports what parse() does,
+    // even where no single segment goes over it.
+    OutBuffer page;
+    out_init(&page, -1);
+    out_puts(&page, "<html><body>");
+    for (int i = 0; i < 8000; i++) {
+        out_puts(&page, i == 7000 ? "<div><p><b><i>deep</i></b></p></div>" : "<p class=\"c\">text</p>\n");
+    }
+    out_puts(&page, "</body></html>");
+    options.max_depth = 5;
+    ok &= check_parallel(page.data, page.length, 4, &options);
+    options.max_depth = 0;
+    options.max_nodes = 15000;
+    ok &= check_parallel(page.data, page.length, 4, &options);
+    options.max_nodes = 0;
+    options.max_dom_bytes = 256 * 1024;
+    ok &= check_parallel(page.data, page.length, 4, &options);
+    out_free(&page);
+    ASSERT(ok, "Parallel parse did not report the limit like parse()");
+
+    printf("  ...test_limits: PASS\n");
+    return 1;
+}
+
+// Parses `source` with and without the lexer thread; the JSON dumps (or
+// the error messages), token counts and bytes lexed must be identical.
+static int check_lex_ahead(const char* source, size_t length) {
+    char* results[2];
+    ParseStats stats[2];
+    ParserOptions options = { 0 };
+    for (int run = 0; run < 2; run++) {
+        options.pipeline = run;
+        Lexer* lexer = lexer_init_n(source, length);
+        Parser* parser = parser_init(lexer, &options);
+        DomNode* root = parse(parser);
+        if (parser->has_error) {
+            results[run] = safe_strdup(parser->error_message);
+        } else {
+            results[run] = dom_serialize_to_string(root, SERIALIZE_JSON, NULL);
+        }
+        stats[run] = parser->stats;
+        free_dom_tree(root);
+        parser_free(parser);
+        lexer_free(lexer);
+    }
+    int same = strcmp(results[0], results[1]) == 0 &&
+               memcmp(stats[0].tokens, stats[1].tokens, sizeof(stats[0].tokens)) == 0 &&
+               stats[0].bytes_lexed == stats[1].bytes_lexed;
+    if (!same) {
+        printf("FAIL: lex-ahead parse differs: %.120s\n", results[1]);
+    }
+    free(results[0]);
+    free(results[1]);
+    return same;
+}
+
+int test_lex_ahead() {
+    printf("  Running test_lex_ahead...\n");
+    OutBuffer page;
+    out_init(&page, -1);
+    out_puts(&page, "<html><body>");
+    for (int i = 0; i < 4000; i++) {
+        char item[160];
+        snprintf(item, sizeof(item),
+                 "<div id=\"d%d\" class=\"a b\"><p title='x > y'>text %d &amp; more<br></p><!-- c --></div>\n", i, i);
+        out_puts(&page, item);
+    }
+    size_t body_end = page.length;
+    out_puts(&page, "</body></html>");
+    ASSERT(page.length > 4 * TOKEN_PIPELINE_MIN_INPUT, "Test input too small for the lexer thread");
+
+    int ok = check_lex_ahead(page.data, page.length);
+    // Missing close tags, a mismatch late in the document and a lexer
+    // error (unterminated comment).
+    ok &= check_lex_ahead(page.data, body_end);
+    memcpy(page.data + body_end - 40, "</i>", 4);
+    ok &= check_lex_ahead(page.data, page.length);
+    memcpy(page.data + body_end - 40, "<!--", 4);
+    ok &= check_lex_ahead(page.data, page.length);
+    // The document ends early at a stray close tag, with most of the
+    // input still to be lexed.
+    memcpy(page.data + 12, "</b>", 4);
+    ok &= check_lex_ahead(page.data, page.length);
+    out_free(&page);
+    ASSERT(ok, "Lex-ahead parse did not match the sequential parse");
+    printf("  ...test_lex_ahead: PASS\n");
+    return 1;
+}
+
+// Applies `replacement` in place of the first `find` in `*source` to
+// `*root`, checks the tree against a full parse of the new input and
+// moves both over to it. Returns the mode used, or -1 on a mismatch.
+static int check_reparse(DomNode** root, char** source, const char* find, const char* replacement) {
+    SourceEdit edit;
+    edit.offset = (size_t)(strstr(*source, find) - *source);
+    edit.removed = strlen(find);
+    edit.inserted = replacement;
+    edit.inserted_length = strlen(replacement);
+    ReparseResult result = reparse_edit(*root, *source, strlen(*source), &edit, NULL);
+
+    Lexer* lexer = lexer_init(result.source);
+    Parser* parser = parser_init(lexer, NULL);
+    DomNode* expected = parse(parser);
+    char* got = result.root ? dom_serialize_to_string(result.root, SERIALIZE_JSON, NULL)
+                            : safe_strdup(result.error_message);
+    char* want = expected ? dom_serialize_to_string(expected, SERIALIZE_JSON, NULL)
+                          : safe_strdup(parser->error_message);
+    int same = strcmp(got, want) == 0;
+    if (!same) {
+        printf("FAIL: reparse of '%s' gave %.120s\n", result.source, got);
+    }
+    free(got);
+    free(want);
+    free_dom_tree(expected);
+    parser_free(parser);
+    lexer_free(lexer);
+
+    free(*source);
+    *source = result.source;
+    *root = result.root;
+    free(result.error_message);
+    return same ? (int)result.mode : -1;
+}
+
+int test_reparse() {
+    printf("  Running test_reparse...\n");
+    char* source = safe_strdup("<div id=\"a\"><p>Hello <b>world</b></p><ul><li>1</li><li>2</li></ul></div>\n<p>tail</p>");
+    Lexer* lexer = lexer_init(source);
+    Parser* parser = parser_init(lexer, NULL);
+    DomNode* root = parse(parser);
+    parser_free(parser);
+    lexer_free(lexer);
+
+    // Source ranges: an element from '<' to its last '>', text as written.
+    DomNode* div = root->first_child;
+    DomNode* b = div->first_child->first_child->next_sibling;
+    ASSERT(div->source_start == 0 && div->source_end == 72, "Wrong element range");
+    ASSERT(b->source_start == 21 && b->source_end == 33, "Wrong inline element range");
+    ASSERT(b->first_child->source_start == 24 && b->first_child->source_end == 29, "Wrong text range");
+
+    ASSERT(check_reparse(&root, &source, "world", "there") == REPARSE_SUBTREE, "Text edit was not local");
+    ASSERT(check_reparse(&root, &source, "<li>2", "<li id=\"x\">22") == REPARSE_SUBTREE, "Tag edit was not local");
+    ASSERT(check_reparse(&root, &source, "</li></ul>", "</li><li>3<br></li></ul>") == REPARSE_SUBTREE,
+           "Inserted element was not local");
+    ASSERT(check_reparse(&root, &source, "tail", "end") == REPARSE_SUBTREE, "Later edit was not local");
+    ASSERT(strcmp(dom_text(root->first_child->next_sibling->first_child), "end") == 0, "Ranges were not shifted");
+    // Edits that reach past the enclosing element, or sit outside all of
+    // them, parse everything again.
+    ASSERT(check_reparse(&root, &source, "there", "there</p><p>") == REPARSE_FULL, "Split element was local");
+    ASSERT(check_reparse(&root, &source, "</div>\n", "</div>x") == REPARSE_FULL, "Top-level edit was local");
+    ASSERT(check_reparse(&root, &source, "<b>", "<b><i>") == REPARSE_FULL, "Broken input was local");
+    ASSERT(root == NULL, "Broken input produced a tree");
+    free(source);
+
+    // An index is kept up to date edit by edit.
+    source = safe_strdup("<ul id=\"u\"><li id=\"a\" class=\"x\">1</li><li id=\"b\">2</li></ul><p id=\"p\" class=\"x\">t</p>");
+    lexer = lexer_init(source);
+    ParserOptions options = { 0 };
+    options.build_index = 1;
+    parser = parser_init(lexer, &options);
+    root = parse(parser);
+    parser_free(parser);
+    lexer_free(lexer);
+    ASSERT(check_reparse(&root, &source, "<li id=\"b\">2</li>", "<li id=\"b\" class=\"x\">2</li><li id=\"c\">3</li>") == REPARSE_SUBTREE,
+           "Indexed edit was not local");
+    ASSERT(((DomDocument*)root)->index != NULL, "Edit dropped the index");
+    Selector* selector = selector_compile(".x");
+    DomNodeList list = dom_query_selector_all(root, selector);
+    ASSERT(list.count == 3 && strcmp(dom_get_attribute(list.nodes[1], "id"), "b") == 0
+           && strcmp(dom_get_attribute(list.nodes[2], "id"), "p") == 0, "Index missed the edit");
+    dom_node_list_free(&list);
+    selector_free(selector);
+    selector = selector_compile("#c");
+    ASSERT(dom_query_selector(root, selector) == root->first_child->last_child, "Index missed a new element");
+    selector_free(selector);
+
+    // Replaced elements pile up in the arena until a full parse drops them.
+    size_t dead = 0;
+    int edits = 0;
+    int mode;
+    while ((mode = check_reparse(&root, &source, "<li id=\"a\"", "<li id=\"a\"")) == REPARSE_SUBTREE) {
+        ASSERT(((DomDocument*)root)->dead_bytes > dead, "Dead bytes were not counted");
+        dead = ((DomDocument*)root)->dead_bytes;
+        ASSERT(++edits < 100000, "Edits never compacted the arena");
+    }
+    ASSERT(mode == REPARSE_FULL && ((DomDocument*)root)->dead_bytes == 0, "Full parse kept dead bytes");
+    free_dom_tree(root);
+    free(source);
+
+    printf("  ...test_reparse: PASS\n");
+    return 1;
+}
+
+// Runs `text` against both documents and checks the ids of the matches.
+static int check_query(DomNode* plain, DomNode* indexed, const char* text, const char* expected) {
+    Selector* selector = selector_compile(text);
+    if (selector == NULL) {
+        printf("FAIL: selector '%s' did not compile\n", text);
+        return 0;
+    }
+    int ok = 1;
+    DomNode* roots[2] = { plain, indexed };
+    for (int r = 0; r < 2; r++) {
+        char ids[256] = "";
+        DomNodeList list = dom_query_selector_all(roots[r], selector);
+        for (int i = 0; i < list.count; i++) {
+            const char* id = "?";
+            for (Attribute* a = list.nodes[i]->attributes; a != NULL; a = a->next) {
+                if (strcmp(a->name, "id") == 0) id = a->value;
+            }
+            strcat(ids, i ? " " : "");
+            strcat(ids, id);
+        }
+        DomNode* first = dom_query_selector(roots[r], selector);
+        if (strcmp(ids, expected) != 0 || first != (list.count ? list.nodes[0] : NULL)) {
+            printf("FAIL: '%s' matched [%s], expected [%s] (%s)\n", text, ids, expected, r ? "indexed" : "walk");
+            ok = 0;
+        }
+        dom_node_list_free(&list);
+    }
+    selector_free(selector);
+    return ok;
+}
+
+int test_selectors() {
+    printf("  Running test_selectors...\n");
+    const char* source =
+        "<div id=\"a\" class=\"box main\">"
+          "<p id=\"b\" class=\"note\">x</p>"
+          "<section id=\"c\"><p id=\"d\" class=\"note wide\" lang=\"en\">y</p></section>"
+        "</div>"
+        "<p id=\"e\" class=\"main\" lang=\"fr\"><a id=\"f\" href=\"/x\">z</a></p>";
+
+    DomNode* roots[2];
+    for (int i = 0; i < 2; i++) {
+        Lexer* lexer = lexer_init(source);
+        ParserOptions options = { 0 };
+        options.build_index = i;
+        Parser* parser = parser_init(lexer, &options);
+        roots[i] = parse(parser);
+        ASSERT(!parser->has_error, "Parse failed");
+        parser_free(parser);
+        lexer_free(lexer);
+    }
+    ASSERT(((DomDocument*)roots[1])->index != NULL, "Index was not built");
+
+    int ok = 1;
+    ok &= check_query(roots[0], roots[1], "p", "b d e");
+    ok &= check_query(roots[0], roots[1], "#d", "d");
+    ok &= check_query(roots[0], roots[1], ".note", "b d");
+    ok &= check_query(roots[0], roots[1], ".main", "a e");
+    ok &= check_query(roots[0], roots[1], "p.note.wide", "d");
+    ok &= check_query(roots[0], roots[1], "div p", "b d");
+    ok &= check_query(roots[0], roots[1], "div > p", "b");
+    ok &= check_query(roots[0], roots[1], "div>section >p", "d");
+    ok &= check_query(roots[0], roots[1], "[lang]", "d e");
+    ok &= check_query(roots[0], roots[1], "p[lang=\"fr\"] a[href='/x']", "f");
+    ok &= check_query(roots[0], roots[1], "* > a", "f");
+    ok &= check_query(roots[0], roots[1], "#missing", "");
+    ok &= check_query(roots[0], roots[1], "section p.note", "d");
+    ASSERT(ok, "Selector query returned the wrong elements");
+
+    // Queries below an element only see its descendants.
+    Selector* notes = selector_compile(".note");
+    DomNode* section = roots[1]->first_child->first_child->next_sibling;
+    DomNodeList below = dom_query_selector_all(section, notes);
+    ASSERT(below.count == 1, "Query escaped its root");
+    dom_node_list_free(&below);
+    selector_free(notes);
+
+    ASSERT(selector_compile("div >") == NULL, "Dangling combinator accepted");
+    ASSERT(selector_compile("[x=") == NULL, "Unterminated attribute accepted");
+    ASSERT(selector_compile("") == NULL, "Empty selector accepted");
+
+    free_dom_tree(roots[0]);
+    free_dom_tree(roots[1]);
+    printf("  ...test_selectors: PASS\n");
+    return 1;
+}
 
 // Public test function
 int run_parser_tests() {
@@ -106,6 +976,18 @@ int run_parser_tests() {
     if (!test_simple_element()) success = 0;
     if (!test_self_closing()) success = 0;
     if (!test_mismatched_tag_error()) success = 0;
+    if (!test_streaming_feed()) success = 0;
+    if (!test_event_callbacks()) success = 0;
+    if (!test_deep_nesting()) success = 0;
+    if (!test_concurrent_parses()) success = 0;
+    if (!test_parse_cache()) success = 0;
+    if (!test_parallel_parse()) success = 0;
+    if (!test_whitespace()) success = 0;
+    if (!test_parse_stats()) success = 0;
+    if (!test_limits()) success = 0;
+    if (!test_lex_ahead()) success = 0;
+    if (!test_reparse()) success = 0;
+    if (!test_selectors()) success = 0;
 
     if(success) {
         printf("Parser Tests: PASS\n");
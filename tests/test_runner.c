@@ -11,18 +11,21 @@
 // Include declarations for the test functions
 int run_lexer_tests();
 int run_parser_tests();
+int run_dom_tests();
 
 int main() {
     printf("========= HTML PARSER TEST SUITE =========\n\n");
     
     int lexer_success = run_lexer_tests();
     int parser_success = run_parser_tests();
+    int dom_success = run_dom_tests();
     
     printf("\n================= SUMMARY ==================\n");
     printf("Lexer Tests:  %s\n", lexer_success  ? "PASS" : "FAIL");
     printf("Parser Tests: %s\n", parser_success ? "PASS" : "FAIL");
+    printf("DOM Tests:    %s\n", dom_success    ? "PASS" : "FAIL");
     printf("==========================================\n");
     
     // Return 0 if all tests passed, 1 otherwise
-    return (lexer_success && parser_success) ? 0 : 1;
+    return (lexer_success && parser_success && dom_success) ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Generates src/atom_ids.h and src/atom_table.h.
+
+The static atoms are the known HTML tag and attribute names below. Lookup
+uses a two-level perfect hash: FNV-1a picks a bucket, and each bucket has
+a seed that sends its names to distinct slots. The seeds are searched
+here, so lookup at runtime is one pass over the name plus one compare.
+
+Run from the repository root:  python3 tools/gen_atoms.py
+"""
+
+TAGS = """
+a abbr acronym address applet area article aside audio b base basefont bdi
+bdo big blockquote body br button canvas caption center cite code col
+colgroup data datalist dd del details dfn dialog dir div dl dt em embed
+fieldset figcaption figure font footer form frame frameset h1 h2 h3 h4 h5
+h6 head header hgroup hr html i iframe img input ins kbd label legend li
+link main map mark marquee math menu meta meter nav nobr noframes noscript
+object ol optgroup option output p param picture pre progress q rp rt ruby
+s samp script search section select slot small source span strike strong
+style sub summary sup svg table tbody td template textarea tfoot th thead
+time title tr track tt u ul var video wbr
+""".split()
+
+ATTRIBUTES = """
+accept accept-charset accesskey action align alt async autocapitalize
+autocomplete autofocus autoplay background bgcolor border charset checked
+cite class color cols colspan content contenteditable controls coords
+crossorigin data datetime decoding default defer dir dirname disabled
+download draggable enctype enterkeyhint for form formaction formenctype
+formmethod formnovalidate formtarget headers height hidden high href
+hreflang http-equiv id inert inputmode integrity is itemid itemprop itemref
+itemscope itemtype kind label lang list loading loop low max maxlength
+media method min minlength multiple muted name nonce novalidate open
+optimum pattern ping placeholder playsinline popover poster preload
+readonly referrerpolicy rel required reversed role rows rowspan sandbox
+scope selected shape size sizes slot span spellcheck src srcdoc srclang
+srcset start step style tabindex target title translate type usemap value
+width wrap xmlns onblur onchange onclick onerror onfocus oninput onkeydown
+onkeyup onload onmouseout onmouseover onsubmit aria-controls aria-current
+aria-describedby aria-expanded aria-hidden aria-label aria-labelledby
+aria-live
+""".split()
+
+VOID = set("area base br col embed hr img input link meta param source track wbr".split())
+
+MASK64 = (1 << 64) - 1
+
+
+def fnv1a(name):
+    h = 0xcbf29ce484222325
+    for c in name.encode():
+        h ^= c
+        h = (h * 0x100000001b3) & MASK64
+    return h
+
+
+def mix(h, seed):
+    x = h ^ ((seed * 0x9E3779B97F4A7C15) & MASK64)
+    x ^= x >> 33
+    x = (x * 0xff51afd7ed558ccd) & MASK64
+    x ^= x >> 33
+    return x & 0xffffffff
+
+
+def build(names, bucket_count, slot_count):
+    buckets = [[] for _ in range(bucket_count)]
+    for atom, name in enumerate(names, start=1):
+        buckets[(fnv1a(name) >> 32) & (bucket_count - 1)].append((atom, name))
+    seeds = [0] * bucket_count
+    slots = [0] * slot_count
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 65536):
+            wanted = [mix(fnv1a(n), seed) & (slot_count - 1) for _, n in buckets[b]]
+            if len(set(wanted)) == len(wanted) and all(slots[w] == 0 for w in wanted):
+                for (atom, _), w in zip(buckets[b], wanted):
+                    slots[w] = atom
+                seeds[b] = seed
+                break
+        else:
+            raise SystemExit("no seed found for bucket %d" % b)
+    return seeds, slots
+
+
+def c_array(values, per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    names = sorted(set(TAGS) | set(ATTRIBUTES))
+    bucket_count, slot_count = 128, 512
+    seeds, slots = build(names, bucket_count, slot_count)
+
+    ids = ["// Generated by tools/gen_atoms.py. Do not edit.",
+           "#ifndef ATOM_IDS_H", "#define ATOM_IDS_H", "",
+           "enum {", "    ATOM_NONE = 0,"]
+    for atom, name in enumerate(names, start=1):
+        ids.append("    ATOM_%s = %d," % (name.upper().replace("-", "_"), atom))
+    ids += ["    ATOM_STATIC_COUNT = %d" % (len(names) + 1), "};", "", "#endif", ""]
+
+    flags = [0] + [(1 if n in VOID else 0) | (2 if n in TAGS else 0) | (4 if n in ATTRIBUTES else 0)
+                   for n in names]
+    table = ["// Generated by tools/gen_atoms.py. Do not edit.",
+             "#define ATOM_HASH_BUCKETS %d" % bucket_count,
+             "#define ATOM_HASH_SLOTS %d" % slot_count, "",
+             "static const char* const atom_static_names[ATOM_STATIC_COUNT] = {",
+             "    NULL,"]
+    table += ['    "%s",' % n for n in names]
+    table += ["};", "",
+              "static const unsigned char atom_static_lengths[ATOM_STATIC_COUNT] = {",
+              c_array([0] + [len(n) for n in names]), "};", "",
+              "static const unsigned char atom_static_flags[ATOM_STATIC_COUNT] = {",
+              c_array(flags), "};", "",
+              "static const unsigned short atom_hash_seeds[ATOM_HASH_BUCKETS] = {",
+              c_array(seeds), "};", "",
+              "static const unsigned short atom_hash_slots[ATOM_HASH_SLOTS] = {",
+              c_array(slots), "};", ""]
+
+    with open("src/atom_ids.h", "w", newline="\r\n") as f:
+        f.write("\n".join(ids))
+    with open("src/atom_table.h", "w", newline="\r\n") as f:
+        f.write("\n".join(table))
+
+
+if __name__ == "__main__":
+    main()
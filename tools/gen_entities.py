@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Generates src/entity_table.h, the HTML named character references.
+
+The names and expansions are the HTML5 list shipped with Python
+(html.entities.html5): 2231 names, of which 106 legacy ones also match
+without a trailing ';'. Both spellings are separate entries. Lookup uses
+the same two-level perfect hash as the atom table (see gen_atoms.py).
+
+Run from the repository root:  python3 tools/gen_entities.py
+"""
+
+from html.entities import html5
+
+from gen_atoms import build, c_array
+
+
+def c_string(data):
+    # Octal escapes never swallow the next character the way \x does.
+    return '"' + "".join("\\%03o" % b if b < 0x20 or b >= 0x7f or b in b'"\\?' else chr(b)
+                         for b in data) + '"'
+
+
+def main():
+    names = sorted(html5)
+    values = [html5[n].encode("utf-8") for n in names]
+    for name, value in zip(names, values):
+        # ENTITY_DECODED_BOUND allows one extra byte per 4 bytes of
+        # reference ("&nGt;" is the worst case).
+        assert len(value) - (len(name) + 1) <= (len(name) + 1) // 4, name
+    bucket_count, slot_count = 1024, 4096
+    seeds, slots = build(names, bucket_count, slot_count)
+
+    table = ["// Generated by tools/gen_entities.py. Do not edit.",
+             "#define ENTITY_COUNT %d" % (len(names) + 1),
+             "#define ENTITY_MAX_NAME %d" % max(len(n) for n in names),
+             "#define ENTITY_MAX_LEGACY_NAME %d" % max(len(n) for n in names if not n.endswith(";")),
+             "#define ENTITY_HASH_BUCKETS %d" % bucket_count,
+             "#define ENTITY_HASH_SLOTS %d" % slot_count, "",
+             "// Names include the ';' where one is required.",
+             "static const char* const entity_names[ENTITY_COUNT] = {",
+             "    NULL,"]
+    table += ['    "%s",' % n for n in names]
+    table += ["};", "",
+              "static const unsigned char entity_name_lengths[ENTITY_COUNT] = {",
+              c_array([0] + [len(n) for n in names]), "};", "",
+              "// UTF-8 expansions.",
+              "static const char* const entity_values[ENTITY_COUNT] = {",
+              "    NULL,"]
+    table += ["    %s," % c_string(v) for v in values]
+    table += ["};", "",
+              "static const unsigned char entity_value_lengths[ENTITY_COUNT] = {",
+              c_array([0] + [len(v) for v in values]), "};", "",
+              "static const unsigned short entity_hash_seeds[ENTITY_HASH_BUCKETS] = {",
+              c_array(seeds), "};", "",
+              "static const unsigned short entity_hash_slots[ENTITY_HASH_SLOTS] = {",
+              c_array(slots), "};", ""]
+
+    with open("src/entity_table.h", "w", newline="\r\n") as f:
+        f.write("\n".join(table))
+
+
+if __name__ == "__main__":
+    main()